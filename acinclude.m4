@@ -6,6 +6,14 @@ dnl Function to detect if libsigscan dependencies are available
 AC_DEFUN([AX_LIBSIGSCAN_CHECK_LOCAL],
   [dnl Check for internationalization functions in libsigscan/libsigscan_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for headers and functions used for direct IO in libsigscan/libsigscan_direct_file_io_handle.c
+  AC_CHECK_HEADERS([errno.h fcntl.h linux/fs.h sys/ioctl.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([close fstat ioctl lseek open pread stat])
+
+  dnl Check for functions used to determine the scan buffer size in libsigscan/libsigscan_scanner.c
+  AC_CHECK_FUNCS([sysconf])
 ])
 
 dnl Function to detect if sigscantools dependencies are available
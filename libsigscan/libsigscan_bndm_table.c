@@ -0,0 +1,506 @@
+/*
+ * Backward Nondeterministic DAWG Matching (BNDM) table functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_bndm_table.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_signature.h"
+
+/* Creates a BNDM table
+ * Make sure the value bndm_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_bndm_table_initialize(
+     libsigscan_bndm_table_t **bndm_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_bndm_table_initialize";
+
+	if( bndm_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid BNDM table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bndm_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid BNDM table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*bndm_table = memory_allocate_structure(
+	               libsigscan_bndm_table_t );
+
+	if( *bndm_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create BNDM table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bndm_table,
+	     0,
+	     sizeof( libsigscan_bndm_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear BNDM table.",
+		 function );
+
+		memory_free(
+		 *bndm_table );
+
+		*bndm_table = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *bndm_table != NULL )
+	{
+		memory_free(
+		 *bndm_table );
+
+		*bndm_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a BNDM table
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_bndm_table_free(
+     libsigscan_bndm_table_t **bndm_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_bndm_table_free";
+
+	if( bndm_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid BNDM table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bndm_table != NULL )
+	{
+		/* The signatures are referenced and freed elsewhere
+		 */
+		memory_free(
+		 *bndm_table );
+
+		*bndm_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Fills the BNDM table
+ * The signatures are only supported if there are no more than 8 signatures
+ * and every pattern is no larger than 64 bytes
+ * Returns 1 if successful, 0 if the signatures are not supported or -1 on error
+ */
+int libsigscan_bndm_table_fill(
+     libsigscan_bndm_table_t *bndm_table,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_bndm_table_fill";
+	size_t largest_pattern_size           = 0;
+	size_t pattern_index                  = 0;
+	size_t window_size                    = 0;
+	int number_of_patterns                = 0;
+	int pattern_lane                      = 0;
+
+	if( bndm_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid BNDM table.",
+		 function );
+
+		return( -1 );
+	}
+	if( bndm_table->number_of_patterns != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid BNDM table - patterns already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( number_of_patterns >= LIBSIGSCAN_BNDM_TABLE_MAXIMUM_NUMBER_OF_PATTERNS )
+		 || ( signature->pattern_size == 0 )
+		 || ( signature->pattern_size > LIBSIGSCAN_BNDM_TABLE_MAXIMUM_PATTERN_SIZE ) )
+		{
+			return( 0 );
+		}
+		if( ( window_size == 0 )
+		 || ( window_size > signature->pattern_size ) )
+		{
+			window_size = signature->pattern_size;
+		}
+		if( largest_pattern_size < signature->pattern_size )
+		{
+			largest_pattern_size = signature->pattern_size;
+		}
+		bndm_table->signatures[ number_of_patterns++ ] = signature;
+
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( number_of_patterns == 0 )
+	{
+		return( 0 );
+	}
+	/* Only the first window size bytes of every pattern are matched bit-parallel
+	 */
+	for( pattern_lane = 0;
+	     pattern_lane < number_of_patterns;
+	     pattern_lane++ )
+	{
+		signature = bndm_table->signatures[ pattern_lane ];
+
+		for( pattern_index = 0;
+		     pattern_index < window_size;
+		     pattern_index++ )
+		{
+			bndm_table->masks[ signature->pattern[ pattern_index ] ][ pattern_lane ] |= (uint64_t) 1 << ( window_size - 1 - pattern_index );
+		}
+	}
+	bndm_table->number_of_patterns   = number_of_patterns;
+	bndm_table->window_size          = window_size;
+	bndm_table->largest_pattern_size = largest_pattern_size;
+
+	return( 1 );
+}
+
+/* Retrieves the window size
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_bndm_table_get_window_size(
+     libsigscan_bndm_table_t *bndm_table,
+     size_t *window_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_bndm_table_get_window_size";
+
+	if( bndm_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid BNDM table.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid window size.",
+		 function );
+
+		return( -1 );
+	}
+	*window_size = bndm_table->window_size;
+
+	return( 1 );
+}
+
+/* Scans the buffer for the first pattern that matches at or after the buffer offset
+ * The window is read backwards and the state of every lane is updated with
+ * the mask of the byte value, where a lane without a pattern has an empty mask.
+ * The window is shifted to the last position where a lane recognized
+ * a prefix of its pattern, which is safe for every lane.
+ * If multiple patterns match at the same offset the largest pattern is matched,
+ * as by the scan tree
+ * Returns 1 if a pattern matches, 0 if not or -1 on error
+ */
+int libsigscan_bndm_table_scan_buffer(
+     libsigscan_bndm_table_t *bndm_table,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t *match_offset,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error )
+{
+	uint64_t states[ LIBSIGSCAN_BNDM_TABLE_MAXIMUM_NUMBER_OF_PATTERNS ];
+
+	libsigscan_signature_t *lane_signature     = NULL;
+	libsigscan_signature_t *matching_signature = NULL;
+	const uint64_t *masks                      = NULL;
+	static char *function                      = "libsigscan_bndm_table_scan_buffer";
+	size_t last_prefix_index                   = 0;
+	size_t window_index                        = 0;
+	size_t window_size                         = 0;
+	uint64_t active_states                     = 0;
+	uint64_t prefix_bit                        = 0;
+	uint64_t prefix_states                     = 0;
+	int pattern_lane                           = 0;
+
+	if( bndm_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid BNDM table.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	window_size = bndm_table->window_size;
+
+	if( ( window_size == 0 )
+	 || ( window_size > buffer_size ) )
+	{
+		return( 0 );
+	}
+	prefix_bit = (uint64_t) 1 << ( window_size - 1 );
+
+	while( buffer_offset <= ( buffer_size - window_size ) )
+	{
+		for( pattern_lane = 0;
+		     pattern_lane < LIBSIGSCAN_BNDM_TABLE_MAXIMUM_NUMBER_OF_PATTERNS;
+		     pattern_lane++ )
+		{
+			states[ pattern_lane ] = ~( (uint64_t) 0 );
+		}
+		window_index      = window_size;
+		last_prefix_index = window_size;
+
+		do
+		{
+			window_index -= 1;
+
+			masks = bndm_table->masks[ buffer[ buffer_offset + window_index ] ];
+
+			prefix_states = 0;
+
+			for( pattern_lane = 0;
+			     pattern_lane < LIBSIGSCAN_BNDM_TABLE_MAXIMUM_NUMBER_OF_PATTERNS;
+			     pattern_lane++ )
+			{
+				states[ pattern_lane ] &= masks[ pattern_lane ];
+				prefix_states          |= states[ pattern_lane ];
+			}
+			if( ( prefix_states & prefix_bit ) != 0 )
+			{
+				if( window_index > 0 )
+				{
+					last_prefix_index = window_index;
+				}
+				else
+				{
+					/* The window matches the start of at least one pattern
+					 * verify the remainder of the patterns
+					 */
+					for( pattern_lane = 0;
+					     pattern_lane < bndm_table->number_of_patterns;
+					     pattern_lane++ )
+					{
+						if( ( states[ pattern_lane ] & prefix_bit ) == 0 )
+						{
+							continue;
+						}
+						lane_signature = bndm_table->signatures[ pattern_lane ];
+
+						if( lane_signature->pattern_size > ( buffer_size - buffer_offset ) )
+						{
+							continue;
+						}
+						if( ( matching_signature != NULL )
+						 && ( lane_signature->pattern_size <= matching_signature->pattern_size ) )
+						{
+							continue;
+						}
+						if( ( lane_signature->pattern_size == window_size )
+						 || ( memory_compare(
+						       &( buffer[ buffer_offset + window_size ] ),
+						       &( lane_signature->pattern[ window_size ] ),
+						       lane_signature->pattern_size - window_size ) == 0 ) )
+						{
+							matching_signature = lane_signature;
+						}
+					}
+					if( matching_signature != NULL )
+					{
+						*match_offset = buffer_offset;
+						*signature    = matching_signature;
+
+						return( 1 );
+					}
+				}
+			}
+			active_states = 0;
+
+			for( pattern_lane = 0;
+			     pattern_lane < LIBSIGSCAN_BNDM_TABLE_MAXIMUM_NUMBER_OF_PATTERNS;
+			     pattern_lane++ )
+			{
+				states[ pattern_lane ] <<= 1;
+				active_states           |= states[ pattern_lane ];
+			}
+		}
+		while( ( active_states != 0 )
+		    && ( window_index > 0 ) );
+
+		buffer_offset += last_prefix_index;
+	}
+	return( 0 );
+}
+
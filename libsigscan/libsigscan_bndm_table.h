@@ -0,0 +1,98 @@
+/*
+ * Backward Nondeterministic DAWG Matching (BNDM) table functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_BNDM_TABLE_H )
+#define _LIBSIGSCAN_BNDM_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_bndm_table libsigscan_bndm_table_t;
+
+struct libsigscan_bndm_table
+{
+	/* The number of patterns
+	 */
+	int number_of_patterns;
+
+	/* The window size
+	 * The smallest pattern size, which is the number of bytes of every pattern
+	 * that is matched bit-parallel, the remainder of a pattern is verified
+	 */
+	size_t window_size;
+
+	/* The largest pattern size
+	 */
+	size_t largest_pattern_size;
+
+	/* The signatures, one per lane
+	 */
+	libsigscan_signature_t *signatures[ LIBSIGSCAN_BNDM_TABLE_MAXIMUM_NUMBER_OF_PATTERNS ];
+
+	/* The byte value masks, per byte value one mask per lane
+	 * bit ( window size - 1 - index ) is set if the pattern contains
+	 * the byte value at index
+	 */
+	uint64_t masks[ 256 ][ LIBSIGSCAN_BNDM_TABLE_MAXIMUM_NUMBER_OF_PATTERNS ];
+};
+
+int libsigscan_bndm_table_initialize(
+     libsigscan_bndm_table_t **bndm_table,
+     libcerror_error_t **error );
+
+int libsigscan_bndm_table_free(
+     libsigscan_bndm_table_t **bndm_table,
+     libcerror_error_t **error );
+
+int libsigscan_bndm_table_fill(
+     libsigscan_bndm_table_t *bndm_table,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
+int libsigscan_bndm_table_get_window_size(
+     libsigscan_bndm_table_t *bndm_table,
+     size_t *window_size,
+     libcerror_error_t **error );
+
+int libsigscan_bndm_table_scan_buffer(
+     libsigscan_bndm_table_t *bndm_table,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t *match_offset,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_BNDM_TABLE_H ) */
+
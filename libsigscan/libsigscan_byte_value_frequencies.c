@@ -0,0 +1,302 @@
+/*
+ * The byte value frequencies functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_byte_value_frequencies.h"
+#include "libsigscan_libcerror.h"
+
+/* Creates byte value frequencies
+ * Make sure the value byte_value_frequencies is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_frequencies_initialize(
+     libsigscan_byte_value_frequencies_t **byte_value_frequencies,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_frequencies_initialize";
+
+	if( byte_value_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_value_frequencies != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid byte value frequencies value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*byte_value_frequencies = memory_allocate_structure(
+	                           libsigscan_byte_value_frequencies_t );
+
+	if( *byte_value_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create byte value frequencies.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *byte_value_frequencies,
+	     0,
+	     sizeof( libsigscan_byte_value_frequencies_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear byte value frequencies.",
+		 function );
+
+		memory_free(
+		 *byte_value_frequencies );
+
+		*byte_value_frequencies = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *byte_value_frequencies != NULL )
+	{
+		memory_free(
+		 *byte_value_frequencies );
+
+		*byte_value_frequencies = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees byte value frequencies
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_frequencies_free(
+     libsigscan_byte_value_frequencies_t **byte_value_frequencies,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_frequencies_free";
+
+	if( byte_value_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_value_frequencies != NULL )
+	{
+		memory_free(
+		 *byte_value_frequencies );
+
+		*byte_value_frequencies = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the byte value frequencies with the byte values in a (sample data) buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_frequencies_update(
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_frequencies_update";
+	size_t buffer_offset  = 0;
+
+	if( byte_value_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint64_t) buffer_size > ( UINT64_MAX - byte_value_frequencies->total_frequency ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_offset = 0;
+	     buffer_offset < buffer_size;
+	     buffer_offset++ )
+	{
+		byte_value_frequencies->frequencies[ buffer[ buffer_offset ] ] += 1;
+	}
+	byte_value_frequencies->total_frequency += buffer_size;
+
+	return( 1 );
+}
+
+/* Retrieves the frequency of a specific byte value
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_byte_value_frequencies_get_frequency(
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     uint8_t byte_value,
+     uint64_t *frequency,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_frequencies_get_frequency";
+
+	if( byte_value_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( frequency == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency.",
+		 function );
+
+		return( -1 );
+	}
+	*frequency = byte_value_frequencies->frequencies[ byte_value ];
+
+	return( 1 );
+}
+
+/* Retrieves the weight of a specific byte value
+ * The weight is the number of bits of information a match of the byte value provides
+ * plus 1, hence a byte value that is less frequent has a larger weight
+ * Returns 1 if successful, 0 if no frequencies are available or -1 on error
+ */
+int libsigscan_byte_value_frequencies_get_weight(
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     uint8_t byte_value,
+     int *weight,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_byte_value_frequencies_get_weight";
+	uint64_t frequency    = 0;
+	int safe_weight       = 1;
+
+	if( byte_value_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( weight == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid weight.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_frequencies->total_frequency == 0 )
+	{
+		return( 0 );
+	}
+	frequency = byte_value_frequencies->frequencies[ byte_value ];
+
+	if( frequency == 0 )
+	{
+		safe_weight = 65;
+	}
+	else
+	{
+		while( ( frequency < byte_value_frequencies->total_frequency )
+		    && ( safe_weight < 65 ) )
+		{
+			frequency   <<= 1;
+			safe_weight  += 1;
+		}
+	}
+	*weight = safe_weight;
+
+	return( 1 );
+}
+
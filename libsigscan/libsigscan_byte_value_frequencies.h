@@ -0,0 +1,78 @@
+/*
+ * The byte value frequencies functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_BYTE_VALUE_FREQUENCIES_H )
+#define _LIBSIGSCAN_BYTE_VALUE_FREQUENCIES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_byte_value_frequencies libsigscan_byte_value_frequencies_t;
+
+struct libsigscan_byte_value_frequencies
+{
+	/* The frequencies (number of occurrences) per byte value
+	 */
+	uint64_t frequencies[ 256 ];
+
+	/* The total frequency (number of byte values)
+	 */
+	uint64_t total_frequency;
+};
+
+int libsigscan_byte_value_frequencies_initialize(
+     libsigscan_byte_value_frequencies_t **byte_value_frequencies,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_frequencies_free(
+     libsigscan_byte_value_frequencies_t **byte_value_frequencies,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_frequencies_update(
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_frequencies_get_frequency(
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     uint8_t byte_value,
+     uint64_t *frequency,
+     libcerror_error_t **error );
+
+int libsigscan_byte_value_frequencies_get_weight(
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     uint8_t byte_value,
+     int *weight,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_BYTE_VALUE_FREQUENCIES_H ) */
+
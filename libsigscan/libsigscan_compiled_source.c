@@ -0,0 +1,1340 @@
+/*
+ * Compiled source functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#include <stdarg.h>
+#else
+#error Missing header stdarg.h
+#endif
+
+#include "libsigscan_compiled_source.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_object.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature.h"
+
+/* Creates compiled source
+ * Make sure the value compiled_source is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_source_initialize(
+     libsigscan_compiled_source_t **compiled_source,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_source_initialize";
+
+	if( compiled_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compiled_source != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compiled source value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*compiled_source = memory_allocate_structure(
+	                    libsigscan_compiled_source_t );
+
+	if( *compiled_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compiled source.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compiled_source,
+	     0,
+	     sizeof( libsigscan_compiled_source_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compiled source.",
+		 function );
+
+		memory_free(
+		 *compiled_source );
+
+		*compiled_source = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *compiled_source != NULL )
+	{
+		memory_free(
+		 *compiled_source );
+
+		*compiled_source = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees compiled source
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_source_free(
+     libsigscan_compiled_source_t **compiled_source,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_source_free";
+
+	if( compiled_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compiled_source != NULL )
+	{
+		if( ( *compiled_source )->string != NULL )
+		{
+			memory_free(
+			 ( *compiled_source )->string );
+		}
+		memory_free(
+		 *compiled_source );
+
+		*compiled_source = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a string to the compiled source
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_source_append_string(
+     libsigscan_compiled_source_t *compiled_source,
+     const char *string,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libsigscan_compiled_source_append_string";
+	size_t allocated_size = 0;
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+
+	if( compiled_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled source.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = narrow_string_length(
+	                 string );
+
+	if( compiled_source->string_size == 0 )
+	{
+		compiled_source->string_size = 1;
+	}
+	string_index = compiled_source->string_size - 1;
+
+	if( string_length > ( (size_t) SSIZE_MAX - compiled_source->string_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compiled_source->string_size + string_length ) > compiled_source->allocated_size )
+	{
+		allocated_size = compiled_source->allocated_size;
+
+		if( allocated_size == 0 )
+		{
+			allocated_size = 4096;
+		}
+		while( allocated_size < ( compiled_source->string_size + string_length ) )
+		{
+			allocated_size *= 2;
+		}
+		reallocation = memory_reallocate(
+		                compiled_source->string,
+		                sizeof( char ) * allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string.",
+			 function );
+
+			return( -1 );
+		}
+		compiled_source->string         = (char *) reallocation;
+		compiled_source->allocated_size = allocated_size;
+	}
+	if( memory_copy(
+	     &( compiled_source->string[ string_index ] ),
+	     string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		return( -1 );
+	}
+	compiled_source->string_size += string_length;
+
+	compiled_source->string[ compiled_source->string_size - 1 ] = 0;
+
+	return( 1 );
+}
+
+/* Appends a formatted line to the compiled source
+ * The line is indented with a tab per indentation level
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_source_append_line(
+     libsigscan_compiled_source_t *compiled_source,
+     int indentation_level,
+     libcerror_error_t **error,
+     const char *format,
+     ... )
+{
+	char line[ 1024 ];
+
+	va_list argument_list;
+
+	static char *function = "libsigscan_compiled_source_append_line";
+	size_t line_index     = 0;
+	int print_count       = 0;
+
+	if( ( indentation_level < 0 )
+	 || ( indentation_level > 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid indentation level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format.",
+		 function );
+
+		return( -1 );
+	}
+	for( line_index = 0;
+	     line_index < (size_t) indentation_level;
+	     line_index++ )
+	{
+		line[ line_index ] = '\t';
+	}
+	va_start(
+	 argument_list,
+	 format );
+
+	print_count = narrow_string_vsnprintf(
+	               &( line[ line_index ] ),
+	               1024 - line_index,
+	               format,
+	               argument_list );
+
+	va_end(
+	 argument_list );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= ( 1024 - line_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format line.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_source_append_string(
+	     compiled_source,
+	     line,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append line.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends data as a C string literal to the compiled source
+ * Byte values other than letters, digits and underscores are written as octal escape sequences
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_source_append_string_literal(
+     libsigscan_compiled_source_t *compiled_source,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	char escaped_byte_value[ 5 ];
+
+	static char *function = "libsigscan_compiled_source_append_string_literal";
+	size_t data_offset    = 0;
+	uint8_t byte_value    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_source_append_string(
+	     compiled_source,
+	     "\"",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string literal start.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		byte_value = data[ data_offset ];
+
+		if( ( ( byte_value >= (uint8_t) '0' )
+		  &&  ( byte_value <= (uint8_t) '9' ) )
+		 || ( ( byte_value >= (uint8_t) 'A' )
+		  &&  ( byte_value <= (uint8_t) 'Z' ) )
+		 || ( ( byte_value >= (uint8_t) 'a' )
+		  &&  ( byte_value <= (uint8_t) 'z' ) )
+		 || ( byte_value == (uint8_t) '_' ) )
+		{
+			escaped_byte_value[ 0 ] = (char) byte_value;
+			escaped_byte_value[ 1 ] = 0;
+		}
+		else
+		{
+			/* An octal escape sequence of 3 digits cannot be extended
+			 * by the character that follows it
+			 */
+			escaped_byte_value[ 0 ] = '\\';
+			escaped_byte_value[ 1 ] = (char) ( '0' + ( ( byte_value >> 6 ) & 0x03 ) );
+			escaped_byte_value[ 2 ] = (char) ( '0' + ( ( byte_value >> 3 ) & 0x07 ) );
+			escaped_byte_value[ 3 ] = (char) ( '0' + ( byte_value & 0x07 ) );
+			escaped_byte_value[ 4 ] = 0;
+		}
+		if( libsigscan_compiled_source_append_string(
+		     compiled_source,
+		     escaped_byte_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append byte value: %" PRIzd ".",
+			 function,
+			 data_offset );
+
+			return( -1 );
+		}
+	}
+	if( libsigscan_compiled_source_append_string(
+	     compiled_source,
+	     "\"",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string literal end.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the start of the compiled source file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_source_append_preamble(
+     libsigscan_compiled_source_t *compiled_source,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_source_append_preamble";
+
+	if( libsigscan_compiled_source_append_string(
+	     compiled_source,
+	     "/*\n"
+	     " * Signature scan functions generated by libsigscan\n"
+	     " *\n"
+	     " * The scan trees are written as nested switch statements with constant\n"
+	     " * offsets. Regenerate this file when the signatures change.\n"
+	     " */\n"
+	     "\n"
+	     "#include <stddef.h>\n"
+	     "#include <string.h>\n",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append preamble.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the code that matches a signature to the compiled source
+ * The code returns the signature identifier if the pattern matches or NULL otherwise
+ * The checked buffer size is the buffer size already checked by the enclosing code
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_source_append_signature(
+     libsigscan_compiled_source_t *compiled_source,
+     libsigscan_signature_t *signature,
+     int pattern_offsets_mode,
+     uint64_t checked_buffer_size,
+     int indentation_level,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_source_append_signature";
+	uint64_t buffer_size  = 0;
+	uint64_t pattern_end  = 0;
+	int result            = 0;
+
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature->identifier == NULL )
+	 || ( signature->identifier_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature - missing identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature->pattern == NULL )
+	 || ( signature->pattern_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature - missing pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature->pattern_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid signature - pattern offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	{
+		pattern_end = (uint64_t) signature->pattern_offset + signature->pattern_size;
+		buffer_size = pattern_end;
+
+		if( buffer_size <= checked_buffer_size )
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          indentation_level,
+			          error,
+			          "if( memcmp( &( buffer[ %" PRIu64 " ] ), ",
+			          (uint64_t) signature->pattern_offset );
+		}
+		else
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          indentation_level,
+			          error,
+			          "if( ( buffer_size >= %" PRIu64 " )\n",
+			          buffer_size );
+
+			if( result == 1 )
+			{
+				result = libsigscan_compiled_source_append_line(
+				          compiled_source,
+				          indentation_level,
+				          error,
+				          " && ( memcmp( &( buffer[ %" PRIu64 " ] ), ",
+				          (uint64_t) signature->pattern_offset );
+			}
+		}
+	}
+	else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	{
+		/* The pattern offset is relative from the end of the data
+		 * if the pattern does not fit the signature cannot match
+		 */
+		if( (uint64_t) signature->pattern_offset < signature->pattern_size )
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          indentation_level,
+			          error,
+			          "return( NULL );\n" );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append signature: %s.",
+				 function,
+				 signature->identifier );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		buffer_size = (uint64_t) signature->pattern_offset;
+
+		if( buffer_size <= checked_buffer_size )
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          indentation_level,
+			          error,
+			          "if( memcmp( &( buffer[ buffer_size - %" PRIu64 " ] ), ",
+			          (uint64_t) signature->pattern_offset );
+		}
+		else
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          indentation_level,
+			          error,
+			          "if( ( buffer_size >= %" PRIu64 " )\n",
+			          buffer_size );
+
+			if( result == 1 )
+			{
+				result = libsigscan_compiled_source_append_line(
+				          compiled_source,
+				          indentation_level,
+				          error,
+				          " && ( memcmp( &( buffer[ buffer_size - %" PRIu64 " ] ), ",
+				          (uint64_t) signature->pattern_offset );
+			}
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_compiled_source_append_string_literal(
+		          compiled_source,
+		          signature->pattern,
+		          signature->pattern_size,
+		          error );
+	}
+	if( result == 1 )
+	{
+		if( buffer_size <= checked_buffer_size )
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          0,
+			          error,
+			          ", %" PRIzd " ) == 0 )\n",
+			          signature->pattern_size );
+		}
+		else
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          0,
+			          error,
+			          ", %" PRIzd " ) == 0 ) )\n",
+			          signature->pattern_size );
+		}
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_compiled_source_append_line(
+		          compiled_source,
+		          indentation_level,
+		          error,
+		          "{\n" );
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_compiled_source_append_line(
+		          compiled_source,
+		          indentation_level + 1,
+		          error,
+		          "return( " );
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_compiled_source_append_string_literal(
+		          compiled_source,
+		          (uint8_t *) signature->identifier,
+		          signature->identifier_size - 1,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_compiled_source_append_string(
+		          compiled_source,
+		          " );\n",
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_compiled_source_append_line(
+		          compiled_source,
+		          indentation_level,
+		          error,
+		          "}\n" );
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_compiled_source_append_line(
+		          compiled_source,
+		          indentation_level,
+		          error,
+		          "return( NULL );\n" );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append signature: %s.",
+		 function,
+		 signature->identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the code of a scan object to the compiled source
+ * The code always ends with a return statement
+ * The checked buffer size is the buffer size already checked by the enclosing code
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_source_append_scan_object(
+     libsigscan_compiled_source_t *compiled_source,
+     libsigscan_scan_object_t *scan_object,
+     int pattern_offsets_mode,
+     uint64_t range_start,
+     uint64_t checked_buffer_size,
+     int indentation_level,
+     libcerror_error_t **error )
+{
+	intptr_t *scan_object_value = NULL;
+	static char *function       = "libsigscan_compiled_source_append_scan_object";
+	uint8_t scan_object_type    = 0;
+	int result                  = 0;
+
+	if( scan_object == NULL )
+	{
+		result = libsigscan_compiled_source_append_line(
+		          compiled_source,
+		          indentation_level,
+		          error,
+		          "return( NULL );\n" );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append return statement.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libsigscan_scan_object_get_type(
+	     scan_object,
+	     &scan_object_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan object type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_object_get_value(
+	     scan_object,
+	     &scan_object_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan object value.",
+		 function );
+
+		return( -1 );
+	}
+	switch( scan_object_type )
+	{
+		case LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE:
+			result = libsigscan_compiled_source_append_scan_tree_node(
+			          compiled_source,
+			          (libsigscan_scan_tree_node_t *) scan_object_value,
+			          pattern_offsets_mode,
+			          range_start,
+			          checked_buffer_size,
+			          indentation_level,
+			          error );
+			break;
+
+		case LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE:
+			result = libsigscan_compiled_source_append_signature(
+			          compiled_source,
+			          (libsigscan_signature_t *) scan_object_value,
+			          pattern_offsets_mode,
+			          checked_buffer_size,
+			          indentation_level,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported scan object type: 0x%02" PRIx8 ".",
+			 function,
+			 scan_object_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan object.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the code of a scan tree node to the compiled source
+ * The scan tree node is written as a switch statement on the byte value at its
+ * pattern offset, byte values that share a scan object share a case
+ * The checked buffer size is the buffer size already checked by the enclosing code
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_source_append_scan_tree_node(
+     libsigscan_compiled_source_t *compiled_source,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     int pattern_offsets_mode,
+     uint64_t range_start,
+     uint64_t checked_buffer_size,
+     int indentation_level,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t *scan_object = NULL;
+	static char *function                 = "libsigscan_compiled_source_append_scan_tree_node";
+	uint64_t buffer_offset                = 0;
+	uint64_t buffer_size                  = 0;
+	int byte_value                        = 0;
+	int compare_byte_value                = 0;
+	int has_byte_value                    = 0;
+	int result                            = 1;
+	int switch_indentation_level          = 0;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( indentation_level < 0 )
+	 || ( indentation_level > 252 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid indentation level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( scan_tree_node->scan_objects_table[ byte_value ] != NULL )
+		{
+			has_byte_value = 1;
+
+			break;
+		}
+	}
+	switch_indentation_level = indentation_level;
+
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	{
+		/* A byte value outside the data is handled by the default scan object
+		 */
+		if( scan_tree_node->pattern_offset < 0 )
+		{
+			has_byte_value = 0;
+		}
+		if( has_byte_value != 0 )
+		{
+			buffer_offset = (uint64_t) scan_tree_node->pattern_offset;
+			buffer_size   = buffer_offset + 1;
+
+			/* The buffer size check is omitted if the enclosing code already checked it
+			 */
+			if( buffer_size > checked_buffer_size )
+			{
+				result = libsigscan_compiled_source_append_line(
+				          compiled_source,
+				          indentation_level,
+				          error,
+				          "if( buffer_size > %" PRIu64 " )\n",
+				          buffer_offset );
+
+				if( result == 1 )
+				{
+					result = libsigscan_compiled_source_append_line(
+					          compiled_source,
+					          indentation_level,
+					          error,
+					          "{\n" );
+				}
+				switch_indentation_level = indentation_level + 1;
+			}
+			if( result == 1 )
+			{
+				result = libsigscan_compiled_source_append_line(
+				          compiled_source,
+				          switch_indentation_level,
+				          error,
+				          "switch( buffer[ %" PRIu64 " ] )\n",
+				          buffer_offset );
+			}
+		}
+	}
+	else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	{
+		/* The pattern offset of the scan tree node is relative to the start
+		 * of the range, which is range start bytes before the end of the data
+		 */
+		if( scan_tree_node->pattern_offset >= (off64_t) range_start )
+		{
+			has_byte_value = 0;
+		}
+		if( has_byte_value != 0 )
+		{
+			buffer_offset = range_start - scan_tree_node->pattern_offset;
+			buffer_size   = buffer_offset;
+
+			/* The buffer size check is omitted if the enclosing code already checked it
+			 */
+			if( buffer_size > checked_buffer_size )
+			{
+				result = libsigscan_compiled_source_append_line(
+				          compiled_source,
+				          indentation_level,
+				          error,
+				          "if( buffer_size >= %" PRIu64 " )\n",
+				          buffer_offset );
+
+				if( result == 1 )
+				{
+					result = libsigscan_compiled_source_append_line(
+					          compiled_source,
+					          indentation_level,
+					          error,
+					          "{\n" );
+				}
+				switch_indentation_level = indentation_level + 1;
+			}
+			if( result == 1 )
+			{
+				result = libsigscan_compiled_source_append_line(
+				          compiled_source,
+				          switch_indentation_level,
+				          error,
+				          "switch( buffer[ buffer_size - %" PRIu64 " ] )\n",
+				          buffer_offset );
+			}
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 1 )
+	 && ( has_byte_value != 0 ) )
+	{
+		/* The code of the scan objects in the switch statement can rely
+		 * on the largest buffer size checked so far
+		 */
+		if( buffer_size < checked_buffer_size )
+		{
+			buffer_size = checked_buffer_size;
+		}
+		result = libsigscan_compiled_source_append_line(
+		          compiled_source,
+		          switch_indentation_level,
+		          error,
+		          "{\n" );
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			if( result != 1 )
+			{
+				break;
+			}
+			scan_object = scan_tree_node->scan_objects_table[ byte_value ];
+
+			if( scan_object == NULL )
+			{
+				continue;
+			}
+			/* Skip byte values of which the scan object already has been written
+			 */
+			for( compare_byte_value = 0;
+			     compare_byte_value < byte_value;
+			     compare_byte_value++ )
+			{
+				if( scan_tree_node->scan_objects_table[ compare_byte_value ] == scan_object )
+				{
+					break;
+				}
+			}
+			if( compare_byte_value < byte_value )
+			{
+				continue;
+			}
+			for( compare_byte_value = byte_value;
+			     compare_byte_value < 256;
+			     compare_byte_value++ )
+			{
+				if( scan_tree_node->scan_objects_table[ compare_byte_value ] != scan_object )
+				{
+					continue;
+				}
+				result = libsigscan_compiled_source_append_line(
+				          compiled_source,
+				          switch_indentation_level + 1,
+				          error,
+				          "case 0x%02x:\n",
+				          compare_byte_value );
+
+				if( result != 1 )
+				{
+					break;
+				}
+			}
+			if( result == 1 )
+			{
+				result = libsigscan_compiled_source_append_scan_object(
+				          compiled_source,
+				          scan_object,
+				          pattern_offsets_mode,
+				          range_start,
+				          buffer_size,
+				          switch_indentation_level + 2,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libsigscan_compiled_source_append_string(
+				          compiled_source,
+				          "\n",
+				          error );
+			}
+		}
+		if( result == 1 )
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          switch_indentation_level + 1,
+			          error,
+			          "default:\n" );
+		}
+		if( result == 1 )
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          switch_indentation_level + 2,
+			          error,
+			          "break;\n" );
+		}
+		if( result == 1 )
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          switch_indentation_level,
+			          error,
+			          "}\n" );
+		}
+		if( ( result == 1 )
+		 && ( switch_indentation_level != indentation_level ) )
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          indentation_level,
+			          error,
+			          "}\n" );
+		}
+	}
+	/* The default scan object handles the byte values without a scan object
+	 */
+	if( result == 1 )
+	{
+		result = libsigscan_compiled_source_append_scan_object(
+		          compiled_source,
+		          scan_tree_node->default_scan_object,
+		          pattern_offsets_mode,
+		          range_start,
+		          checked_buffer_size,
+		          indentation_level,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the scan function of a scan tree to the compiled source
+ * The scan function of a scan tree without signatures always returns NULL
+ * Returns 1 if successful, 0 if the scan tree cannot be compiled or -1 on error
+ */
+int libsigscan_compiled_source_append_scan_tree(
+     libsigscan_compiled_source_t *compiled_source,
+     libsigscan_scan_tree_t *scan_tree,
+     const char *prefix,
+     size_t prefix_length,
+     libcerror_error_t **error )
+{
+	const char *data_description = NULL;
+	const char *function_suffix  = NULL;
+	static char *function        = "libsigscan_compiled_source_append_scan_tree";
+	uint64_t range_size          = 0;
+	uint64_t range_start         = 0;
+	int result                   = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( prefix_length == 0 )
+	 || ( prefix_length > 128 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid prefix length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( scan_tree->pattern_offsets_mode )
+	{
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
+			data_description = "start";
+			function_suffix  = "header";
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
+			data_description = "end";
+			function_suffix  = "footer";
+			break;
+
+		default:
+			/* Unbound scan trees are scanned using skip values
+			 * which has no fixed offset decision tree representation
+			 */
+			return( 0 );
+	}
+	result = libsigscan_scan_tree_get_spanning_range(
+	          scan_tree,
+	          &range_start,
+	          &range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve spanning range.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		range_start = 0;
+	}
+	result = libsigscan_compiled_source_append_line(
+	          compiled_source,
+	          0,
+	          error,
+	          "\n"
+	          "/* Scans the %s of the data for a signature\n"
+	          " * The buffer must contain the %s of the data\n"
+	          " * Returns the identifier of the matching signature or NULL if no signature matches\n"
+	          " */\n"
+	          "const char *%.*s_scan_%s(\n"
+	          "             const unsigned char *buffer,\n"
+	          "             size_t buffer_size )\n"
+	          "{\n"
+	          "\tif( buffer == NULL )\n"
+	          "\t{\n"
+	          "\t\treturn( NULL );\n"
+	          "\t}\n",
+	          data_description,
+	          data_description,
+	          (int) prefix_length,
+	          prefix,
+	          function_suffix );
+
+	if( result == 1 )
+	{
+		if( scan_tree->root_node == NULL )
+		{
+			result = libsigscan_compiled_source_append_line(
+			          compiled_source,
+			          1,
+			          error,
+			          "/* There are no signatures to scan for\n"
+			          "\t */\n"
+			          "\t( void ) buffer_size;\n"
+			          "\n"
+			          "\treturn( NULL );\n" );
+		}
+		else
+		{
+			result = libsigscan_compiled_source_append_scan_tree_node(
+			          compiled_source,
+			          scan_tree->root_node,
+			          scan_tree->pattern_offsets_mode,
+			          range_start,
+			          0,
+			          1,
+			          error );
+		}
+	}
+	if( result == 1 )
+	{
+		result = libsigscan_compiled_source_append_string(
+		          compiled_source,
+		          "}\n",
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,124 @@
+/*
+ * Compiled source functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_COMPILED_SOURCE_H )
+#define _LIBSIGSCAN_COMPILED_SOURCE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_object.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_compiled_source libsigscan_compiled_source_t;
+
+struct libsigscan_compiled_source
+{
+	/* The source string
+	 */
+	char *string;
+
+	/* The source string size
+	 * This value includes the end-of-string character
+	 */
+	size_t string_size;
+
+	/* The allocated size of the source string
+	 */
+	size_t allocated_size;
+};
+
+int libsigscan_compiled_source_initialize(
+     libsigscan_compiled_source_t **compiled_source,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_source_free(
+     libsigscan_compiled_source_t **compiled_source,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_source_append_string(
+     libsigscan_compiled_source_t *compiled_source,
+     const char *string,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_source_append_line(
+     libsigscan_compiled_source_t *compiled_source,
+     int indentation_level,
+     libcerror_error_t **error,
+     const char *format,
+     ... );
+
+int libsigscan_compiled_source_append_string_literal(
+     libsigscan_compiled_source_t *compiled_source,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_source_append_preamble(
+     libsigscan_compiled_source_t *compiled_source,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_source_append_signature(
+     libsigscan_compiled_source_t *compiled_source,
+     libsigscan_signature_t *signature,
+     int pattern_offsets_mode,
+     uint64_t checked_buffer_size,
+     int indentation_level,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_source_append_scan_object(
+     libsigscan_compiled_source_t *compiled_source,
+     libsigscan_scan_object_t *scan_object,
+     int pattern_offsets_mode,
+     uint64_t range_start,
+     uint64_t checked_buffer_size,
+     int indentation_level,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_source_append_scan_tree_node(
+     libsigscan_compiled_source_t *compiled_source,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     int pattern_offsets_mode,
+     uint64_t range_start,
+     uint64_t checked_buffer_size,
+     int indentation_level,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_source_append_scan_tree(
+     libsigscan_compiled_source_t *compiled_source,
+     libsigscan_scan_tree_t *scan_tree,
+     const char *prefix,
+     size_t prefix_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_COMPILED_SOURCE_H ) */
+
@@ -0,0 +1,1087 @@
+/*
+ * Direct (unbuffered) file IO handle functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* O_DIRECT is only defined by the GNU C library if _GNU_SOURCE is defined
+ */
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_SYS_IOCTL_H )
+#include <sys/ioctl.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H )
+#include <linux/fs.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_direct_file_io_handle.h"
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_unused.h"
+
+#if defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE )
+
+/* Creates a direct file IO handle
+ * Make sure the value direct_file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_direct_file_io_handle_initialize(
+     libsigscan_direct_file_io_handle_t **direct_file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_direct_file_io_handle_initialize";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*direct_file_io_handle = memory_allocate_structure(
+	                          libsigscan_direct_file_io_handle_t );
+
+	if( *direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create direct file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *direct_file_io_handle,
+	     0,
+	     sizeof( libsigscan_direct_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear direct file IO handle.",
+		 function );
+
+		memory_free(
+		 *direct_file_io_handle );
+
+		*direct_file_io_handle = NULL;
+
+		return( -1 );
+	}
+	( *direct_file_io_handle )->file_descriptor = -1;
+
+	( *direct_file_io_handle )->name = narrow_string_allocate(
+	                                    name_length + 1 );
+
+	if( ( *direct_file_io_handle )->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     ( *direct_file_io_handle )->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	( *direct_file_io_handle )->name[ name_length ] = 0;
+
+	( *direct_file_io_handle )->name_size = name_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( *direct_file_io_handle != NULL )
+	{
+		if( ( *direct_file_io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *direct_file_io_handle )->name );
+		}
+		memory_free(
+		 *direct_file_io_handle );
+
+		*direct_file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Initializes a handle that reads a file directly, bypassing the page cache
+ * The name length should not include the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_direct_file_initialize(
+     libbfio_handle_t **handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	libsigscan_direct_file_io_handle_t *direct_file_io_handle = NULL;
+	static char *function                                     = "libsigscan_direct_file_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_direct_file_io_handle_initialize(
+	     &direct_file_io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) direct_file_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libsigscan_direct_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libsigscan_direct_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libsigscan_direct_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libsigscan_direct_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libsigscan_direct_file_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libsigscan_direct_file_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libsigscan_direct_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libsigscan_direct_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libsigscan_direct_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libsigscan_direct_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( direct_file_io_handle != NULL )
+	{
+		libsigscan_direct_file_io_handle_free(
+		 &direct_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a direct file IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libsigscan_direct_file_io_handle_free(
+     libsigscan_direct_file_io_handle_t **direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_direct_file_io_handle_free";
+	int result            = 1;
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file_io_handle != NULL )
+	{
+		if( ( *direct_file_io_handle )->file_descriptor != -1 )
+		{
+			if( libsigscan_direct_file_io_handle_close(
+			     *direct_file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close direct file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *direct_file_io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *direct_file_io_handle )->name );
+		}
+		memory_free(
+		 *direct_file_io_handle );
+
+		*direct_file_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the direct file IO handle and its attributes
+ * Returns 1 if succesful or -1 on error
+ */
+int libsigscan_direct_file_io_handle_clone(
+     libsigscan_direct_file_io_handle_t **destination_direct_file_io_handle,
+     libsigscan_direct_file_io_handle_t *source_direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_direct_file_io_handle_clone";
+
+	if( destination_direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_direct_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination direct file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_direct_file_io_handle == NULL )
+	{
+		*destination_direct_file_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libsigscan_direct_file_io_handle_initialize(
+	     destination_direct_file_io_handle,
+	     source_direct_file_io_handle->name,
+	     source_direct_file_io_handle->name_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the direct file IO handle
+ * The file is opened with O_DIRECT, or F_NOCACHE where O_DIRECT is not available,
+ * if the file system or device does not support this the file is read buffered
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_direct_file_io_handle_open(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libsigscan_direct_file_io_handle_open";
+	size_t block_size     = 0;
+	off64_t end_offset    = 0;
+
+#if defined( BLKSSZGET )
+	int sector_size       = 0;
+#endif
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file IO handle - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	direct_file_io_handle->is_direct = 0;
+
+#if defined( O_DIRECT )
+	direct_file_io_handle->file_descriptor = open(
+	                                          direct_file_io_handle->name,
+	                                          O_RDONLY | O_DIRECT );
+
+	/* Some file systems, like tmpfs, do not support O_DIRECT
+	 */
+	if( ( direct_file_io_handle->file_descriptor == -1 )
+	 && ( errno == EINVAL ) )
+	{
+		direct_file_io_handle->file_descriptor = open(
+		                                          direct_file_io_handle->name,
+		                                          O_RDONLY );
+	}
+	else if( direct_file_io_handle->file_descriptor != -1 )
+	{
+		direct_file_io_handle->is_direct = 1;
+	}
+#else
+	direct_file_io_handle->file_descriptor = open(
+	                                          direct_file_io_handle->name,
+	                                          O_RDONLY );
+
+#if defined( F_NOCACHE )
+	if( ( direct_file_io_handle->file_descriptor != -1 )
+	 && ( fcntl(
+	       direct_file_io_handle->file_descriptor,
+	       F_NOCACHE,
+	       1 ) != -1 ) )
+	{
+		direct_file_io_handle->is_direct = 1;
+	}
+#endif
+#endif /* defined( O_DIRECT ) */
+
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 direct_file_io_handle->name );
+
+		return( -1 );
+	}
+	if( fstat(
+	     direct_file_io_handle->file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( S_ISREG( file_statistics.st_mode ) )
+	{
+		direct_file_io_handle->size = (size64_t) file_statistics.st_size;
+
+		/* The preferred IO size of the file system is used as the block size
+		 */
+		block_size = (size_t) file_statistics.st_blksize;
+	}
+	else
+	{
+		/* The size of a device is determined by seeking its end
+		 */
+		end_offset = lseek(
+		              direct_file_io_handle->file_descriptor,
+		              0,
+		              SEEK_END );
+
+		if( end_offset < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to seek end of file.",
+			 function );
+
+			goto on_error;
+		}
+		direct_file_io_handle->size = (size64_t) end_offset;
+
+#if defined( BLKSSZGET )
+		if( ioctl(
+		     direct_file_io_handle->file_descriptor,
+		     BLKSSZGET,
+		     &sector_size ) == 0 )
+		{
+			block_size = (size_t) sector_size;
+		}
+#endif
+	}
+	/* The block size must be a power of 2 of at least 512
+	 */
+	if( ( block_size < 512 )
+	 || ( block_size > LIBSIGSCAN_DIRECT_IO_MAXIMUM_BLOCK_SIZE )
+	 || ( ( block_size & ( block_size - 1 ) ) != 0 ) )
+	{
+		block_size = LIBSIGSCAN_DIRECT_IO_DEFAULT_BLOCK_SIZE;
+	}
+	direct_file_io_handle->block_size        = block_size;
+	direct_file_io_handle->block_buffer_size = LIBSIGSCAN_DIRECT_IO_BLOCK_BUFFER_SIZE;
+
+	if( direct_file_io_handle->block_buffer_size < block_size )
+	{
+		direct_file_io_handle->block_buffer_size = block_size;
+	}
+	direct_file_io_handle->block_buffer_allocation = (uint8_t *) memory_allocate(
+	                                                              sizeof( uint8_t ) * ( direct_file_io_handle->block_buffer_size + block_size ) );
+
+	if( direct_file_io_handle->block_buffer_allocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block buffer.",
+		 function );
+
+		goto on_error;
+	}
+	direct_file_io_handle->block_buffer = direct_file_io_handle->block_buffer_allocation;
+
+	if( ( (intptr_t) direct_file_io_handle->block_buffer % block_size ) != 0 )
+	{
+		direct_file_io_handle->block_buffer += block_size - ( (intptr_t) direct_file_io_handle->block_buffer % block_size );
+	}
+	direct_file_io_handle->access_flags   = access_flags;
+	direct_file_io_handle->current_offset = 0;
+
+	return( 1 );
+
+on_error:
+	close(
+	 direct_file_io_handle->file_descriptor );
+
+	direct_file_io_handle->file_descriptor = -1;
+
+	return( -1 );
+}
+
+/* Closes the direct file IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libsigscan_direct_file_io_handle_close(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_direct_file_io_handle_close";
+	int result            = 0;
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( close(
+	     direct_file_io_handle->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	direct_file_io_handle->file_descriptor = -1;
+	direct_file_io_handle->access_flags    = 0;
+	direct_file_io_handle->is_direct       = 0;
+	direct_file_io_handle->current_offset  = 0;
+	direct_file_io_handle->size            = 0;
+
+	if( direct_file_io_handle->block_buffer_allocation != NULL )
+	{
+		memory_free(
+		 direct_file_io_handle->block_buffer_allocation );
+
+		direct_file_io_handle->block_buffer_allocation = NULL;
+	}
+	direct_file_io_handle->block_buffer      = NULL;
+	direct_file_io_handle->block_buffer_size = 0;
+
+	return( result );
+}
+
+/* Reads a buffer from the direct file IO handle
+ * Reads of which the offset, buffer and size are aligned to the block size
+ * are read directly into the buffer, other reads are read block aligned into
+ * the block buffer, which also handles the unaligned tail of the file
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libsigscan_direct_file_io_handle_read(
+         libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libsigscan_direct_file_io_handle_read";
+	size_t block_offset   = 0;
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	off64_t read_offset   = 0;
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) direct_file_io_handle->current_offset >= direct_file_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( direct_file_io_handle->size - direct_file_io_handle->current_offset ) )
+	{
+		size = (size_t) ( direct_file_io_handle->size - direct_file_io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		read_offset  = direct_file_io_handle->current_offset;
+		block_offset = (size_t) ( read_offset % direct_file_io_handle->block_size );
+		read_size    = size - buffer_offset;
+
+		if( ( block_offset == 0 )
+		 && ( read_size >= direct_file_io_handle->block_size )
+		 && ( ( (intptr_t) &( buffer[ buffer_offset ] ) % direct_file_io_handle->block_size ) == 0 ) )
+		{
+			read_size -= read_size % direct_file_io_handle->block_size;
+
+			read_count = pread(
+			              direct_file_io_handle->file_descriptor,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              read_offset );
+		}
+		else
+		{
+			read_offset -= (off64_t) block_offset;
+
+			read_count = pread(
+			              direct_file_io_handle->file_descriptor,
+			              direct_file_io_handle->block_buffer,
+			              direct_file_io_handle->block_buffer_size,
+			              read_offset );
+
+			if( read_count > (ssize_t) block_offset )
+			{
+				read_count -= (ssize_t) block_offset;
+
+				if( (size_t) read_count > read_size )
+				{
+					read_count = (ssize_t) read_size;
+				}
+				if( memory_copy(
+				     &( buffer[ buffer_offset ] ),
+				     &( direct_file_io_handle->block_buffer[ block_offset ] ),
+				     (size_t) read_count ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy block buffer data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else if( read_count >= 0 )
+			{
+				read_count = 0;
+			}
+		}
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 direct_file_io_handle->current_offset,
+			 direct_file_io_handle->current_offset );
+
+			return( -1 );
+		}
+		/* The file was truncated after it was opened
+		 */
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset                         += (size_t) read_count;
+		direct_file_io_handle->current_offset += (off64_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the direct file IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libsigscan_direct_file_io_handle_write(
+         libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+         const uint8_t *buffer LIBSIGSCAN_ATTRIBUTE_UNUSED,
+         size_t size LIBSIGSCAN_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libsigscan_direct_file_io_handle_write";
+
+	LIBSIGSCAN_UNREFERENCED_PARAMETER( buffer )
+	LIBSIGSCAN_UNREFERENCED_PARAMETER( size )
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access currently not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the direct file IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libsigscan_direct_file_io_handle_seek_offset(
+         libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libsigscan_direct_file_io_handle_seek_offset";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += direct_file_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) direct_file_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	direct_file_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libsigscan_direct_file_io_handle_exists(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libsigscan_direct_file_io_handle_exists";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat(
+	     direct_file_io_handle->name,
+	     &file_statistics ) != 0 )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Check if the file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libsigscan_direct_file_io_handle_is_open(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_direct_file_io_handle_is_open";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file size
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_direct_file_io_handle_get_size(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_direct_file_io_handle_get_size";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = direct_file_io_handle->size;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE ) */
+
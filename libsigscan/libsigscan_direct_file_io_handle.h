@@ -0,0 +1,160 @@
+/*
+ * Direct (unbuffered) file IO handle functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_DIRECT_FILE_IO_HANDLE_H )
+#define _LIBSIGSCAN_DIRECT_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_OPEN ) && defined( HAVE_PREAD ) && defined( HAVE_FSTAT ) && !defined( WINAPI )
+#define HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE	1
+#endif
+
+#if defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE )
+
+typedef struct libsigscan_direct_file_io_handle libsigscan_direct_file_io_handle_t;
+
+struct libsigscan_direct_file_io_handle
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 * This value includes the end-of-string character
+	 */
+	size_t name_size;
+
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* Value to indicate the page cache is bypassed
+	 */
+	uint8_t is_direct;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The (logical) block size
+	 */
+	size_t block_size;
+
+	/* The block buffer
+	 * This buffer is aligned to the block size
+	 */
+	uint8_t *block_buffer;
+
+	/* The block buffer size
+	 */
+	size_t block_buffer_size;
+
+	/* The block buffer allocation
+	 */
+	uint8_t *block_buffer_allocation;
+};
+
+int libsigscan_direct_file_io_handle_initialize(
+     libsigscan_direct_file_io_handle_t **direct_file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libsigscan_direct_file_initialize(
+     libbfio_handle_t **handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libsigscan_direct_file_io_handle_free(
+     libsigscan_direct_file_io_handle_t **direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libsigscan_direct_file_io_handle_clone(
+     libsigscan_direct_file_io_handle_t **destination_direct_file_io_handle,
+     libsigscan_direct_file_io_handle_t *source_direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libsigscan_direct_file_io_handle_open(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libsigscan_direct_file_io_handle_close(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libsigscan_direct_file_io_handle_read(
+         libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libsigscan_direct_file_io_handle_write(
+         libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libsigscan_direct_file_io_handle_seek_offset(
+         libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libsigscan_direct_file_io_handle_exists(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libsigscan_direct_file_io_handle_is_open(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libsigscan_direct_file_io_handle_get_size(
+     libsigscan_direct_file_io_handle_t *direct_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_DIRECT_FILE_IO_HANDLE_H ) */
+
@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
 #include "libsigscan_scan_object.h"
@@ -120,8 +121,9 @@ int libsigscan_scan_object_initialize(
 
 		return( -1 );
 	}
-	( *scan_object )->type  = type;
-	( *scan_object )->value = value;
+	( *scan_object )->type                 = type;
+	( *scan_object )->value                = value;
+	( *scan_object )->number_of_references = 1;
 
 	return( 1 );
 
@@ -159,6 +161,16 @@ int libsigscan_scan_object_free(
 	}
 	if( *scan_object != NULL )
 	{
+		/* The scan object is shared by another scan tree node
+		 */
+		if( ( *scan_object )->number_of_references > 1 )
+		{
+			( *scan_object )->number_of_references -= 1;
+
+			*scan_object = NULL;
+
+			return( 1 );
+		}
 		/* No need to free signature values since they are freed elsewhere
 		 */
 		if( ( *scan_object )->type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
@@ -185,6 +197,80 @@ int libsigscan_scan_object_free(
 	return( result );
 }
 
+/* Compares two scan objects
+ * Scan objects that contain a signature are considered equal if they refer to the same signature
+ * Scan objects that contain a scan tree node are considered equal if the scan tree nodes are identical
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libsigscan_scan_object_compare(
+     libsigscan_scan_object_t *first_scan_object,
+     libsigscan_scan_object_t *second_scan_object,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_object_compare";
+	int result            = 0;
+
+	if( first_scan_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first scan object.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_scan_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second scan object.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_scan_object->type < second_scan_object->type )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_scan_object->type > second_scan_object->type )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_scan_object->type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+	{
+		result = libsigscan_scan_tree_node_compare(
+		          (libsigscan_scan_tree_node_t *) first_scan_object->value,
+		          (libsigscan_scan_tree_node_t *) second_scan_object->value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare scan tree nodes.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	if( first_scan_object->value < second_scan_object->value )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_scan_object->value > second_scan_object->value )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
 /* Retrieves the type
  * Returns 1 if successful or -1 on error
  */
@@ -43,6 +43,12 @@ struct libsigscan_scan_object
 	 * Contains a scan tree node or a signature
 	 */
 	intptr_t *value;
+
+	/* The number of references
+	 * A scan object can be shared by multiple scan tree nodes
+	 * after identical scan objects have been merged
+	 */
+	int number_of_references;
 };
 
 int libsigscan_scan_object_initialize(
@@ -55,6 +61,11 @@ int libsigscan_scan_object_free(
      libsigscan_scan_object_t **scan_object,
      libcerror_error_t **error );
 
+int libsigscan_scan_object_compare(
+     libsigscan_scan_object_t *first_scan_object,
+     libsigscan_scan_object_t *second_scan_object,
+     libcerror_error_t **error );
+
 int libsigscan_scan_object_get_type(
      libsigscan_scan_object_t *scan_object,
      uint8_t *type,
@@ -276,3 +276,43 @@ int libsigscan_scan_result_get_identifier(
 	return( 1 );
 }
 
+/* Retrieves the offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_result_get_offset(
+     libsigscan_scan_result_t *scan_result,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_result_t *internal_scan_result = NULL;
+	static char *function                                   = "libsigscan_scan_result_get_offset";
+
+	if( scan_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_result = (libsigscan_internal_scan_result_t *) scan_result;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_scan_result->offset;
+
+	return( 1 );
+}
+
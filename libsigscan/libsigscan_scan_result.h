@@ -76,6 +76,12 @@ int libsigscan_scan_result_get_identifier(
      size_t identifier_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_result_get_offset(
+     libsigscan_scan_result_t *scan_result,
+     off64_t *offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
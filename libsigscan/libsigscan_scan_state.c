@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_bndm_table.h"
 #include "libsigscan_definitions.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
@@ -30,6 +31,7 @@
 #include "libsigscan_scan_state.h"
 #include "libsigscan_scan_tree.h"
 #include "libsigscan_scan_tree_node.h"
+#include "libsigscan_skip_table.h"
 #include "libsigscan_types.h"
 
 /* Creates scan state
@@ -154,10 +156,36 @@ int libsigscan_scan_state_free(
 
 		/* The scan_tree and active_node are references and freed elsewhere
 		 */
-		if( internal_scan_state->buffer != NULL )
+		if( internal_scan_state->header_buffer != NULL )
 		{
 			memory_free(
-			 internal_scan_state->buffer );
+			 internal_scan_state->header_buffer );
+		}
+		if( internal_scan_state->footer_buffer != NULL )
+		{
+			memory_free(
+			 internal_scan_state->footer_buffer );
+		}
+		if( internal_scan_state->carry_over_buffer != NULL )
+		{
+			memory_free(
+			 internal_scan_state->carry_over_buffer );
+		}
+		if( internal_scan_state->skip_table != NULL )
+		{
+			if( libsigscan_skip_table_free(
+			     &( internal_scan_state->skip_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free skip table.",
+				 function );
+
+				result = -1;
+			}
 		}
 		if( libcdata_array_free(
 		     &( internal_scan_state->scan_results_array ),
@@ -214,12 +242,22 @@ int libsigscan_scan_state_set_data_offset(
 
 		return( -1 );
 	}
+	/* The carry-over and footer data is only valid for contiguous data
+	 */
+	if( internal_scan_state->data_offset != data_offset )
+	{
+		internal_scan_state->carry_over_data_size    = 0;
+		internal_scan_state->footer_buffer_offset    = 0;
+		internal_scan_state->footer_buffer_data_size = 0;
+	}
 	internal_scan_state->data_offset = data_offset;
 
 	return( 1 );
 }
 
 /* Sets the data size
+ * A data size of 0 represents that the data size is unknown, such as for a pipe
+ * or network stream, in which case the footer signatures are scanned when the scan is stopped
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_scan_state_set_data_size(
@@ -259,6 +297,183 @@ int libsigscan_scan_state_set_data_size(
 	return( 1 );
 }
 
+/* Sets the data origin
+ * The data origin is the offset of the start of the (logical) data, such as
+ * a partition or file system, where the header and footer signatures are relative
+ * to the start and end of the data and the scan results contain the data origin
+ * added to the data offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_set_data_origin(
+     libsigscan_scan_state_t *scan_state,
+     off64_t data_origin,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_set_data_origin";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( data_origin < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data origin value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state->data_origin = data_origin;
+
+	return( 1 );
+}
+
+/* Retrieves the data origin
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_data_origin(
+     libsigscan_scan_state_t *scan_state,
+     off64_t *data_origin,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_data_origin";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( data_origin == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data origin.",
+		 function );
+
+		return( -1 );
+	}
+	*data_origin = internal_scan_state->data_origin;
+
+	return( 1 );
+}
+
+/* Sets the skip block size
+ * The skip block size is the number of bytes (q-gram) used to determine the skip value
+ * of an unbound scan, where 0 represents the block size of the scan trees is used
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_set_skip_block_size(
+     libsigscan_scan_state_t *scan_state,
+     size_t skip_block_size,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_set_skip_block_size";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_block_size > LIBSIGSCAN_SKIP_TABLE_MAXIMUM_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid skip block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state->skip_block_size = skip_block_size;
+
+	return( 1 );
+}
+
+/* Retrieves the skip block size
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_skip_block_size(
+     libsigscan_scan_state_t *scan_state,
+     size_t *skip_block_size,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_skip_block_size";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( skip_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip block size.",
+		 function );
+
+		return( -1 );
+	}
+	*skip_block_size = internal_scan_state->skip_block_size;
+
+	return( 1 );
+}
+
 /* Retrieves the buffer size
  * Returns 1 if successful or -1 on error
  */
@@ -447,11 +662,14 @@ int libsigscan_scan_state_start(
      libsigscan_scan_tree_t *header_scan_tree,
      libsigscan_scan_tree_t *footer_scan_tree,
      libsigscan_scan_tree_t *scan_tree,
+     libsigscan_skip_table_t *skip_table,
      size_t scan_buffer_size,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
 	static char *function                                 = "libsigscan_scan_state_start";
+	uint64_t footer_size                                  = 0;
+	uint64_t header_size                                  = 0;
 	uint64_t range_size                                   = 0;
 	uint64_t range_start                                  = 0;
 	int result                                            = 0;
@@ -481,43 +699,66 @@ int libsigscan_scan_state_start(
 
 		return( -1 );
 	}
-	if( internal_scan_state->buffer != NULL )
+	if( internal_scan_state->header_buffer != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scan state - buffer value already set.",
+		 "%s: invalid scan state - header buffer value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( scan_buffer_size == 0 )
-	 || ( scan_buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( internal_scan_state->footer_buffer != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid scan buffer size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan state - footer buffer value already set.",
 		 function );
 
 		return( -1 );
 	}
-	internal_scan_state->buffer = (uint8_t *) memory_allocate(
-	                                           sizeof( uint8_t ) * scan_buffer_size );
+	if( internal_scan_state->carry_over_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan state - carry-over buffer value already set.",
+		 function );
 
-	if( internal_scan_state->buffer == NULL )
+		return( -1 );
+	}
+	if( internal_scan_state->skip_table != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create scan buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan state - skip table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_buffer_size == 0 )
+	 || ( scan_buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan buffer size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
+	internal_scan_state->header_range_start = 0;
+	internal_scan_state->header_range_end   = 0;
+	internal_scan_state->header_range_size  = 0;
+
 	if( header_scan_tree != NULL )
 	{
 		result = libsigscan_scan_tree_get_spanning_range(
@@ -535,7 +776,7 @@ int libsigscan_scan_state_start(
 			 "%s: unable to retrieve header pattern spanning range.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( result != 0 )
 		{
@@ -555,9 +796,50 @@ int libsigscan_scan_state_start(
 				 internal_scan_state->header_range_end );
 			}
 #endif
+			header_size = internal_scan_state->header_range_size;
+
+			if( ( internal_scan_state->data_size != 0 )
+			 && ( header_size > internal_scan_state->data_size ) )
+			{
+				header_size = internal_scan_state->data_size;
+			}
+			if( ( header_size == 0 )
+			 || ( header_size > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid header size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			/* The header buffer is only used if the header range spans multiple buffers
+			 * and is freed once the header range has been scanned
+			 */
+			internal_scan_state->header_buffer = (uint8_t *) memory_allocate(
+			                                                  sizeof( uint8_t ) * (size_t) header_size );
+
+			if( internal_scan_state->header_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create header buffer.",
+				 function );
+
+				goto on_error;
+			}
+			internal_scan_state->header_buffer_size = (size_t) header_size;
 		}
 		internal_scan_state->active_header_node = header_scan_tree->root_node;
 	}
+	internal_scan_state->footer_range_start = 0;
+	internal_scan_state->footer_range_end   = 0;
+	internal_scan_state->footer_range_size  = 0;
+
 	if( footer_scan_tree != NULL )
 	{
 		result = libsigscan_scan_tree_get_spanning_range(
@@ -575,41 +857,154 @@ int libsigscan_scan_state_start(
 			 "%s: unable to retrieve footer pattern spanning range.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( ( result != 0 )
-		      && ( range_start < internal_scan_state->data_size ) )
+		else if( result != 0 )
 		{
-			internal_scan_state->footer_range_start = internal_scan_state->data_size - range_start;
-			internal_scan_state->footer_range_end   = internal_scan_state->footer_range_start + range_size;
-			internal_scan_state->footer_range_size  = range_size;
+			/* The footer scan tree pattern offsets are relative from the end of the data
+			 * hence the range start is the smallest distance from the end of the data
+			 * and the range start and size combined cover the largest distance
+			 */
+			footer_size = range_start + range_size;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( ( footer_size == 0 )
+			 || ( footer_size > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 			{
-				libcnotify_printf(
-				 "%s: footer signature range: %" PRIi64 " - %" PRIi64 ".\n",
-				 function,
-				 internal_scan_state->footer_range_start,
-				 internal_scan_state->footer_range_end );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid footer size value out of bounds.",
+				 function );
+
+				goto on_error;
 			}
+			/* If the data size is unknown the footer range can only be determined
+			 * when the scan is stopped, until then the last footer size bytes of the data
+			 * are kept in the footer (ring) buffer
+			 */
+			if( internal_scan_state->data_size != 0 )
+			{
+				if( footer_size > internal_scan_state->data_size )
+				{
+					footer_size = internal_scan_state->data_size;
+				}
+				internal_scan_state->footer_range_start = internal_scan_state->data_size - footer_size;
+				internal_scan_state->footer_range_end   = internal_scan_state->data_size;
+				internal_scan_state->footer_range_size  = footer_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: footer signature range: %" PRIi64 " - %" PRIi64 ".\n",
+					 function,
+					 internal_scan_state->footer_range_start,
+					 internal_scan_state->footer_range_end );
+				}
 #endif
+			}
+			internal_scan_state->footer_buffer = (uint8_t *) memory_allocate(
+			                                                  sizeof( uint8_t ) * (size_t) footer_size );
+
+			if( internal_scan_state->footer_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create footer buffer.",
+				 function );
+
+				goto on_error;
+			}
+			internal_scan_state->footer_buffer_size = (size_t) footer_size;
 		}
 		internal_scan_state->active_footer_node = footer_scan_tree->root_node;
 	}
-	if( scan_tree != NULL )
+	internal_scan_state->carry_over_size = 0;
+
+	/* An unbound scan tree without signatures is not scanned
+	 */
+	if( ( scan_tree != NULL )
+	 && ( scan_tree->root_node == NULL ) )
 	{
-		internal_scan_state->active_node = scan_tree->root_node;
+		scan_tree = NULL;
 	}
-	internal_scan_state->data_offset       = 0;
-	internal_scan_state->state             = LIBSIGSCAN_SCAN_STATE_STARTED;
-	internal_scan_state->header_scan_tree  = header_scan_tree;
-	internal_scan_state->footer_scan_tree  = footer_scan_tree;
-	internal_scan_state->scan_tree         = scan_tree;
-	internal_scan_state->buffer_size       = scan_buffer_size;
-	internal_scan_state->buffer_data_size  = 0;
+	if( scan_tree != NULL )
+	{
+		if( scan_tree->skip_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid scan tree - missing skip table.",
+			 function );
+
+			goto on_error;
+		}
+		/* Only the bytes that can contain the start of a pattern that crosses
+		 * the buffer boundary are carried over to the next buffer
+		 */
+		if( scan_tree->skip_table->largest_pattern_size > 1 )
+		{
+			internal_scan_state->carry_over_size = scan_tree->skip_table->largest_pattern_size - 1;
+
+			/* The carry-over buffer is completed with the start of the next buffer
+			 */
+			internal_scan_state->carry_over_buffer = (uint8_t *) memory_allocate(
+			                                                      sizeof( uint8_t ) * ( 2 * internal_scan_state->carry_over_size ) );
+
+			if( internal_scan_state->carry_over_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create carry-over buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		internal_scan_state->active_node = scan_tree->root_node;
+	}
+	internal_scan_state->data_offset          = 0;
+	internal_scan_state->state                = LIBSIGSCAN_SCAN_STATE_STARTED;
+	internal_scan_state->header_scan_tree     = header_scan_tree;
+	internal_scan_state->footer_scan_tree     = footer_scan_tree;
+	internal_scan_state->scan_tree            = scan_tree;
+	internal_scan_state->skip_table           = skip_table;
+	internal_scan_state->buffer_size          = scan_buffer_size;
+	internal_scan_state->carry_over_data_size = 0;
+
+	internal_scan_state->header_buffer_data_size = 0;
+	internal_scan_state->footer_buffer_offset    = 0;
+	internal_scan_state->footer_buffer_data_size = 0;
 
 	return( 1 );
+
+on_error:
+	if( internal_scan_state->footer_buffer != NULL )
+	{
+		memory_free(
+		 internal_scan_state->footer_buffer );
+
+		internal_scan_state->footer_buffer = NULL;
+	}
+	if( internal_scan_state->header_buffer != NULL )
+	{
+		memory_free(
+		 internal_scan_state->header_buffer );
+
+		internal_scan_state->header_buffer = NULL;
+	}
+	internal_scan_state->header_buffer_size = 0;
+	internal_scan_state->footer_buffer_size = 0;
+	internal_scan_state->carry_over_size    = 0;
+
+	return( -1 );
 }
 
 /* Stops the scan state
@@ -621,6 +1016,7 @@ int libsigscan_scan_state_stop(
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
 	static char *function                                 = "libsigscan_scan_state_stop";
+	size64_t data_size                                    = 0;
 
 	if( scan_state == NULL )
 	{
@@ -646,35 +1042,91 @@ int libsigscan_scan_state_stop(
 
 		return( -1 );
 	}
-	if( internal_scan_state->buffer_data_size > 0 )
+	if( libsigscan_scan_state_flush(
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to flush scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->footer_buffer != NULL )
 	{
-		if( libsigscan_internal_scan_state_scan_buffer(
+		data_size = internal_scan_state->data_size;
+
+		/* If the data size is unknown the data offset is the size of the scanned data
+		 */
+		if( data_size == 0 )
+		{
+			data_size = (size64_t) internal_scan_state->data_offset;
+		}
+		/* The footer buffer only contains the end of the data if the data
+		 * was scanned up to the data size
+		 */
+		if( (size64_t) internal_scan_state->data_offset < data_size )
+		{
+			internal_scan_state->footer_buffer_data_size = 0;
+		}
+		if( libsigscan_internal_scan_state_scan_footer_buffer(
 		     internal_scan_state,
-		     internal_scan_state->buffer,
-		     internal_scan_state->buffer_data_size,
-		     0,
+		     data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan footer buffer.",
 			 function );
 
 			return( -1 );
 		}
-		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
-		internal_scan_state->buffer_data_size = 0;
+		memory_free(
+		 internal_scan_state->footer_buffer );
+
+		internal_scan_state->footer_buffer           = NULL;
+		internal_scan_state->footer_buffer_size      = 0;
+		internal_scan_state->footer_buffer_offset    = 0;
+		internal_scan_state->footer_buffer_data_size = 0;
+	}
+	if( internal_scan_state->header_buffer != NULL )
+	{
+		memory_free(
+		 internal_scan_state->header_buffer );
+
+		internal_scan_state->header_buffer = NULL;
 	}
-	if( internal_scan_state->buffer != NULL )
+	if( internal_scan_state->carry_over_buffer != NULL )
 	{
 		memory_free(
-		 internal_scan_state->buffer );
+		 internal_scan_state->carry_over_buffer );
+
+		internal_scan_state->carry_over_buffer = NULL;
+	}
+	if( internal_scan_state->skip_table != NULL )
+	{
+		if( libsigscan_skip_table_free(
+		     &( internal_scan_state->skip_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free skip table.",
+			 function );
 
-		internal_scan_state->buffer = NULL;
+			return( -1 );
+		}
 	}
 	internal_scan_state->buffer_size        = 0;
+	internal_scan_state->header_buffer_size = 0;
+	internal_scan_state->carry_over_size    = 0;
 	internal_scan_state->state              = LIBSIGSCAN_SCAN_STATE_STOPPED;
 	internal_scan_state->header_scan_tree   = NULL;
 	internal_scan_state->active_header_node = NULL;
@@ -687,6 +1139,8 @@ int libsigscan_scan_state_stop(
 }
 
 /* Flushes the scan state
+ * Scans the data that is kept for signatures that cross the buffer boundary,
+ * which is needed before the data offset is changed
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_scan_state_flush(
@@ -695,6 +1149,7 @@ int libsigscan_scan_state_flush(
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
 	static char *function                                 = "libsigscan_scan_state_flush";
+	size_t buffer_offset                                  = 0;
 
 	if( scan_state == NULL )
 	{
@@ -720,26 +1175,53 @@ int libsigscan_scan_state_flush(
 
 		return( -1 );
 	}
-	if( internal_scan_state->buffer_data_size > 0 )
+	/* The remainder of the header range is scanned if the data does not continue
+	 */
+	if( ( internal_scan_state->header_buffer != NULL )
+	 && ( internal_scan_state->header_buffer_data_size > 0 ) )
 	{
-		if( libsigscan_internal_scan_state_scan_buffer(
+		if( libsigscan_internal_scan_state_scan_header_buffer(
 		     internal_scan_state,
-		     internal_scan_state->buffer,
-		     internal_scan_state->buffer_data_size,
-		     0,
+		     (size64_t) internal_scan_state->header_buffer_data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan header buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The patterns that start in the carry-over data can only be matched
+	 * to the end of the carry-over data if the data does not continue
+	 */
+	if( internal_scan_state->carry_over_data_size > 0 )
+	{
+		buffer_offset = 0;
+
+		if( libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+		     internal_scan_state,
+		     internal_scan_state->scan_tree,
+		     internal_scan_state->data_offset - (off64_t) internal_scan_state->carry_over_data_size,
+		     internal_scan_state->carry_over_buffer,
+		     internal_scan_state->carry_over_data_size,
+		     &buffer_offset,
+		     internal_scan_state->carry_over_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan carry-over buffer by unbound scan tree.",
 			 function );
 
 			return( -1 );
 		}
-		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
-		internal_scan_state->buffer_data_size = 0;
+		internal_scan_state->carry_over_data_size = 0;
 	}
 	return( 1 );
 }
@@ -762,13 +1244,20 @@ int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
 	libsigscan_scan_result_t *scan_result = NULL;
 	libsigscan_signature_t *signature     = NULL;
 	static char *function                 = "libsigscan_internal_scan_state_scan_buffer_by_scan_tree";
-	size_t buffer_end_offset              = 0;
-	size_t skip_value                     = 0;
-	size_t smallest_pattern_size          = 0;
 	uint8_t scan_object_type              = 0;
 	int entry_index                       = 0;
 	int result                            = 0;
 
+	int (*scan_buffer_function)(
+	       libsigscan_scan_tree_node_t *scan_tree_node,
+	       off64_t data_offset,
+	       size64_t data_size,
+	       const uint8_t *buffer,
+	       size_t buffer_size,
+	       size_t buffer_offset,
+	       libsigscan_scan_object_t **scan_object,
+	       libcerror_error_t **error ) = NULL;
+
 	if( internal_scan_state == NULL )
 	{
 		libcerror_error_set(
@@ -791,6 +1280,29 @@ int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
 
 		return( -1 );
 	}
+	/* The scan function is determined once per scan tree so that the pattern
+	 * offsets mode is not tested for every scan tree node that is scanned
+	 */
+	switch( scan_tree->pattern_offsets_mode )
+	{
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
+			scan_buffer_function = &libsigscan_scan_tree_node_scan_buffer_bound_to_start;
+			break;
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
+			scan_buffer_function = &libsigscan_scan_tree_node_scan_buffer_bound_to_end;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid scan tree - unsupported pattern offsets mode.",
+			 function );
+
+			return( -1 );
+	}
 	if( active_node == NULL )
 	{
 		libcerror_error_set(
@@ -852,173 +1364,110 @@ int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
 	{
 		return( 0 );
 	}
-	while( buffer_offset < buffer_size )
+	result = scan_buffer_function(
+	          *active_node,
+	          data_offset,
+	          data_size,
+	          buffer,
+	          buffer_size,
+	          buffer_offset,
+	          &scan_object,
+	          error );
+
+	if( result == -1 )
 	{
-		result = libsigscan_scan_tree_node_scan_buffer(
-		          *active_node,
-		          scan_tree->pattern_offsets_mode,
-		          data_offset,
-		          data_size,
-		          buffer,
-		          buffer_size,
-		          buffer_offset,
-		          &scan_object,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to scan buffer.",
+		 function );
 
-		if( result == -1 )
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libsigscan_scan_object_get_type(
+		     scan_object,
+		     &scan_object_type,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
+			 "%s: unable to retrieve scan object type.",
 			 function );
 
 			goto on_error;
 		}
-		else if( result != 0 )
+		if( scan_object_type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
 		{
-			if( libsigscan_scan_object_get_type(
-			     scan_object,
-			     &scan_object_type,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve scan object type.",
-				 function );
-
-				goto on_error;
-			}
-			if( scan_object_type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported scan object type.",
-				 function );
-
-				goto on_error;
-			}
-			if( libsigscan_scan_object_get_value(
-			     scan_object,
-			     (intptr_t **) &signature,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve scan object value.",
-				 function );
-
-				goto on_error;
-			}
-			if( signature == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing signature.",
-				 function );
-
-				goto on_error;
-			}
-			if( libsigscan_scan_result_initialize(
-			     &scan_result,
-			     data_offset,
-			     signature,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create scan result.",
-				 function );
-
-				goto on_error;
-			}
-			if( libcdata_array_append_entry(
-			     internal_scan_state->scan_results_array,
-			     &entry_index,
-			     (intptr_t *) scan_result,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append scan result.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported scan object type.",
+			 function );
 
-				goto on_error;
-			}
-			scan_result = NULL;
-			skip_value  = signature->pattern_size;
+			goto on_error;
 		}
-		if( result == 0 )
+		if( libsigscan_scan_object_get_value(
+		     scan_object,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
 		{
-			if( libsigscan_skip_table_get_smallest_pattern_size(
-			     scan_tree->skip_table,
-			     &smallest_pattern_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve smallest pattern size.",
-				 function );
-
-				goto on_error;
-			}
-			if( smallest_pattern_size > buffer_size )
-			{
-				smallest_pattern_size = buffer_size;
-			}
-			buffer_end_offset = buffer_offset + smallest_pattern_size - 1;
-
-			if( buffer_end_offset >= buffer_size )
-			{
-				buffer_end_offset = buffer_size - 1;
-			}
-			skip_value = 0;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan object value.",
+			 function );
 
-			do
-			{
-				if( libsigscan_skip_table_get_skip_value(
-				     scan_tree->skip_table,
-				     buffer[ buffer_end_offset ],
-				     &skip_value,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve skip value.",
-					 function );
+			goto on_error;
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
 
-					goto on_error;
-				}
-				buffer_end_offset -= 1;
-			}
-			while( ( buffer_end_offset > buffer_offset )
-			    && ( skip_value == 0 ) );
+			goto on_error;
 		}
-		if( scan_tree->pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+		if( libsigscan_scan_result_initialize(
+		     &scan_result,
+		     internal_scan_state->data_origin + data_offset,
+		     signature,
+		     error ) != 1 )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan result.",
+			 function );
+
+			goto on_error;
 		}
-		*active_node = scan_tree->root_node;
+		if( libcdata_array_append_entry(
+		     internal_scan_state->scan_results_array,
+		     &entry_index,
+		     (intptr_t *) scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan result.",
+			 function );
 
-		buffer_offset += skip_value;
-		data_offset   += skip_value;
+			goto on_error;
+		}
+		scan_result = NULL;
 	}
 	return( 1 );
 
@@ -1032,8 +1481,1195 @@ on_error:
 	return( -1 );
 }
 
-/* Scans the buffer and updates the scan state
- * Returns 1 if successful, 0 if data size has been reached or -1 on error
+/* Scans the buffer using a specific BNDM table and updates the scan state
+ * The data offset corresponds with the buffer offset
+ * Only patterns that start before the scan end offset are matched, the patterns
+ * that start at or after the scan end offset can extend beyond the buffer
+ * On return the buffer offset contains the offset of the next pattern that can match
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer_by_bndm_table(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_bndm_table_t *bndm_table,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     size_t scan_end_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_internal_scan_state_scan_buffer_by_bndm_table";
+	size_t match_offset                   = 0;
+	size_t scan_offset                    = 0;
+	int entry_index                       = 0;
+	int result                            = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( bndm_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid BNDM table.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_end_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	scan_offset = *buffer_offset;
+
+	/* The data offset corresponds with the buffer offset
+	 */
+	data_offset -= (off64_t) scan_offset;
+
+	while( scan_offset < scan_end_offset )
+	{
+		result = libsigscan_bndm_table_scan_buffer(
+		          bndm_table,
+		          buffer,
+		          buffer_size,
+		          scan_offset,
+		          &match_offset,
+		          &signature,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			goto on_error;
+		}
+		/* A pattern that starts at or after the scan end offset is matched
+		 * again when more data is available, since a larger pattern that
+		 * starts at the same offset can extend beyond the buffer
+		 */
+		else if( ( result == 0 )
+		      || ( match_offset >= scan_end_offset ) )
+		{
+			break;
+		}
+		if( libsigscan_scan_result_initialize(
+		     &scan_result,
+		     internal_scan_state->data_origin + data_offset + (off64_t) match_offset,
+		     signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan result.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     internal_scan_state->scan_results_array,
+		     &entry_index,
+		     (intptr_t *) scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan result.",
+			 function );
+
+			goto on_error;
+		}
+		scan_result = NULL;
+
+		/* As with the scan tree scanning continues after the matching pattern
+		 */
+		scan_offset = match_offset + signature->pattern_size;
+	}
+	if( scan_offset < scan_end_offset )
+	{
+		scan_offset = scan_end_offset;
+	}
+	*buffer_offset = scan_offset;
+
+	return( 1 );
+
+on_error:
+	if( scan_result != NULL )
+	{
+		libsigscan_internal_scan_result_free(
+		 (libsigscan_internal_scan_result_t **) &scan_result,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the buffer using the unbound scan tree and updates the scan state
+ * The data offset corresponds with the buffer offset
+ * Only patterns that start before the scan end offset are matched, the patterns
+ * that start at or after the scan end offset can extend beyond the buffer
+ * On return the buffer offset contains the offset of the next pattern that can match
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     size_t scan_end_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t *scan_object = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	libsigscan_skip_table_t *skip_table   = NULL;
+	static char *function                 = "libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree";
+	size_t block_size                     = 0;
+	size_t byte_value_offset              = 0;
+	size_t scan_offset                    = 0;
+	size_t skip_value                     = 0;
+	size_t smallest_pattern_size          = 0;
+	uint8_t scan_object_type              = 0;
+	int entry_index                       = 0;
+	int result                            = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan tree - unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->root_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree - missing root node.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_end_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A small set of short patterns is scanned bit-parallel (BNDM)
+	 * instead of by the scan tree and skip table
+	 */
+	if( scan_tree->bndm_table != NULL )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer_by_bndm_table(
+		     internal_scan_state,
+		     scan_tree->bndm_table,
+		     data_offset,
+		     buffer,
+		     buffer_size,
+		     buffer_offset,
+		     scan_end_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer by BNDM table.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The skip table of the scan state overrides the skip table of the scan tree
+	 */
+	skip_table = internal_scan_state->skip_table;
+
+	if( skip_table == NULL )
+	{
+		skip_table = scan_tree->skip_table;
+	}
+	if( libsigscan_skip_table_get_smallest_pattern_size(
+	     skip_table,
+	     &smallest_pattern_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve smallest pattern size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_skip_table_get_byte_value_offset(
+	     skip_table,
+	     &byte_value_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte value offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_skip_table_get_block_size(
+	     skip_table,
+	     &block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( smallest_pattern_size == 0 )
+	 || ( byte_value_offset >= smallest_pattern_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid skip table - byte value offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	scan_offset = *buffer_offset;
+
+	/* The data offset corresponds with the buffer offset
+	 */
+	data_offset -= (off64_t) scan_offset;
+
+	while( scan_offset < scan_end_offset )
+	{
+		/* A pattern cannot start in the last bytes of the buffer that are
+		 * smaller than the smallest pattern
+		 */
+		if( smallest_pattern_size > ( buffer_size - scan_offset ) )
+		{
+			break;
+		}
+		result = libsigscan_scan_tree_node_scan_buffer_unbound(
+		          scan_tree->root_node,
+		          data_offset + (off64_t) scan_offset,
+		          (size64_t) data_offset + buffer_size,
+		          buffer,
+		          buffer_size,
+		          scan_offset,
+		          &scan_object,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libsigscan_scan_object_get_type(
+			     scan_object,
+			     &scan_object_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve scan object type.",
+				 function );
+
+				goto on_error;
+			}
+			if( scan_object_type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported scan object type.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_scan_object_get_value(
+			     scan_object,
+			     (intptr_t **) &signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve scan object value.",
+				 function );
+
+				goto on_error;
+			}
+			if( signature == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing signature.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_scan_result_initialize(
+			     &scan_result,
+			     internal_scan_state->data_origin + data_offset + (off64_t) scan_offset,
+			     signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create scan result.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_array_append_entry(
+			     internal_scan_state->scan_results_array,
+			     &entry_index,
+			     (intptr_t *) scan_result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append scan result.",
+				 function );
+
+				goto on_error;
+			}
+			scan_result = NULL;
+
+			/* Scanning continues after the matching pattern
+			 */
+			skip_value = signature->pattern_size;
+		}
+		else if( block_size > 1 )
+		{
+			/* The block (q-gram) ends at the byte value offset
+			 */
+			if( libsigscan_skip_table_get_block_skip_value(
+			     skip_table,
+			     &( buffer[ scan_offset + byte_value_offset + 1 - block_size ] ),
+			     &skip_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block skip value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libsigscan_skip_table_get_skip_value(
+			     skip_table,
+			     buffer[ scan_offset + byte_value_offset ],
+			     &skip_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve skip value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		scan_offset += skip_value;
+	}
+	if( scan_offset < scan_end_offset )
+	{
+		scan_offset = scan_end_offset;
+	}
+	*buffer_offset = scan_offset;
+
+	return( 1 );
+
+on_error:
+	if( scan_result != NULL )
+	{
+		libsigscan_internal_scan_result_free(
+		 (libsigscan_internal_scan_result_t **) &scan_result,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the header buffer and updates the scan state
+ * The header buffer is freed once it has been scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_header_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_scan_header_buffer";
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->header_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing header buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->header_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing header scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scan_state->header_buffer_data_size > 0 )
+	 && ( data_size > 0 ) )
+	{
+		/* The header scan tree pattern offsets are relative to the start of the data
+		 */
+		if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
+		     internal_scan_state,
+		     internal_scan_state->header_scan_tree,
+		     &( internal_scan_state->active_header_node ),
+		     0,
+		     data_size,
+		     internal_scan_state->header_buffer,
+		     internal_scan_state->header_buffer_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan header buffer by header scan tree.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	memory_free(
+	 internal_scan_state->header_buffer );
+
+	internal_scan_state->header_buffer           = NULL;
+	internal_scan_state->header_buffer_size      = 0;
+	internal_scan_state->header_buffer_data_size = 0;
+
+	return( 1 );
+}
+
+/* Scans the buffer for unbounded signatures and updates the scan state
+ * The buffer is scanned in place, only the last bytes that can contain the start
+ * of a pattern that crosses the buffer boundary are copied to the carry-over buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_unbound_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error )
+{
+	static char *function       = "libsigscan_internal_scan_state_scan_unbound_buffer";
+	size_t carry_over_data_size = 0;
+	size_t carry_over_offset    = 0;
+	size_t read_size            = 0;
+	size_t scan_end_offset      = 0;
+	size_t scan_offset          = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scan_state->carry_over_size > 0 )
+	 && ( internal_scan_state->carry_over_buffer == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing carry-over buffer.",
+		 function );
+
+		return( -1 );
+	}
+	scan_offset = buffer_offset;
+
+	if( internal_scan_state->carry_over_data_size > 0 )
+	{
+		/* The carry-over data is completed with the start of the buffer, which
+		 * is sufficient to match every pattern that starts in the carry-over data
+		 */
+		carry_over_data_size = internal_scan_state->carry_over_data_size;
+
+		read_size = buffer_size - buffer_offset;
+
+		if( read_size > internal_scan_state->carry_over_size )
+		{
+			read_size = internal_scan_state->carry_over_size;
+		}
+		if( memory_copy(
+		     &( internal_scan_state->carry_over_buffer[ carry_over_data_size ] ),
+		     &( buffer[ buffer_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to carry-over buffer.",
+			 function );
+
+			return( -1 );
+		}
+		read_size += carry_over_data_size;
+
+		if( read_size > internal_scan_state->carry_over_size )
+		{
+			scan_end_offset = read_size - internal_scan_state->carry_over_size;
+		}
+		if( libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+		     internal_scan_state,
+		     internal_scan_state->scan_tree,
+		     internal_scan_state->data_offset - (off64_t) carry_over_data_size,
+		     internal_scan_state->carry_over_buffer,
+		     read_size,
+		     &carry_over_offset,
+		     scan_end_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan carry-over buffer by unbound scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		if( carry_over_offset < carry_over_data_size )
+		{
+			/* The buffer is too small to match the patterns that start
+			 * in the carry-over data, hence the data is carried over again
+			 */
+			internal_scan_state->carry_over_data_size = read_size - carry_over_offset;
+
+			for( scan_offset = 0;
+			     scan_offset < internal_scan_state->carry_over_data_size;
+			     scan_offset++ )
+			{
+				internal_scan_state->carry_over_buffer[ scan_offset ] = internal_scan_state->carry_over_buffer[ carry_over_offset++ ];
+			}
+			return( 1 );
+		}
+		internal_scan_state->carry_over_data_size = 0;
+
+		scan_offset += carry_over_offset - carry_over_data_size;
+	}
+	/* The last carry-over size bytes of the buffer are scanned
+	 * together with the start of the next buffer
+	 */
+	scan_end_offset = buffer_offset;
+
+	if( ( buffer_size - buffer_offset ) > internal_scan_state->carry_over_size )
+	{
+		scan_end_offset = buffer_size - internal_scan_state->carry_over_size;
+	}
+	if( scan_offset < scan_end_offset )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+		     internal_scan_state,
+		     internal_scan_state->scan_tree,
+		     internal_scan_state->data_offset + (off64_t) ( scan_offset - buffer_offset ),
+		     buffer,
+		     buffer_size,
+		     &scan_offset,
+		     scan_end_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer by unbound scan tree.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( scan_offset < buffer_size )
+	{
+		if( memory_copy(
+		     internal_scan_state->carry_over_buffer,
+		     &( buffer[ scan_offset ] ),
+		     buffer_size - scan_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to carry-over buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_state->carry_over_data_size = buffer_size - scan_offset;
+	}
+	return( 1 );
+}
+
+/* Appends the data in the buffer to the footer (ring) buffer
+ * Only the last footer buffer size bytes of the data are kept
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_append_footer_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_append_footer_buffer";
+	size_t copy_size      = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->footer_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing footer buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scan_state->footer_buffer_size == 0 )
+	 || ( internal_scan_state->footer_buffer_offset >= internal_scan_state->footer_buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan state - footer buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the last footer buffer size bytes of the buffer can end up in the footer buffer
+	 */
+	if( buffer_size > internal_scan_state->footer_buffer_size )
+	{
+		buffer      += buffer_size - internal_scan_state->footer_buffer_size;
+		buffer_size  = internal_scan_state->footer_buffer_size;
+	}
+	while( buffer_size > 0 )
+	{
+		copy_size = internal_scan_state->footer_buffer_size - internal_scan_state->footer_buffer_offset;
+
+		if( copy_size > buffer_size )
+		{
+			copy_size = buffer_size;
+		}
+		if( memory_copy(
+		     &( internal_scan_state->footer_buffer[ internal_scan_state->footer_buffer_offset ] ),
+		     buffer,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to footer buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_state->footer_buffer_offset += copy_size;
+
+		if( internal_scan_state->footer_buffer_offset >= internal_scan_state->footer_buffer_size )
+		{
+			internal_scan_state->footer_buffer_offset = 0;
+		}
+		if( internal_scan_state->footer_buffer_data_size < internal_scan_state->footer_buffer_size )
+		{
+			internal_scan_state->footer_buffer_data_size += copy_size;
+		}
+		buffer      += copy_size;
+		buffer_size -= copy_size;
+	}
+	return( 1 );
+}
+
+/* Scans the footer (ring) buffer using the footer scan tree and updates the scan state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_footer_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *footer_data    = NULL;
+	static char *function   = "libsigscan_internal_scan_state_scan_footer_buffer";
+	size_t first_size       = 0;
+	size_t footer_data_size = 0;
+	uint64_t range_size     = 0;
+	uint64_t range_start    = 0;
+	int result              = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->footer_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing footer buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->footer_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan state - missing footer scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_scan_tree_get_spanning_range(
+	          internal_scan_state->footer_scan_tree,
+	          &range_start,
+	          &range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve footer pattern spanning range.",
+		 function );
+
+		goto on_error;
+	}
+	footer_data_size = internal_scan_state->footer_buffer_data_size;
+
+	/* The footer scan tree pattern offsets are relative to range start bytes before
+	 * the end of the data, the footer buffer must contain all the data up to this offset
+	 */
+	if( ( result == 0 )
+	 || ( range_start == 0 )
+	 || ( range_start > (uint64_t) footer_data_size )
+	 || ( range_start > data_size )
+	 || ( (size64_t) footer_data_size > data_size ) )
+	{
+		return( 1 );
+	}
+	footer_data = (uint8_t *) memory_allocate(
+	               sizeof( uint8_t ) * footer_data_size );
+
+	if( footer_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create footer data.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the footer buffer is full the oldest data starts at the footer buffer offset
+	 * otherwise at the start of the footer buffer
+	 */
+	first_size = footer_data_size;
+
+	if( footer_data_size == internal_scan_state->footer_buffer_size )
+	{
+		first_size -= internal_scan_state->footer_buffer_offset;
+	}
+	if( memory_copy(
+	     footer_data,
+	     &( internal_scan_state->footer_buffer[ footer_data_size - first_size ] ),
+	     first_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy footer buffer to footer data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( footer_data[ first_size ] ),
+	     internal_scan_state->footer_buffer,
+	     footer_data_size - first_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy footer buffer to footer data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
+	     internal_scan_state,
+	     internal_scan_state->footer_scan_tree,
+	     &( internal_scan_state->active_footer_node ),
+	     (off64_t) ( data_size - range_start ),
+	     data_size,
+	     footer_data,
+	     footer_data_size,
+	     footer_data_size - (size_t) range_start,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan footer data by footer scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 footer_data );
+
+	return( 1 );
+
+on_error:
+	if( footer_data != NULL )
+	{
+		memory_free(
+		 footer_data );
+	}
+	return( -1 );
+}
+
+/* Scans the buffer and updates the scan state
+ * Returns 1 if successful, 0 if data size has been reached or -1 on error
  */
 int libsigscan_internal_scan_state_scan_buffer(
      libsigscan_internal_scan_state_t *internal_scan_state,
@@ -1043,7 +2679,7 @@ int libsigscan_internal_scan_state_scan_buffer(
      libcerror_error_t **error )
 {
 	static char *function      = "libsigscan_internal_scan_state_scan_buffer";
-	off64_t range_end_offset   = 0;
+	size64_t data_size         = 0;
 	off64_t range_start_offset = 0;
 	size_t range_offset        = 0;
 	size_t range_size          = 0;
@@ -1093,65 +2729,80 @@ int libsigscan_internal_scan_state_scan_buffer(
 
 		return( -1 );
 	}
-	if( ( internal_scan_state->data_size == 0 )
-	 || ( (size64_t) internal_scan_state->data_offset >= internal_scan_state->data_size ) )
+	if( ( internal_scan_state->data_size != 0 )
+	 && ( (size64_t) internal_scan_state->data_offset >= internal_scan_state->data_size ) )
 	{
 		return( 0 );
 	}
-	if( internal_scan_state->header_range_size > 0 )
+	data_size = internal_scan_state->data_size;
+
+	if( data_size == 0 )
+	{
+		/* The data size is unknown hence only the data up to the end of the buffer is known
+		 */
+		data_size = (size64_t) internal_scan_state->data_offset + ( buffer_size - buffer_offset );
+	}
+	if( internal_scan_state->footer_buffer != NULL )
 	{
+		/* Only the data in the footer range is kept if the data size is known
+		 */
+		range_offset       = buffer_offset;
 		range_start_offset = internal_scan_state->data_offset;
-		range_end_offset   = internal_scan_state->data_offset + buffer_size;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: header range: %" PRIi64 " - %" PRIi64 ".\n",
-			 function,
-			 internal_scan_state->header_range_start,
-			 internal_scan_state->header_range_end );
-		}
-#endif
-		if( ( ( range_start_offset >= (off64_t) internal_scan_state->header_range_start )
-		  && ( range_start_offset < (off64_t) internal_scan_state->header_range_end ) )
-		 ||  ( ( range_end_offset >= (off64_t) internal_scan_state->header_range_start )
-		  && ( range_end_offset < (off64_t) internal_scan_state->header_range_end ) ) )
+		if( range_start_offset < (off64_t) internal_scan_state->footer_range_start )
 		{
-			range_offset = buffer_offset;
-			range_size   = buffer_size;
+			range_start_offset = (off64_t) internal_scan_state->footer_range_start;
 
-			if( range_start_offset < (off64_t) internal_scan_state->header_range_start )
-			{
-				range_offset       = (size_t) ( internal_scan_state->header_range_start - range_start_offset );
-				range_start_offset = (off64_t) internal_scan_state->header_range_start;
-			}
-			if( range_end_offset > (off64_t) internal_scan_state->header_range_end )
+			if( ( range_start_offset - internal_scan_state->data_offset ) < (off64_t) ( buffer_size - buffer_offset ) )
 			{
-				range_size      -= (size_t) ( range_end_offset - internal_scan_state->header_range_end );
-				range_end_offset = (off64_t) internal_scan_state->header_range_end;
+				range_offset += (size_t) ( range_start_offset - internal_scan_state->data_offset );
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			else
 			{
-				libcnotify_printf(
-				 "%s: scan range: %" PRIi64 " - %" PRIi64 ".\n",
-				 function,
-				 range_start_offset,
-				 range_end_offset );
+				range_offset = buffer_size;
 			}
-#endif
-			if( range_offset < range_size )
+		}
+		if( libsigscan_internal_scan_state_append_footer_buffer(
+		     internal_scan_state,
+		     &( buffer[ range_offset ] ),
+		     buffer_size - range_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append buffer to footer buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_scan_state->header_buffer != NULL )
+	 && ( internal_scan_state->data_offset <= (off64_t) internal_scan_state->header_buffer_data_size ) )
+	{
+		/* The header range starts at offset 0
+		 */
+		range_offset = (size_t) ( internal_scan_state->header_buffer_data_size - internal_scan_state->data_offset );
+
+		if( range_offset < ( buffer_size - buffer_offset ) )
+		{
+			range_offset += buffer_offset;
+
+			if( ( internal_scan_state->header_buffer_data_size == 0 )
+			 && ( ( buffer_size - buffer_offset ) >= internal_scan_state->header_buffer_size ) )
 			{
+				/* The header range is contained in the buffer and is scanned in place
+				 */
 				if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
 				     internal_scan_state,
 				     internal_scan_state->header_scan_tree,
 				     &( internal_scan_state->active_header_node ),
-				     range_start_offset,
-				     internal_scan_state->data_size,
+				     0,
+				     data_size,
 				     buffer,
-				     range_size,
-				     range_offset,
+				     buffer_offset + internal_scan_state->header_buffer_size,
+				     buffer_offset,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -1163,80 +2814,76 @@ int libsigscan_internal_scan_state_scan_buffer(
 
 					return( -1 );
 				}
-			}
-		}
-	}
-	if( internal_scan_state->footer_range_size > 0 )
-	{
-		range_start_offset = internal_scan_state->data_offset;
-		range_end_offset   = internal_scan_state->data_offset + buffer_size;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: footer range: %" PRIi64 " - %" PRIi64 ".\n",
-			 function,
-			 internal_scan_state->footer_range_start,
-			 internal_scan_state->footer_range_end );
-		}
-#endif
-		if( ( ( range_start_offset >= (off64_t) internal_scan_state->footer_range_start )
-		  && ( range_start_offset < (off64_t) internal_scan_state->footer_range_end ) )
-		 ||  ( ( range_end_offset >= (off64_t) internal_scan_state->footer_range_start )
-		  && ( range_end_offset < (off64_t) internal_scan_state->footer_range_end ) ) )
-		{
-			range_offset = buffer_offset;
-			range_size   = buffer_size;
+				memory_free(
+				 internal_scan_state->header_buffer );
 
-			if( range_start_offset < (off64_t) internal_scan_state->footer_range_start )
-			{
-				range_offset       = (size_t) ( internal_scan_state->footer_range_start - range_start_offset );
-				range_start_offset = (off64_t) internal_scan_state->footer_range_start;
-			}
-			if( range_end_offset > (off64_t) internal_scan_state->footer_range_end )
-			{
-				range_size      -= (size_t) ( range_end_offset - internal_scan_state->footer_range_end );
-				range_end_offset = (off64_t) internal_scan_state->footer_range_end;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: scan range: %" PRIi64 " - %" PRIi64 ".\n",
-				 function,
-				 range_start_offset,
-				 range_end_offset );
+				internal_scan_state->header_buffer      = NULL;
+				internal_scan_state->header_buffer_size = 0;
 			}
-#endif
-			if( range_offset < range_size )
+			else
 			{
-				if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
-				     internal_scan_state,
-				     internal_scan_state->footer_scan_tree,
-				     &( internal_scan_state->active_footer_node ),
-				     range_start_offset,
-				     internal_scan_state->data_size,
-				     buffer,
-				     range_size,
-				     range_offset,
-				     error ) != 1 )
+				range_size = internal_scan_state->header_buffer_size - internal_scan_state->header_buffer_data_size;
+
+				if( range_size > ( buffer_size - range_offset ) )
+				{
+					range_size = buffer_size - range_offset;
+				}
+				if( memory_copy(
+				     &( internal_scan_state->header_buffer[ internal_scan_state->header_buffer_data_size ] ),
+				     &( buffer[ range_offset ] ),
+				     range_size ) == NULL )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to scan buffer by footer scan tree.",
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy buffer to header buffer.",
 					 function );
 
 					return( -1 );
 				}
+				internal_scan_state->header_buffer_data_size += range_size;
+
+				if( internal_scan_state->header_buffer_data_size == internal_scan_state->header_buffer_size )
+				{
+					if( libsigscan_internal_scan_state_scan_header_buffer(
+					     internal_scan_state,
+					     data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to scan header buffer.",
+						 function );
+
+						return( -1 );
+					}
+				}
 			}
 		}
 	}
-/* TODO handle unbound */
-	return( 1 );
+	if( internal_scan_state->scan_tree != NULL )
+	{
+		if( libsigscan_internal_scan_state_scan_unbound_buffer(
+		     internal_scan_state,
+		     buffer,
+		     buffer_size,
+		     buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan unbound buffer.",
+			 function );
 
+			return( -1 );
+		}
+	}
+	return( 1 );
 }
 
 /* Scans the buffer and updates the scan state
@@ -1250,9 +2897,6 @@ int libsigscan_scan_state_scan_buffer(
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
 	static char *function                                 = "libsigscan_scan_state_scan_buffer";
-	size_t buffer_offset                                  = 0;
-	size_t read_size                                      = 0;
-	size_t scan_size                                      = 0;
 
 	if( scan_state == NULL )
 	{
@@ -1300,108 +2944,42 @@ int libsigscan_scan_state_scan_buffer(
 
 		return( -1 );
 	}
-	if( ( internal_scan_state->data_size == 0 )
-	 || ( (size64_t) internal_scan_state->data_offset >= internal_scan_state->data_size ) )
-	{
-		return( 0 );
-	}
-	if( ( (size64_t) buffer_size > internal_scan_state->data_size )
-	 || ( (size64_t) internal_scan_state->data_offset > ( internal_scan_state->data_size - buffer_size ) ) )
-	{
-		buffer_size = (size_t) ( internal_scan_state->data_size - internal_scan_state->data_offset );
-	}
-	scan_size = buffer_size;
-
-	if( ( internal_scan_state->buffer_data_size > 0 )
-	 && ( internal_scan_state->buffer_data_size < internal_scan_state->buffer_size ) )
+	if( internal_scan_state->data_size != 0 )
 	{
-		read_size = internal_scan_state->buffer_size - internal_scan_state->buffer_data_size;
-
-		if( read_size > scan_size )
+		if( (size64_t) internal_scan_state->data_offset >= internal_scan_state->data_size )
 		{
-			read_size = scan_size;
+			return( 0 );
 		}
-		if( memory_copy(
-		     &( internal_scan_state->buffer[ internal_scan_state->buffer_data_size ] ),
-		     buffer,
-		     read_size ) == NULL )
+		if( ( (size64_t) buffer_size > internal_scan_state->data_size )
+		 || ( (size64_t) internal_scan_state->data_offset > ( internal_scan_state->data_size - buffer_size ) ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy buffer to scan buffer.",
-			 function );
-
-			return( -1 );
+			buffer_size = (size_t) ( internal_scan_state->data_size - internal_scan_state->data_offset );
 		}
-		internal_scan_state->buffer_data_size += read_size;
-		buffer_offset                         += read_size;
 	}
-	if( internal_scan_state->buffer_data_size == internal_scan_state->buffer_size )
+	if( buffer_size == 0 )
 	{
-		if( libsigscan_internal_scan_state_scan_buffer(
-		     internal_scan_state,
-		     internal_scan_state->buffer,
-		     internal_scan_state->buffer_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
-			 function );
-
-			return( -1 );
-		}
-		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
-		internal_scan_state->buffer_data_size = 0;
+		return( 1 );
 	}
-	if( scan_size >= internal_scan_state->buffer_size )
+	/* The buffer is scanned in place regardless of its size
+	 */
+	if( libsigscan_internal_scan_state_scan_buffer(
+	     internal_scan_state,
+	     buffer,
+	     buffer_size,
+	     0,
+	     error ) != 1 )
 	{
-		read_size  = ( scan_size / internal_scan_state->buffer_size );
-		read_size *= internal_scan_state->buffer_size;
-
-		if( libsigscan_internal_scan_state_scan_buffer(
-		     internal_scan_state,
-		     buffer,
-		     buffer_offset + read_size,
-		     buffer_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to scan buffer.",
+		 function );
 
-			return( -1 );
-		}
-		internal_scan_state->data_offset += read_size;
-		buffer_offset                    += read_size;
-		scan_size                        -= read_size;
+		return( -1 );
 	}
-	if( scan_size > 0 )
-	{
-		if( memory_copy(
-		     internal_scan_state->buffer,
-		     &( buffer[ buffer_offset ] ),
-		     scan_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy buffer to scan buffer.",
-			 function );
+	internal_scan_state->data_offset += buffer_size;
 
-			return( -1 );
-		}
-		internal_scan_state->buffer_data_size = scan_size;
-	}
 	return( 1 );
 }
 
@@ -25,10 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_bndm_table.h"
 #include "libsigscan_extern.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_scan_tree.h"
+#include "libsigscan_skip_table.h"
 #include "libsigscan_types.h"
 
 #if defined( __cplusplus )
@@ -51,6 +53,11 @@ struct libsigscan_internal_scan_state
 	 */
 	size64_t data_size;
 
+	/* The data origin
+	 * This value is added to the data offset of the scan results
+	 */
+	off64_t data_origin;
+
 	/* The header (offset relative from start) scan tree
 	 */
 	libsigscan_scan_tree_t *header_scan_tree;
@@ -71,6 +78,19 @@ struct libsigscan_internal_scan_state
 	 */
 	uint64_t header_range_size;
 
+	/* The header buffer
+	 * This buffer contains the header range data when it spans multiple buffers
+	 */
+	uint8_t *header_buffer;
+
+	/* The header buffer size
+	 */
+	size_t header_buffer_size;
+
+	/* The header buffer data size
+	 */
+	size_t header_buffer_data_size;
+
 	/* The footer (offset relative from start) scan tree
 	 */
 	libsigscan_scan_tree_t *footer_scan_tree;
@@ -91,6 +111,23 @@ struct libsigscan_internal_scan_state
 	 */
 	uint64_t footer_range_size;
 
+	/* The footer (ring) buffer
+	 * This buffer contains the last bytes of the data when the data size is unknown
+	 */
+	uint8_t *footer_buffer;
+
+	/* The footer buffer size
+	 */
+	size_t footer_buffer_size;
+
+	/* The footer buffer offset
+	 */
+	size_t footer_buffer_offset;
+
+	/* The footer buffer data size
+	 */
+	size_t footer_buffer_data_size;
+
 	/* The (unbounded) scan tree
 	 */
 	libsigscan_scan_tree_t *scan_tree;
@@ -99,17 +136,33 @@ struct libsigscan_internal_scan_state
 	 */
 	libsigscan_scan_tree_node_t *active_node;
 
-	/* The (scan) buffer
+	/* The skip block size
+	 */
+	size_t skip_block_size;
+
+	/* The skip table
 	 */
-	uint8_t *buffer;
+	libsigscan_skip_table_t *skip_table;
 
 	/* The (scan) buffer size
+	 * This value is used as the read size of the data
 	 */
 	size_t buffer_size;
 
-	/* The (scan) buffer data size
+	/* The carry-over buffer
+	 * This buffer contains the last bytes of the previous buffer that can contain
+	 * the start of an unbounded pattern that crosses the buffer boundary
+	 */
+	uint8_t *carry_over_buffer;
+
+	/* The carry-over size
+	 * This value contains the largest unbounded pattern size - 1
+	 */
+	size_t carry_over_size;
+
+	/* The carry-over buffer data size
 	 */
-	size_t buffer_data_size;
+	size_t carry_over_data_size;
 
 	/* The scan results array
 	 */
@@ -138,6 +191,28 @@ int libsigscan_scan_state_set_data_size(
      size64_t data_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_set_data_origin(
+     libsigscan_scan_state_t *scan_state,
+     off64_t data_origin,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_get_data_origin(
+     libsigscan_scan_state_t *scan_state,
+     off64_t *data_origin,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_set_skip_block_size(
+     libsigscan_scan_state_t *scan_state,
+     size_t skip_block_size,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_get_skip_block_size(
+     libsigscan_scan_state_t *scan_state,
+     size_t *skip_block_size,
+     libcerror_error_t **error );
+
 int libsigscan_scan_state_get_buffer_size(
      libsigscan_scan_state_t *scan_state,
      size_t *buffer_size,
@@ -162,6 +237,7 @@ int libsigscan_scan_state_start(
      libsigscan_scan_tree_t *header_scan_tree,
      libsigscan_scan_tree_t *footer_scan_tree,
      libsigscan_scan_tree_t *scan_tree,
+     libsigscan_skip_table_t *skip_table,
      size_t scan_buffer_size,
      libcerror_error_t **error );
 
@@ -184,6 +260,49 @@ int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
      size_t buffer_offset,
      libcerror_error_t **error );
 
+int libsigscan_internal_scan_state_scan_buffer_by_bndm_table(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_bndm_table_t *bndm_table,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     size_t scan_end_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_buffer_by_unbound_scan_tree(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     size_t scan_end_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_header_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_unbound_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_append_footer_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_footer_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     size64_t data_size,
+     libcerror_error_t **error );
+
 int libsigscan_internal_scan_state_scan_buffer(
      libsigscan_internal_scan_state_t *internal_scan_state,
      const uint8_t *buffer,
@@ -23,11 +23,13 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_byte_value_frequencies.h"
 #include "libsigscan_byte_value_group.h"
 #include "libsigscan_definitions.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
+#include "libsigscan_libcthreads.h"
 #include "libsigscan_offset_group.h"
 #include "libsigscan_offsets_list.h"
 #include "libsigscan_pattern_weights.h"
@@ -39,6 +41,7 @@
 #include "libsigscan_signature_table.h"
 #include "libsigscan_signatures_list.h"
 #include "libsigscan_skip_table.h"
+#include "libsigscan_unused.h"
 
 uint8_t libsigscan_common_byte_values[ 256 ] = {
 /*                           \a \b \t \n \v \f \r      */
@@ -212,6 +215,38 @@ int libsigscan_scan_tree_free(
 				result = -1;
 			}
 		}
+		if( ( *scan_tree )->bndm_table != NULL )
+		{
+			if( libsigscan_bndm_table_free(
+			     &( ( *scan_tree )->bndm_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free BNDM table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_tree )->signatures_list != NULL )
+		{
+			if( libsigscan_signature_table_free_signatures_list_clone(
+			     &( ( *scan_tree )->signatures_list ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free signatures list.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_range_list_free(
 		     &( ( *scan_tree )->pattern_range_list ),
 		     NULL,
@@ -1165,9 +1200,11 @@ int libsigscan_scan_tree_get_spanning_range(
 int libsigscan_scan_tree_build_node(
      libsigscan_scan_tree_t *scan_tree,
      libsigscan_signature_table_t *signature_table,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
      libcdata_list_t *offsets_ignore_list,
      int pattern_offsets_mode,
      uint64_t pattern_offsets_range_size,
+     int number_of_threads,
      libsigscan_scan_tree_node_t **scan_tree_node,
      libcerror_error_t **error )
 {
@@ -1180,19 +1217,26 @@ int libsigscan_scan_tree_build_node(
 	libsigscan_scan_object_t *scan_object             = NULL;
 	libsigscan_signature_t *signature                 = NULL;
 	libsigscan_signature_group_t *signature_group     = NULL;
-	libsigscan_signature_table_t *sub_signature_table = NULL;
+	libsigscan_scan_tree_build_values_t *build_values = NULL;
 	intptr_t *scan_object_value                       = NULL;
 	static char *function                             = "libsigscan_scan_tree_build_node";
 	off64_t pattern_offset                            = 0;
 	uint8_t byte_value                                = 0;
 	uint8_t scan_object_type                          = 0;
+	int build_values_index                            = 0;
+	int number_of_build_values                        = 0;
 	int number_of_remaining_signatures                = 0;
 	int number_of_signature_groups                    = 0;
 	int number_of_signatures                          = 0;
+	int number_of_sub_nodes                           = 0;
 	int result                                        = 0;
 	int signature_group_index                         = 0;
 	int signature_index                               = 0;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool            = NULL;
+#endif
+
 	if( scan_tree == NULL )
 	{
 		libcerror_error_set(
@@ -1284,6 +1328,7 @@ int libsigscan_scan_tree_build_node(
 	if( libsigscan_scan_tree_fill_pattern_weights(
 	     scan_tree,
 	     signature_table,
+	     byte_value_frequencies,
 	     similarity_weights,
 	     occurrence_weights,
 	     byte_value_weights,
@@ -1530,8 +1575,69 @@ int libsigscan_scan_tree_build_node(
 			}
 		}
 	}
-	/* Determine the scan tree node byte values
+	/* Determine the number of signatures covered by the scan tree node default value
+	 */
+	if( libcdata_list_get_number_of_elements(
+	     remaining_signatures_list,
+	     &number_of_remaining_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of remaining signatures.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of remaining signatures: %d\n",
+		 function,
+		 number_of_remaining_signatures );
+	}
+#endif
+	/* Determine the sub scan tree nodes that need to be built
+	 * the build values of the default value are stored after those of the signature groups
 	 */
+	number_of_build_values = number_of_signature_groups + 1;
+
+	build_values = (libsigscan_scan_tree_build_values_t *) memory_allocate(
+	                sizeof( libsigscan_scan_tree_build_values_t ) * number_of_build_values );
+
+	if( build_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create build values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     build_values,
+	     0,
+	     sizeof( libsigscan_scan_tree_build_values_t ) * number_of_build_values ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear build values.",
+		 function );
+
+		memory_free(
+		 build_values );
+
+		build_values = NULL;
+
+		goto on_error;
+	}
 	for( signature_group_index = 0;
 	     signature_group_index < number_of_signature_groups;
 	     signature_group_index++ )
@@ -1553,22 +1659,6 @@ int libsigscan_scan_tree_build_node(
 
 			goto on_error;
 		}
-		if( libsigscan_signature_group_get_byte_value(
-		     signature_group,
-		     &byte_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve byte value.",
-			 function,
-			 pattern_offset,
-			 signature_group_index );
-
-			goto on_error;
-		}
 		if( libsigscan_signature_group_get_number_of_signatures(
 		     signature_group,
 		     &number_of_signatures,
@@ -1585,271 +1675,344 @@ int libsigscan_scan_tree_build_node(
 
 			goto on_error;
 		}
-		if( number_of_signatures == 0 )
+		/* In the unbound scan tree the remaining signatures, that do not cover the pattern offset,
+		 * can still match hence a sub scan tree node is built even for a single signature
+		 */
+		if( ( number_of_signatures > 1 )
+		 || ( ( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+		  && ( number_of_remaining_signatures > 0 ) ) )
+		{
+			build_values[ signature_group_index ].signatures_list           = signature_group->signatures_list;
+			build_values[ signature_group_index ].remaining_signatures_list = remaining_signatures_list;
+		}
+	}
+	if( number_of_remaining_signatures > 1 )
+	{
+		build_values[ number_of_signature_groups ].signatures_list = remaining_signatures_list;
+	}
+	for( build_values_index = 0;
+	     build_values_index < number_of_build_values;
+	     build_values_index++ )
+	{
+		if( build_values[ build_values_index ].signatures_list != NULL )
+		{
+			build_values[ build_values_index ].scan_tree                  = scan_tree;
+			build_values[ build_values_index ].byte_value_frequencies     = byte_value_frequencies;
+			build_values[ build_values_index ].offsets_ignore_list        = sub_offsets_ignore_list;
+			build_values[ build_values_index ].pattern_offsets_mode       = pattern_offsets_mode;
+			build_values[ build_values_index ].pattern_offsets_range_size = pattern_offsets_range_size;
+
+			number_of_sub_nodes++;
+		}
+	}
+	/* Build the sub scan tree nodes
+	 * The sub scan tree nodes are independent of each other and are built as separate tasks
+	 * on a thread pool. Since every task stores its result in its own build values
+	 * the resulting scan tree does not depend on the order in which the tasks complete.
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_sub_nodes > 1 ) )
+	{
+		if( number_of_threads > number_of_sub_nodes )
+		{
+			number_of_threads = number_of_sub_nodes;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_sub_nodes,
+		     (int (*)(intptr_t *, void *)) &libsigscan_scan_tree_build_sub_node_callback,
+		     NULL,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - missing number of signatures.",
-			 function,
-			 pattern_offset,
-			 signature_group_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
 
 			goto on_error;
 		}
-		if( number_of_signatures == 1 )
+		for( build_values_index = 0;
+		     build_values_index < number_of_build_values;
+		     build_values_index++ )
 		{
-			if( libsigscan_signature_group_get_signature_by_index(
-			     signature_group,
-			     0,
-			     (libsigscan_signature_t **) &scan_object_value,
+			if( build_values[ build_values_index ].signatures_list == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( build_values[ build_values_index ] ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 	 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve signature: 0.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push build values: %d onto thread pool queue.",
 				 function,
-				 pattern_offset,
-				 signature_group_index );
+				 build_values_index );
 
 				goto on_error;
 			}
-			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
 		}
-		else
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
 		{
-			if( libsigscan_signature_table_initialize(
-			     &sub_signature_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create signature table.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
 
-				goto on_error;
-			}
-			if( libsigscan_signature_table_fill(
-			     sub_signature_table,
-			     signature_group->signatures_list,
-			     sub_offsets_ignore_list,
-			     pattern_offsets_mode,
-			     pattern_offsets_range_size,
-			     error ) != 1 )
+			goto on_error;
+		}
+		for( build_values_index = 0;
+		     build_values_index < number_of_build_values;
+		     build_values_index++ )
+		{
+			if( ( build_values[ build_values_index ].signatures_list != NULL )
+			 && ( build_values[ build_values_index ].result != 1 ) )
 			{
+				/* Pass the error of the task on to the caller
+				 */
+				if( ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error = build_values[ build_values_index ].error;
+
+					build_values[ build_values_index ].error = NULL;
+				}
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to fill signature table.",
-				 function );
+				 "%s: unable to build sub scan tree node: %d.",
+				 function,
+				 build_values_index );
 
 				goto on_error;
 			}
-			if( libsigscan_signature_table_fill(
-			     sub_signature_table,
-			     remaining_signatures_list,
-			     sub_offsets_ignore_list,
-			     pattern_offsets_mode,
-			     pattern_offsets_range_size,
-			     error ) != 1 )
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( build_values_index = 0;
+		     build_values_index < number_of_build_values;
+		     build_values_index++ )
+		{
+			if( build_values[ build_values_index ].signatures_list == NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to fill signature table.",
-				 function );
-
-				goto on_error;
+				continue;
 			}
-			if( libsigscan_scan_tree_build_node(
+			/* Pass the number of threads on so that the sub nodes of a single sub node
+			 * can be built in parallel
+			 */
+			if( libsigscan_scan_tree_build_sub_node(
 			     scan_tree,
-			     sub_signature_table,
+			     build_values[ build_values_index ].signatures_list,
+			     build_values[ build_values_index ].remaining_signatures_list,
+			     byte_value_frequencies,
 			     sub_offsets_ignore_list,
 			     pattern_offsets_mode,
 			     pattern_offsets_range_size,
-			     (libsigscan_scan_tree_node_t **) &scan_object_value,
+			     number_of_threads,
+			     &( build_values[ build_values_index ].scan_tree_node ),
+			     &( build_values[ build_values_index ].signature ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to build scan tree node.",
-				 function );
-
-				goto on_error;
-			}
-			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
-
-			if( libsigscan_signature_table_free(
-			     &sub_signature_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free signature table.",
-				 function );
+				 "%s: unable to build sub scan tree node: %d.",
+				 function,
+				 build_values_index );
 
 				goto on_error;
 			}
 		}
-		if( libsigscan_scan_object_initialize(
-		     &scan_object,
-		     scan_object_type,
-		     scan_object_value,
+	}
+	/* Determine the scan tree node byte values
+	 */
+	for( signature_group_index = 0;
+	     signature_group_index < number_of_signature_groups;
+	     signature_group_index++ )
+	{
+		if( libsigscan_byte_value_group_get_signature_group_by_index(
+		     byte_value_group,
+		     signature_group_index,
+		     &signature_group,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create scan object",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - unable to retrieve signature group: %d.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
 
 			goto on_error;
 		}
-		/* The scan object takes over management of the scan object value
-		 */
-		scan_object_value = NULL;
+		if( libsigscan_signature_group_get_byte_value(
+		     signature_group,
+		     &byte_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve byte value.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
 
-		if( libsigscan_scan_tree_node_set_byte_value(
-		     *scan_tree_node,
-		     byte_value,
-		     scan_object,
+			goto on_error;
+		}
+		if( libsigscan_signature_group_get_number_of_signatures(
+		     signature_group,
+		     &number_of_signatures,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set scan tree node byte value: 0x%02" PRIx8 ".",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve number of signatures.",
 			 function,
-			 byte_value );
+			 pattern_offset,
+			 signature_group_index );
 
 			goto on_error;
 		}
-		/* The scan tree node takes over management of the scan object
-		 */
-		scan_object = NULL;
-	}
-	/* Determine the scan tree node default value
-	 */
-	if( libcdata_list_get_number_of_elements(
-	     remaining_signatures_list,
-	     &number_of_remaining_signatures,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of remaining signatures.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: number of remaining signatures: %d\n",
-		 function,
-		 number_of_remaining_signatures );
-	}
-#endif
-	if( number_of_remaining_signatures == 1 )
-	{
-		if( libcdata_list_get_value_by_index(
-		     remaining_signatures_list,
-		     0,
-		     &scan_object_value,
-		     error ) != 1 )
+		if( number_of_signatures == 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid remaining signatures list - unable to retrieve signature: 0.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - missing number of signatures.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
 
 			goto on_error;
 		}
-		scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
-	}
-	else if( number_of_remaining_signatures > 1 )
-	{
-		if( libsigscan_signature_table_initialize(
-		     &sub_signature_table,
-		     error ) != 1 )
+		if( build_values[ signature_group_index ].signatures_list == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create signature table.",
-			 function );
+			if( libsigscan_signature_group_get_signature_by_index(
+			     signature_group,
+			     0,
+			     (libsigscan_signature_t **) &scan_object_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 	 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve signature: 0.",
+				 function,
+				 pattern_offset,
+				 signature_group_index );
 
-			goto on_error;
+				goto on_error;
+			}
+			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
 		}
-		if( libsigscan_signature_table_fill(
-		     sub_signature_table,
-		     remaining_signatures_list,
-		     sub_offsets_ignore_list,
-		     pattern_offsets_mode,
-		     pattern_offsets_range_size,
+		else if( build_values[ signature_group_index ].signature != NULL )
+		{
+			scan_object_value = (intptr_t *) build_values[ signature_group_index ].signature;
+			scan_object_type  = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
+		}
+		else
+		{
+			scan_object_value = (intptr_t *) build_values[ signature_group_index ].scan_tree_node;
+			scan_object_type  = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+
+			build_values[ signature_group_index ].scan_tree_node = NULL;
+		}
+		if( libsigscan_scan_object_initialize(
+		     &scan_object,
+		     scan_object_type,
+		     scan_object_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to fill signature table.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan object",
 			 function );
 
 			goto on_error;
 		}
-		if( libsigscan_scan_tree_build_node(
-		     scan_tree,
-		     sub_signature_table,
-		     sub_offsets_ignore_list,
-		     pattern_offsets_mode,
-		     pattern_offsets_range_size,
-		     (libsigscan_scan_tree_node_t **) &scan_object_value,
+		/* The scan object takes over management of the scan object value
+		 */
+		scan_object_value = NULL;
+
+		if( libsigscan_scan_tree_node_set_byte_value(
+		     *scan_tree_node,
+		     byte_value,
+		     scan_object,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build scan tree node.",
-			 function );
+			 "%s: unable to set scan tree node byte value: 0x%02" PRIx8 ".",
+			 function,
+			 byte_value );
 
 			goto on_error;
 		}
-		scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
-
-		if( libsigscan_signature_table_free(
-		     &sub_signature_table,
+		/* The scan tree node takes over management of the scan object
+		 */
+		scan_object = NULL;
+	}
+	/* Determine the scan tree node default value
+	 */
+	if( number_of_remaining_signatures == 1 )
+	{
+		if( libcdata_list_get_value_by_index(
+		     remaining_signatures_list,
+		     0,
+		     &scan_object_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free signature table.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid remaining signatures list - unable to retrieve signature: 0.",
 			 function );
 
 			goto on_error;
 		}
+		scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
+	}
+	else if( ( number_of_remaining_signatures > 1 )
+	      && ( build_values[ number_of_signature_groups ].signature != NULL ) )
+	{
+		scan_object_value = (intptr_t *) build_values[ number_of_signature_groups ].signature;
+		scan_object_type  = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
+	}
+	else if( number_of_remaining_signatures > 1 )
+	{
+		scan_object_value = (intptr_t *) build_values[ number_of_signature_groups ].scan_tree_node;
+		scan_object_type  = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+
+		build_values[ number_of_signature_groups ].scan_tree_node = NULL;
 	}
 	if( scan_object_value != NULL )
 	{
@@ -1890,6 +2053,11 @@ int libsigscan_scan_tree_build_node(
 		 */
 		scan_object = NULL;
 	}
+	memory_free(
+	 build_values );
+
+	build_values = NULL;
+
 	if( libcdata_list_free(
 	     &sub_offsets_ignore_list,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
@@ -1938,12 +2106,35 @@ int libsigscan_scan_tree_build_node(
 	return( 1 );
 
 on_error:
-	if( sub_signature_table != NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
 	{
-		libsigscan_signature_table_free(
-		 &sub_signature_table,
+		libcthreads_thread_pool_join(
+		 &thread_pool,
 		 NULL );
 	}
+#endif
+	if( build_values != NULL )
+	{
+		for( build_values_index = 0;
+		     build_values_index < number_of_build_values;
+		     build_values_index++ )
+		{
+			if( build_values[ build_values_index ].scan_tree_node != NULL )
+			{
+				libsigscan_scan_tree_node_free(
+				 &( build_values[ build_values_index ].scan_tree_node ),
+				 NULL );
+			}
+			if( build_values[ build_values_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( build_values[ build_values_index ].error ) );
+			}
+		}
+		memory_free(
+		 build_values );
+	}
 	if( ( scan_object_value != NULL )
 	 && ( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE ) )
 	{
@@ -1994,254 +2185,969 @@ on_error:
 		 &remaining_signatures_list,
 		 NULL );
 	}
-	return( -1 );
+	return( -1 );
+}
+
+/* Builds a sub scan tree node
+ * The sub scan tree node covers the signatures in the signatures list and,
+ * if set, the signatures in the remaining signatures list
+ * If no pattern offset is left to tell the signatures apart no sub scan tree node
+ * is built and the signature with the largest pattern is returned as leaf signature
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_sub_node(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libcdata_list_t *remaining_signatures_list,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_threads,
+     libsigscan_scan_tree_node_t **scan_tree_node,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_table_t *signature_table = NULL;
+	static char *function                         = "libsigscan_scan_tree_build_sub_node";
+	int number_of_byte_value_groups               = 0;
+
+	if( libsigscan_signature_table_initialize(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_signature_table_fill(
+	     signature_table,
+	     signatures_list,
+	     offsets_ignore_list,
+	     pattern_offsets_mode,
+	     pattern_offsets_range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( remaining_signatures_list != NULL )
+	{
+		if( libsigscan_signature_table_fill(
+		     signature_table,
+		     remaining_signatures_list,
+		     offsets_ignore_list,
+		     pattern_offsets_mode,
+		     pattern_offsets_range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill signature table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_signature_table_get_number_of_byte_value_groups(
+	     signature_table,
+	     &number_of_byte_value_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of byte value groups.",
+		 function );
+
+		goto on_error;
+	}
+	/* If all the pattern offsets of the signatures are ignored the signatures cannot
+	 * be told apart, e.g. unbound patterns where one pattern is a prefix of another.
+	 * The signatures matched all the pattern offsets of the scan tree nodes above
+	 * the sub scan tree node hence the signature with the largest pattern is used.
+	 */
+	if( number_of_byte_value_groups == 0 )
+	{
+		if( libsigscan_signature_table_get_largest_signature(
+		     signature_table,
+		     signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve largest signature.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( libsigscan_scan_tree_build_node(
+	          scan_tree,
+	          signature_table,
+	          byte_value_frequencies,
+	          offsets_ignore_list,
+	          pattern_offsets_mode,
+	          pattern_offsets_range_size,
+	          number_of_threads,
+	          scan_tree_node,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_signature_table_free(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free signature table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( scan_tree_node != NULL )
+	 && ( *scan_tree_node != NULL ) )
+	{
+		libsigscan_scan_tree_node_free(
+		 scan_tree_node,
+		 NULL );
+	}
+	if( signature_table != NULL )
+	{
+		libsigscan_signature_table_free(
+		 &signature_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds a sub scan tree node using the build values
+ * This function is used as the thread pool callback function
+ * The result and error of the build are stored in the build values
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_sub_node_callback(
+     libsigscan_scan_tree_build_values_t *build_values,
+     void *arguments LIBSIGSCAN_ATTRIBUTE_UNUSED )
+{
+	LIBSIGSCAN_UNREFERENCED_PARAMETER( arguments )
+
+	if( build_values == NULL )
+	{
+		return( -1 );
+	}
+	/* The sub nodes of the sub scan tree node are built on the current thread
+	 */
+	build_values->result = libsigscan_scan_tree_build_sub_node(
+	                        build_values->scan_tree,
+	                        build_values->signatures_list,
+	                        build_values->remaining_signatures_list,
+	                        build_values->byte_value_frequencies,
+	                        build_values->offsets_ignore_list,
+	                        build_values->pattern_offsets_mode,
+	                        build_values->pattern_offsets_range_size,
+	                        1,
+	                        &( build_values->scan_tree_node ),
+	                        &( build_values->signature ),
+	                        &( build_values->error ) );
+
+	return( 1 );
+}
+
+/* Builds the scan tree
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libsigscan_scan_tree_build(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     int pattern_offsets_mode,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *offsets_ignore_list          = NULL;
+	libsigscan_signature_table_t *signature_table = NULL;
+	static char *function                         = "libsigscan_scan_tree_build";
+	uint64_t range_size                           = 0;
+	uint64_t range_start                          = 0;
+	int number_of_pattern_ranges                  = 0;
+	int result                                    = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_fill_range_list(
+	     scan_tree,
+	     signatures_list,
+	     pattern_offsets_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill range list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     scan_tree->pattern_range_list,
+	     &number_of_pattern_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pattern ranges.",
+		 function );
+
+		goto on_error;
+	}
+	/* A scan tree without signatures has no root node, but it still has
+	 * a pattern offsets mode so that it can be compiled
+	 */
+	if( number_of_pattern_ranges == 0 )
+	{
+		scan_tree->pattern_offsets_mode = pattern_offsets_mode;
+
+		return( 0 );
+	}
+	result = libcdata_range_list_get_spanning_range(
+	          scan_tree->pattern_range_list,
+	          &range_start,
+	          &range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve pattern range list spanning range.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_signature_table_initialize(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_initialize(
+	     &offsets_ignore_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create offsets ignore list.",
+		 function );
+
+		goto on_error;
+	}
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	{
+		range_size = range_start;
+	}
+	if( libsigscan_signature_table_fill(
+	     signature_table,
+	     signatures_list,
+	     offsets_ignore_list,
+	     pattern_offsets_mode,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill signature table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_build_node(
+	     scan_tree,
+	     signature_table,
+	     byte_value_frequencies,
+	     offsets_ignore_list,
+	     pattern_offsets_mode,
+	     range_size,
+	     LIBSIGSCAN_SCAN_TREE_BUILD_MAXIMUM_NUMBER_OF_THREADS,
+	     &( scan_tree->root_node ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build root scan tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_free(
+	     &offsets_ignore_list,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free offsets ignore list.",
+		 function );
+
+		goto on_error;
+	}
+	/* Identical sub scan tree nodes and scan objects are merged
+	 * to reduce the memory usage of the scan tree
+	 */
+	if( libsigscan_scan_tree_merge(
+	     scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to merge scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the unbound scan tree is scanned at every offset of the data
+	 * hence only the unbound scan tree uses skip values
+	 */
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	{
+		/* The signatures of the scan tree are kept to fill a skip table
+		 * with another block size when a scan is started
+		 */
+		if( libsigscan_signature_table_get_signatures_list_clone(
+		     signature_table,
+		     &( scan_tree->signatures_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signatures list clone.",
+			 function );
+
+			goto on_error;
+		}
+		/* The skip table is determined to provide for the Boyer–Moore–Horspool skip values
+		 * or for the Wu-Manber (block) skip values with a large number of signatures
+		 */
+		if( libsigscan_skip_table_initialize(
+		     &( scan_tree->skip_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create skip table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_skip_table_fill(
+		     scan_tree->skip_table,
+		     scan_tree->signatures_list,
+		     byte_value_frequencies,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill skip table.",
+			 function );
+
+			goto on_error;
+		}
+		/* A small set of short unbound patterns is scanned bit-parallel (BNDM)
+		 * instead of by the scan tree and skip table
+		 */
+		if( libsigscan_bndm_table_initialize(
+		     &( scan_tree->bndm_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create BNDM table.",
+			 function );
+
+			goto on_error;
+		}
+		result = libsigscan_bndm_table_fill(
+		          scan_tree->bndm_table,
+		          scan_tree->signatures_list,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill BNDM table.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libsigscan_bndm_table_free(
+			     &( scan_tree->bndm_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free BNDM table.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libsigscan_signature_table_free(
+	     &signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free signature table.",
+		 function );
+
+		goto on_error;
+	}
+	scan_tree->pattern_offsets_mode = pattern_offsets_mode;
+
+	return( 1 );
+
+on_error:
+	if( scan_tree->bndm_table != NULL )
+	{
+		libsigscan_bndm_table_free(
+		 &( scan_tree->bndm_table ),
+		 NULL );
+	}
+	if( scan_tree->signatures_list != NULL )
+	{
+		libsigscan_signature_table_free_signatures_list_clone(
+		 &( scan_tree->signatures_list ),
+		 NULL );
+	}
+	if( scan_tree->skip_table != NULL )
+	{
+		libsigscan_skip_table_free(
+		 &( scan_tree->skip_table ),
+		 NULL );
+	}
+	if( offsets_ignore_list != NULL )
+	{
+		libcdata_list_free(
+		 &offsets_ignore_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+		 NULL );
+	}
+	if( signature_table != NULL )
+	{
+		libsigscan_signature_table_free(
+		 &signature_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds a scan tree using the build values
+ * This function is used as the thread callback function
+ * The result and error of the build are stored in the build values
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_callback(
+     libsigscan_scan_tree_build_values_t *build_values )
+{
+	if( build_values == NULL )
+	{
+		return( -1 );
+	}
+	build_values->result = libsigscan_scan_tree_build(
+	                        build_values->scan_tree,
+	                        build_values->signatures_list,
+	                        build_values->byte_value_frequencies,
+	                        build_values->pattern_offsets_mode,
+	                        &( build_values->error ) );
+
+	return( 1 );
+}
+
+/* Merges a scan object with an identical scan object in the scan objects tree
+ * If an identical scan object already exists the scan object is freed
+ * and replaced by a reference to the existing scan object
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_merge_scan_object(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_btree_t *scan_objects_tree,
+     libsigscan_scan_object_t **scan_object,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *upper_node               = NULL;
+	libsigscan_scan_object_t *existing_scan_object = NULL;
+	static char *function                          = "libsigscan_scan_tree_merge_scan_object";
+	uint8_t scan_object_type                       = 0;
+	int result                                     = 0;
+	int value_index                                = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_object == NULL )
+	{
+		return( 1 );
+	}
+	if( libsigscan_scan_object_get_type(
+	     *scan_object,
+	     &scan_object_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan object type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sub scan tree nodes are merged first so that identical scan tree nodes
+	 * refer to the same scan objects
+	 */
+	if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+	{
+		if( libsigscan_scan_tree_merge_node(
+		     scan_tree,
+		     scan_objects_tree,
+		     (libsigscan_scan_tree_node_t *) ( *scan_object )->value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to merge sub scan tree node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libcdata_btree_insert_value(
+	          scan_objects_tree,
+	          &value_index,
+	          (intptr_t *) *scan_object,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_scan_object_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_scan_object,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert scan object into scan objects tree.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		scan_tree->number_of_scan_objects += 1;
+
+		if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+		{
+			scan_tree->number_of_scan_tree_nodes += 1;
+		}
+	}
+	else if( existing_scan_object != *scan_object )
+	{
+		if( libsigscan_scan_object_free(
+		     scan_object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan object.",
+			 function );
+
+			return( -1 );
+		}
+		existing_scan_object->number_of_references += 1;
+
+		*scan_object = existing_scan_object;
+
+		scan_tree->number_of_merged_scan_objects += 1;
+
+		if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+		{
+			scan_tree->number_of_merged_scan_tree_nodes += 1;
+		}
+	}
+	return( 1 );
 }
 
-/* Builds the scan tree
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Merges the scan objects of a scan tree node with identical scan objects in the scan objects tree
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_tree_build(
+int libsigscan_scan_tree_merge_node(
      libsigscan_scan_tree_t *scan_tree,
-     libcdata_list_t *signatures_list,
-     int pattern_offsets_mode,
+     libcdata_btree_t *scan_objects_tree,
+     libsigscan_scan_tree_node_t *scan_tree_node,
      libcerror_error_t **error )
 {
-	libcdata_list_t *offsets_ignore_list          = NULL;
-	libsigscan_signature_table_t *signature_table = NULL;
-	static char *function                         = "libsigscan_scan_tree_build";
-	uint64_t range_size                           = 0;
-	uint64_t range_start                          = 0;
-	int number_of_pattern_ranges                  = 0;
-	int result                                    = 0;
+	static char *function = "libsigscan_scan_tree_merge_node";
+	uint16_t byte_value   = 0;
 
-	if( scan_tree == NULL )
+	if( scan_tree_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan tree.",
+		 "%s: invalid scan tree node.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported pattern offsets mode.",
-		 function );
+		if( libsigscan_scan_tree_merge_scan_object(
+		     scan_tree,
+		     scan_objects_tree,
+		     &( scan_tree_node->scan_objects_table[ byte_value ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to merge scan object for byte value: 0x%02" PRIx16 ".",
+			 function,
+			 byte_value );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( libsigscan_scan_tree_fill_range_list(
+	if( libsigscan_scan_tree_merge_scan_object(
 	     scan_tree,
-	     signatures_list,
-	     pattern_offsets_mode,
+	     scan_objects_tree,
+	     &( scan_tree_node->default_scan_object ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to fill range list.",
+		 "%s: unable to merge default scan object.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_range_list_get_number_of_elements(
-	     scan_tree->pattern_range_list,
-	     &number_of_pattern_ranges,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of pattern ranges.",
-		 function );
+	return( 1 );
+}
 
-		goto on_error;
-	}
-	if( number_of_pattern_ranges == 0 )
-	{
-		return( 0 );
-	}
-	result = libcdata_range_list_get_spanning_range(
-	          scan_tree->pattern_range_list,
-	          &range_start,
-	          &range_size,
-	          error );
+/* Merges identical scan tree nodes and scan objects
+ * This turns the scan tree into a directed acyclic graph where identical
+ * sub scan tree nodes and scan objects of the same signature are shared
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_merge(
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error )
+{
+	libcdata_btree_t *scan_objects_tree = NULL;
+	static char *function               = "libsigscan_scan_tree_merge";
 
-	if( result == -1 )
+	if( scan_tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve pattern range list spanning range.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
 		 function );
 
 		return( -1 );
 	}
-	if( libsigscan_signature_table_initialize(
-	     &signature_table,
-	     error ) != 1 )
+	if( scan_tree->root_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create signature table.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan tree - missing root node.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_list_initialize(
-	     &offsets_ignore_list,
+	if( libcdata_btree_initialize(
+	     &scan_objects_tree,
+	     LIBSIGSCAN_SCAN_OBJECTS_TREE_MAXIMUM_NUMBER_OF_VALUES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create offsets ignore list.",
+		 "%s: unable to create scan objects tree.",
 		 function );
 
 		goto on_error;
 	}
-	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-	{
-		range_size = range_start;
-	}
-	if( libsigscan_signature_table_fill(
-	     signature_table,
-	     signatures_list,
-	     offsets_ignore_list,
-	     pattern_offsets_mode,
-	     range_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to fill signature table.",
-		 function );
+	scan_tree->number_of_scan_tree_nodes        = 1;
+	scan_tree->number_of_scan_objects           = 0;
+	scan_tree->number_of_merged_scan_tree_nodes = 0;
+	scan_tree->number_of_merged_scan_objects    = 0;
 
-		goto on_error;
-	}
-	if( libsigscan_scan_tree_build_node(
+	if( libsigscan_scan_tree_merge_node(
 	     scan_tree,
-	     signature_table,
-	     offsets_ignore_list,
-	     pattern_offsets_mode,
-	     range_size,
-	     &( scan_tree->root_node ),
+	     scan_objects_tree,
+	     scan_tree->root_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to build root scan tree node.",
+		 "%s: unable to merge root scan tree node.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_list_free(
-	     &offsets_ignore_list,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+	/* The scan objects are owned by the scan tree nodes
+	 */
+	if( libcdata_btree_free(
+	     &scan_objects_tree,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free offsets ignore list.",
+		 "%s: unable to free scan objects tree.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_signature_table_free(
-	     &signature_table,
-	     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of scan tree nodes\t: %d (merged: %d)\n",
+		 function,
+		 scan_tree->number_of_scan_tree_nodes,
+		 scan_tree->number_of_merged_scan_tree_nodes );
+
+		libcnotify_printf(
+		 "%s: number of scan objects\t: %d (merged: %d)\n",
+		 function,
+		 scan_tree->number_of_scan_objects,
+		 scan_tree->number_of_merged_scan_objects );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( scan_objects_tree != NULL )
+	{
+		libcdata_btree_free(
+		 &scan_objects_tree,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the memory usage
+ * The memory usage contains the scan tree, the scan tree nodes, the scan objects and the skip table
+ * The saved memory usage contains the memory no longer needed after merging identical
+ * scan tree nodes and scan objects
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_get_memory_usage(
+     libsigscan_scan_tree_t *scan_tree,
+     size64_t *memory_usage,
+     size64_t *saved_memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_get_memory_usage";
+
+	if( scan_tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free signature table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* The skip table is determined to provide for the Boyer–Moore–Horspool skip values
-	 */
-	if( libsigscan_skip_table_initialize(
-	     &( scan_tree->skip_table ),
-	     error ) != 1 )
+	if( memory_usage == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create skip table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libsigscan_skip_table_fill(
-	     scan_tree->skip_table,
-	     signatures_list,
-	     error ) != 1 )
+	if( saved_memory_usage == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to fill skip table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid saved memory usage.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	scan_tree->pattern_offsets_mode = pattern_offsets_mode;
+	*memory_usage = (size64_t) sizeof( libsigscan_scan_tree_t )
+	              + ( (size64_t) scan_tree->number_of_scan_tree_nodes * sizeof( libsigscan_scan_tree_node_t ) )
+	              + ( (size64_t) scan_tree->number_of_scan_objects * sizeof( libsigscan_scan_object_t ) );
 
-	return( 1 );
-
-on_error:
 	if( scan_tree->skip_table != NULL )
 	{
-		libsigscan_skip_table_free(
-		 &( scan_tree->skip_table ),
-		 NULL );
-	}
-	if( offsets_ignore_list != NULL )
-	{
-		libcdata_list_free(
-		 &offsets_ignore_list,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
-		 NULL );
+		*memory_usage += sizeof( libsigscan_skip_table_t );
+
+		if( scan_tree->skip_table->block_skip_values != NULL )
+		{
+			*memory_usage += sizeof( uint16_t ) * LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_SKIP_VALUES;
+		}
 	}
-	if( signature_table != NULL )
+	if( scan_tree->bndm_table != NULL )
 	{
-		libsigscan_signature_table_free(
-		 &signature_table,
-		 NULL );
+		*memory_usage += sizeof( libsigscan_bndm_table_t );
 	}
-	return( -1 );
+	*saved_memory_usage = ( (size64_t) scan_tree->number_of_merged_scan_tree_nodes * sizeof( libsigscan_scan_tree_node_t ) )
+	                    + ( (size64_t) scan_tree->number_of_merged_scan_objects * sizeof( libsigscan_scan_object_t ) );
+
+	return( 1 );
 }
 
 /* Fills the pattern weights
+ * If byte value frequencies are provided the byte value weights are based on
+ * the frequencies otherwise on the common byte values
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_scan_tree_fill_pattern_weights(
      libsigscan_scan_tree_t *scan_tree,
      libsigscan_signature_table_t *signature_table,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
      libsigscan_pattern_weights_t *similarity_weights,
      libsigscan_pattern_weights_t *occurrence_weights,
      libsigscan_pattern_weights_t *byte_value_weights,
@@ -2252,9 +3158,11 @@ int libsigscan_scan_tree_fill_pattern_weights(
 	static char *function                           = "libsigscan_scan_tree_fill_pattern_weights";
 	uint8_t byte_value                              = 0;
 	int byte_value_group_index                      = 0;
+	int byte_value_weight                           = 0;
 	int number_of_byte_value_groups                 = 0;
 	int number_of_signature_groups                  = 0;
 	int number_of_signatures                        = 0;
+	int result                                      = 0;
 	int signature_group_index                       = 0;
 
 	if( scan_tree == NULL )
@@ -2402,12 +3310,59 @@ int libsigscan_scan_tree_fill_pattern_weights(
 					return( -1 );
 				}
 			}
-			if( libsigscan_common_byte_values[ byte_value ] == 0 )
+			byte_value_weight = 0;
+			result            = 0;
+
+			if( byte_value_frequencies != NULL )
+			{
+				if( libsigscan_signature_group_get_byte_value(
+				     signature_group,
+				     &byte_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: invalid byte value group: %d - invalid signature group: %d - unable to retrieve byte value.",
+					 function,
+					 byte_value_group_index,
+					 signature_group_index );
+
+					return( -1 );
+				}
+				result = libsigscan_byte_value_frequencies_get_weight(
+				          byte_value_frequencies,
+				          byte_value,
+				          &byte_value_weight,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve byte value: 0x%02" PRIx8 " frequency weight.",
+					 function,
+					 byte_value );
+
+					return( -1 );
+				}
+			}
+			if( result == 0 )
+			{
+				if( libsigscan_common_byte_values[ byte_value ] == 0 )
+				{
+					byte_value_weight = 1;
+				}
+			}
+			if( byte_value_weight > 0 )
 			{
 				if( libsigscan_pattern_weights_add_weight(
 				     byte_value_weights,
 				     byte_value_group->pattern_offset,
-				     1,
+				     byte_value_weight,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -2437,6 +3392,7 @@ int libsigscan_scan_tree_fill_range_list(
 	libcdata_list_element_t *list_element = NULL;
 	libsigscan_signature_t *signature     = NULL;
 	static char *function                 = "libsigscan_scan_tree_fill_range_list";
+	off64_t pattern_offset                = 0;
 	int add_signature                     = 0;
 	int result                            = 0;
 
@@ -2530,7 +3486,14 @@ int libsigscan_scan_tree_fill_range_list(
 				break;
 
 			case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
-				add_signature = 1;
+				if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+				{
+					add_signature = 1;
+				}
+				else
+				{
+					add_signature = 0;
+				}
 				break;
 
 			default:
@@ -2539,9 +3502,17 @@ int libsigscan_scan_tree_fill_range_list(
 		}
 		if( add_signature != 0 )
 		{
+			/* An unbound pattern is relative to the offset where it starts
+			 */
+			pattern_offset = signature->pattern_offset;
+
+			if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+			{
+				pattern_offset = 0;
+			}
 			result = libcdata_range_list_insert_range(
 			          scan_tree->pattern_range_list,
-			          signature->pattern_offset,
+			          pattern_offset,
 			          (size64_t) signature->pattern_size,
 			          NULL,
 			          NULL,
@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_byte_value_frequencies.h"
 #include "libsigscan_libcdata.h"
+#include "libsigscan_bndm_table.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_pattern_weights.h"
 #include "libsigscan_scan_tree_node.h"
@@ -52,9 +54,86 @@ struct libsigscan_scan_tree
 	 */
 	libsigscan_skip_table_t *skip_table;
 
+	/* The BNDM table
+	 * Only set for an unbound scan tree with a small set of short patterns
+	 */
+	libsigscan_bndm_table_t *bndm_table;
+
+	/* The signatures list
+	 * Only set for an unbound scan tree, contains references to the signatures of the scan tree
+	 */
+	libcdata_list_t *signatures_list;
+
 	/* The pattern range list
 	 */
 	libcdata_range_list_t *pattern_range_list;
+
+	/* The number of scan tree nodes
+	 */
+	int number_of_scan_tree_nodes;
+
+	/* The number of scan objects
+	 */
+	int number_of_scan_objects;
+
+	/* The number of merged scan tree nodes
+	 */
+	int number_of_merged_scan_tree_nodes;
+
+	/* The number of merged scan objects
+	 */
+	int number_of_merged_scan_objects;
+};
+
+typedef struct libsigscan_scan_tree_build_values libsigscan_scan_tree_build_values_t;
+
+struct libsigscan_scan_tree_build_values
+{
+	/* The scan tree
+	 */
+	libsigscan_scan_tree_t *scan_tree;
+
+	/* The signatures list
+	 */
+	libcdata_list_t *signatures_list;
+
+	/* The remaining signatures list
+	 */
+	libcdata_list_t *remaining_signatures_list;
+
+	/* The byte value frequencies
+	 */
+	libsigscan_byte_value_frequencies_t *byte_value_frequencies;
+
+	/* The offsets ignore list
+	 */
+	libcdata_list_t *offsets_ignore_list;
+
+	/* The pattern offsets mode
+	 */
+	int pattern_offsets_mode;
+
+	/* The pattern offsets range size
+	 */
+	uint64_t pattern_offsets_range_size;
+
+	/* The (sub) scan tree node
+	 */
+	libsigscan_scan_tree_node_t *scan_tree_node;
+
+	/* The leaf signature
+	 * This value is set instead of the sub scan tree node when no pattern offset
+	 * is left to tell the signatures apart
+	 */
+	libsigscan_signature_t *signature;
+
+	/* The build result
+	 */
+	int result;
+
+	/* The build error
+	 */
+	libcerror_error_t *error;
 };
 
 int libsigscan_scan_tree_initialize(
@@ -104,21 +183,67 @@ int libsigscan_scan_tree_get_spanning_range(
 int libsigscan_scan_tree_build_node(
      libsigscan_scan_tree_t *scan_tree,
      libsigscan_signature_table_t *signature_table,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     libcdata_list_t *offsets_ignore_list,
+     int pattern_offsets_mode,
+     uint64_t pattern_offsets_range_size,
+     int number_of_threads,
+     libsigscan_scan_tree_node_t **scan_tree_node,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_build_sub_node(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libcdata_list_t *remaining_signatures_list,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
      libcdata_list_t *offsets_ignore_list,
      int pattern_offsets_mode,
      uint64_t pattern_offsets_range_size,
+     int number_of_threads,
      libsigscan_scan_tree_node_t **scan_tree_node,
+     libsigscan_signature_t **signature,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_build_sub_node_callback(
+     libsigscan_scan_tree_build_values_t *build_values,
+     void *arguments );
+
 int libsigscan_scan_tree_build(
      libsigscan_scan_tree_t *scan_tree,
      libcdata_list_t *signatures_list,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
      int pattern_offsets_mode,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_build_callback(
+     libsigscan_scan_tree_build_values_t *build_values );
+
+int libsigscan_scan_tree_merge_scan_object(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_btree_t *scan_objects_tree,
+     libsigscan_scan_object_t **scan_object,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_merge_node(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_btree_t *scan_objects_tree,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_merge(
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_get_memory_usage(
+     libsigscan_scan_tree_t *scan_tree,
+     size64_t *memory_usage,
+     size64_t *saved_memory_usage,
+     libcerror_error_t **error );
+
 int libsigscan_scan_tree_fill_pattern_weights(
      libsigscan_scan_tree_t *scan_tree,
      libsigscan_signature_table_t *signature_table,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
      libsigscan_pattern_weights_t *similarity_weights,
      libsigscan_pattern_weights_t *occurrence_weights,
      libsigscan_pattern_weights_t *byte_value_weights,
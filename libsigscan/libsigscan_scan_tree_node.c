@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
 #include "libsigscan_scan_object.h"
@@ -179,6 +180,73 @@ int libsigscan_scan_tree_node_free(
 	return( result );
 }
 
+/* Compares two scan tree nodes
+ * Scan tree nodes are considered identical if they have the same pattern offset
+ * and refer to the same scan objects
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libsigscan_scan_tree_node_compare(
+     libsigscan_scan_tree_node_t *first_scan_tree_node,
+     libsigscan_scan_tree_node_t *second_scan_tree_node,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_node_compare";
+	int result            = 0;
+
+	if( first_scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_scan_tree_node->pattern_offset < second_scan_tree_node->pattern_offset )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_scan_tree_node->pattern_offset > second_scan_tree_node->pattern_offset )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_scan_tree_node->default_scan_object < second_scan_tree_node->default_scan_object )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_scan_tree_node->default_scan_object > second_scan_tree_node->default_scan_object )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	result = memory_compare(
+	          first_scan_tree_node->scan_objects_table,
+	          second_scan_tree_node->scan_objects_table,
+	          sizeof( libsigscan_scan_object_t * ) * 256 );
+
+	if( result < 0 )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( result > 0 )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
 /* Sets a scan object for a specific byte value
  * Returns 1 if successful or -1 on error
  */
@@ -326,6 +394,7 @@ int libsigscan_scan_tree_node_get_scan_object(
 }
 
 /* Scans the buffer for a scan object that matches
+ * The scan is dispatched to the scan function of the pattern offsets mode
  * Returns 1 if successful, 0 if not or -1 on error
  */
 int libsigscan_scan_tree_node_scan_buffer(
@@ -338,9 +407,72 @@ int libsigscan_scan_tree_node_scan_buffer(
      size_t buffer_offset,
      libsigscan_scan_object_t **scan_object,
      libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_node_scan_buffer";
+
+	switch( pattern_offsets_mode )
+	{
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START:
+			return( libsigscan_scan_tree_node_scan_buffer_bound_to_start(
+			         scan_tree_node,
+			         data_offset,
+			         data_size,
+			         buffer,
+			         buffer_size,
+			         buffer_offset,
+			         scan_object,
+			         error ) );
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END:
+			return( libsigscan_scan_tree_node_scan_buffer_bound_to_end(
+			         scan_tree_node,
+			         data_offset,
+			         data_size,
+			         buffer,
+			         buffer_size,
+			         buffer_offset,
+			         scan_object,
+			         error ) );
+
+		case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
+			return( libsigscan_scan_tree_node_scan_buffer_unbound(
+			         scan_tree_node,
+			         data_offset,
+			         data_size,
+			         buffer,
+			         buffer_size,
+			         buffer_offset,
+			         scan_object,
+			         error ) );
+
+		default:
+			break;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported pattern offsets mode.",
+	 function );
+
+	return( -1 );
+}
+
+/* Scans the buffer for a scan object that matches with pattern offsets relative from the start of the data
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libsigscan_scan_tree_node_scan_buffer_bound_to_start(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_scan_object_t **scan_object,
+     libcerror_error_t **error )
 {
 	libsigscan_signature_t *signature = NULL;
-	static char *function             = "libsigscan_scan_tree_node_scan_buffer";
+	static char *function             = "libsigscan_scan_tree_node_scan_buffer_bound_to_start";
 	off64_t pattern_offset            = 0;
 	off64_t scan_offset               = 0;
 	size64_t remaining_data_size      = 0;
@@ -359,19 +491,6 @@ int libsigscan_scan_tree_node_scan_buffer(
 
 		return( -1 );
 	}
-	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported pattern offsets mode.",
-		 function );
-
-		return( -1 );
-	}
 	if( ( data_offset < 0 )
 	 || ( (size64_t) data_offset >= data_size ) )
 	{
@@ -434,7 +553,7 @@ int libsigscan_scan_tree_node_scan_buffer(
 		}
 		scan_offset = (off64_t) ( buffer_offset + scan_tree_node->pattern_offset );
 
-		if( (size64_t) scan_offset >= remaining_data_size )
+		if( scan_tree_node->pattern_offset >= (off64_t) remaining_data_size )
 		{
 			/* If the pattern offset exceeds the data size
 			 * continue with the default scan object if available.
@@ -566,18 +685,11 @@ int libsigscan_scan_tree_node_scan_buffer(
 
 					return( -1 );
 				}
-				if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
-				{
-					pattern_offset = signature->pattern_offset;
-				}
-				else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-				{
-					pattern_offset = data_size - signature->pattern_offset;
-				}
+				pattern_offset = signature->pattern_offset;
 				scan_offset = buffer_offset + ( pattern_offset - data_offset );
 
 				if( ( (size64_t) signature->pattern_size > remaining_data_size )
-				 || ( (size64_t) scan_offset > ( remaining_data_size - signature->pattern_size ) ) )
+				 || ( (size64_t) ( pattern_offset - data_offset ) > ( remaining_data_size - signature->pattern_size ) ) )
 				{
 					/* If the pattern size exceeds the data size were are done scanning.
 					 */
@@ -597,16 +709,31 @@ int libsigscan_scan_tree_node_scan_buffer(
 
 					return( -1 );
 				}
-				if( memory_compare(
-				     &( buffer[ scan_offset ] ),
-				     signature->pattern,
-				     signature->pattern_size ) != 0 )
+				result = libsigscan_signature_match_buffer(
+				          signature,
+				          buffer,
+				          buffer_size,
+				          (size_t) scan_offset,
+				          error );
+
+				if( result == -1 )
 				{
-					result = 0;
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to determine if signature matches buffer.",
+					 function );
 
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
 					break;
 				}
-				scan_offset += data_offset;
+				/* The buffer offset corresponds with the data offset
+				 */
+				scan_offset += data_offset - (off64_t) buffer_offset;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 				if( libcnotify_verbose != 0 )
@@ -630,6 +757,591 @@ int libsigscan_scan_tree_node_scan_buffer(
 	return( result );
 }
 
+/* Scans the buffer for a scan object that matches with pattern offsets relative from the end of the data
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libsigscan_scan_tree_node_scan_buffer_bound_to_end(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_scan_object_t **scan_object,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_scan_tree_node_scan_buffer_bound_to_end";
+	off64_t pattern_offset            = 0;
+	off64_t scan_offset               = 0;
+	size64_t remaining_data_size      = 0;
+	uint8_t byte_value                = 0;
+	uint8_t scan_object_type          = 0;
+	int result                        = 0;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( (size64_t) data_offset >= data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object.",
+		 function );
+
+		return( -1 );
+	}
+	remaining_data_size = data_size - data_offset;
+
+	do
+	{
+		if( buffer_offset >= buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		scan_offset = (off64_t) ( buffer_offset + scan_tree_node->pattern_offset );
+
+		/* The pattern offset is relative to the data offset and can be negative
+		 */
+		if( ( scan_offset < 0 )
+		 || ( scan_tree_node->pattern_offset >= (off64_t) remaining_data_size ) )
+		{
+			/* If the pattern offset is outside the data
+			 * continue with the default scan object if available.
+			 */
+			*scan_object = scan_tree_node->default_scan_object;
+			result       = ( *scan_object != NULL );
+		}
+		else if( scan_offset >= (off64_t) buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid scan offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			byte_value = buffer[ scan_offset ];
+
+			result = libsigscan_scan_tree_node_get_scan_object(
+			          scan_tree_node,
+			          byte_value,
+			          scan_object,
+			          error );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( result == 1 )
+				{
+					libcnotify_printf(
+					 "%s: offset: %" PRIi64 " ",
+					 function,
+					 scan_offset );
+
+					if( scan_tree_node->scan_objects_table[ byte_value ] != NULL )
+					{
+						libcnotify_printf(
+						 "scan object: byte value: 0x%02" PRIx8 "",
+						 byte_value );
+					}
+					else if( scan_tree_node->default_scan_object != NULL )
+					{
+						libcnotify_printf(
+						 "scan object: default" );
+					}
+					else
+					{
+						libcnotify_printf(
+						 "scan object: N/A" );
+					}
+					libcnotify_printf(
+					 ".\n" );
+				}
+			}
+#endif
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan object.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libsigscan_scan_object_get_type(
+			     *scan_object,
+			     &scan_object_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve scan object type.",
+				 function );
+
+				return( -1 );
+			}
+			if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+			{
+				if( libsigscan_scan_object_get_value(
+				     *scan_object,
+				     (intptr_t **) &scan_tree_node,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve scan object value.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
+			{
+				if( libsigscan_scan_object_get_value(
+				     *scan_object,
+				     (intptr_t **) &signature,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve scan object value.",
+					 function );
+
+					return( -1 );
+				}
+				if( signature == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing signature.",
+					 function );
+
+					return( -1 );
+				}
+				if( ( (size64_t) signature->pattern_offset > data_size )
+				 || ( (size64_t) signature->pattern_size > (size64_t) signature->pattern_offset ) )
+				{
+					/* If the pattern is outside the data were are done scanning.
+					 */
+					result = 0;
+
+					break;
+				}
+				pattern_offset = data_size - signature->pattern_offset;
+				scan_offset = buffer_offset + ( pattern_offset - data_offset );
+
+				if( ( scan_offset < 0 )
+				 || ( signature->pattern_size > buffer_size )
+				 || ( (size64_t) scan_offset > ( buffer_size - signature->pattern_size ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid pattern size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				result = libsigscan_signature_match_buffer(
+				          signature,
+				          buffer,
+				          buffer_size,
+				          (size_t) scan_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to determine if signature matches buffer.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+				/* The buffer offset corresponds with the data offset
+				 */
+				scan_offset += data_offset - (off64_t) buffer_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: offset: %" PRIi64 " signature: %s.\n",
+					 function,
+					 scan_offset,
+					 signature->identifier );
+				}
+#endif
+/* TODO add support for unbounded signatures */
+				result = ( scan_offset == pattern_offset );
+
+				break;
+			}
+		}
+	}
+	while( result != 0 );
+
+	return( result );
+}
+
+/* Scans the buffer for a scan object that matches with unbound pattern offsets
+ * The patterns are matched at the buffer offset, which corresponds with the data offset
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libsigscan_scan_tree_node_scan_buffer_unbound(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_scan_object_t **scan_object,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_scan_tree_node_scan_buffer_unbound";
+	off64_t scan_offset               = 0;
+	size64_t remaining_data_size      = 0;
+	uint8_t byte_value                = 0;
+	uint8_t scan_object_type          = 0;
+	int result                        = 0;
+
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( (size64_t) data_offset >= data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The unbound pattern starts at the buffer offset hence only the data
+	 * in the remainder of the buffer can be matched
+	 */
+	remaining_data_size = data_size - data_offset;
+
+	if( remaining_data_size > (size64_t) ( buffer_size - buffer_offset ) )
+	{
+		remaining_data_size = (size64_t) ( buffer_size - buffer_offset );
+	}
+	do
+	{
+		scan_offset = (off64_t) ( buffer_offset + scan_tree_node->pattern_offset );
+
+		if( (size64_t) scan_tree_node->pattern_offset >= remaining_data_size )
+		{
+			/* If the pattern offset exceeds the data size
+			 * continue with the default scan object if available.
+			 */
+			*scan_object = scan_tree_node->default_scan_object;
+			result       = ( *scan_object != NULL );
+		}
+		else if( scan_offset >= (off64_t) buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid scan offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			byte_value = buffer[ scan_offset ];
+
+			result = libsigscan_scan_tree_node_get_scan_object(
+			          scan_tree_node,
+			          byte_value,
+			          scan_object,
+			          error );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( result == 1 )
+				{
+					libcnotify_printf(
+					 "%s: offset: %" PRIi64 " ",
+					 function,
+					 scan_offset );
+
+					if( scan_tree_node->scan_objects_table[ byte_value ] != NULL )
+					{
+						libcnotify_printf(
+						 "scan object: byte value: 0x%02" PRIx8 "",
+						 byte_value );
+					}
+					else if( scan_tree_node->default_scan_object != NULL )
+					{
+						libcnotify_printf(
+						 "scan object: default" );
+					}
+					else
+					{
+						libcnotify_printf(
+						 "scan object: N/A" );
+					}
+					libcnotify_printf(
+					 ".\n" );
+				}
+			}
+#endif
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan object.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libsigscan_scan_object_get_type(
+			     *scan_object,
+			     &scan_object_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve scan object type.",
+				 function );
+
+				return( -1 );
+			}
+			if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+			{
+				if( libsigscan_scan_object_get_value(
+				     *scan_object,
+				     (intptr_t **) &scan_tree_node,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve scan object value.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
+			{
+				if( libsigscan_scan_object_get_value(
+				     *scan_object,
+				     (intptr_t **) &signature,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve scan object value.",
+					 function );
+
+					return( -1 );
+				}
+				if( signature == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing signature.",
+					 function );
+
+					return( -1 );
+				}
+				if( (size64_t) signature->pattern_size > remaining_data_size )
+				{
+					/* If the pattern size exceeds the remaining data size the signature cannot match
+					 */
+					result = 0;
+
+					break;
+				}
+				result = libsigscan_signature_match_buffer(
+				          signature,
+				          buffer,
+				          buffer_size,
+				          buffer_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to determine if signature matches buffer.",
+					 function );
+
+					return( -1 );
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( result != 0 )
+					{
+						libcnotify_printf(
+						 "%s: offset: %" PRIi64 " signature: %s.\n",
+						 function,
+						 data_offset,
+						 signature->identifier );
+					}
+				}
+#endif
+				break;
+			}
+		}
+	}
+	while( result != 0 );
+
+	return( result );
+}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 /* Prints the scan tree node
@@ -58,6 +58,11 @@ int libsigscan_scan_tree_node_free(
      libsigscan_scan_tree_node_t **scan_tree_node,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_node_compare(
+     libsigscan_scan_tree_node_t *first_scan_tree_node,
+     libsigscan_scan_tree_node_t *second_scan_tree_node,
+     libcerror_error_t **error );
+
 int libsigscan_scan_tree_node_set_byte_value(
      libsigscan_scan_tree_node_t *scan_tree_node,
      uint8_t byte_value,
@@ -86,6 +91,36 @@ int libsigscan_scan_tree_node_scan_buffer(
      libsigscan_scan_object_t **scan_object,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_node_scan_buffer_bound_to_start(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_scan_object_t **scan_object,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_node_scan_buffer_bound_to_end(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_scan_object_t **scan_object,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_node_scan_buffer_unbound(
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_scan_object_t **scan_object,
+     libcerror_error_t **error );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 int libsigscan_scan_tree_node_printf(
@@ -0,0 +1,836 @@
+/*
+ * Scan tree statistics functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_object.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_scan_tree_statistics.h"
+#include "libsigscan_signature.h"
+#include "libsigscan_skip_table.h"
+#include "libsigscan_types.h"
+
+/* Creates scan tree statistics
+ * Make sure the value scan_tree_statistics is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_statistics_initialize(
+     libsigscan_scan_tree_statistics_t **scan_tree_statistics,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_initialize";
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_tree_statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics = memory_allocate_structure(
+	                                 libsigscan_internal_scan_tree_statistics_t );
+
+	if( internal_scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan tree statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_scan_tree_statistics,
+	     0,
+	     sizeof( libsigscan_internal_scan_tree_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan tree statistics.",
+		 function );
+
+		memory_free(
+		 internal_scan_tree_statistics );
+
+		return( -1 );
+	}
+	*scan_tree_statistics = (libsigscan_scan_tree_statistics_t *) internal_scan_tree_statistics;
+
+	return( 1 );
+
+on_error:
+	if( internal_scan_tree_statistics != NULL )
+	{
+		memory_free(
+		 internal_scan_tree_statistics );
+	}
+	return( -1 );
+}
+
+/* Frees scan tree statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_statistics_free(
+     libsigscan_scan_tree_statistics_t **scan_tree_statistics,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_free";
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_tree_statistics != NULL )
+	{
+		internal_scan_tree_statistics = (libsigscan_internal_scan_tree_statistics_t *) *scan_tree_statistics;
+		*scan_tree_statistics         = NULL;
+
+		if( internal_scan_tree_statistics->number_of_scan_tree_nodes_per_depth != NULL )
+		{
+			memory_free(
+			 internal_scan_tree_statistics->number_of_scan_tree_nodes_per_depth );
+		}
+		memory_free(
+		 internal_scan_tree_statistics );
+	}
+	return( 1 );
+}
+
+/* Adds a scan tree node and its sub scan tree nodes to the scan tree statistics
+ * A merged scan tree node is added for every scan object that refers to it
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_tree_statistics_add_scan_tree_node(
+     libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     int depth,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t *scan_object = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_internal_scan_tree_statistics_add_scan_tree_node";
+	void *reallocation                    = NULL;
+	uint8_t scan_object_type              = 0;
+	int fan_out                           = 0;
+	int number_of_depths                  = 0;
+	int scan_object_index                 = 0;
+
+	if( internal_scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( depth < 0 )
+	 || ( depth > ( INT_MAX - 16 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( depth >= internal_scan_tree_statistics->number_of_depths )
+	{
+		number_of_depths = depth + 16;
+
+		reallocation = memory_reallocate(
+		                internal_scan_tree_statistics->number_of_scan_tree_nodes_per_depth,
+		                sizeof( int ) * number_of_depths );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize number of scan tree nodes per depth.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_tree_statistics->number_of_scan_tree_nodes_per_depth = (int *) reallocation;
+
+		if( memory_set(
+		     &( internal_scan_tree_statistics->number_of_scan_tree_nodes_per_depth[ internal_scan_tree_statistics->number_of_depths ] ),
+		     0,
+		     sizeof( int ) * ( number_of_depths - internal_scan_tree_statistics->number_of_depths ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear number of scan tree nodes per depth.",
+			 function );
+
+			return( -1 );
+		}
+		internal_scan_tree_statistics->number_of_depths = number_of_depths;
+	}
+	internal_scan_tree_statistics->number_of_scan_tree_nodes_per_depth[ depth ] += 1;
+
+	if( depth > internal_scan_tree_statistics->maximum_depth )
+	{
+		internal_scan_tree_statistics->maximum_depth = depth;
+	}
+	/* The scan object with index 256 is the default scan object
+	 */
+	for( scan_object_index = 0;
+	     scan_object_index <= 256;
+	     scan_object_index++ )
+	{
+		if( scan_object_index < 256 )
+		{
+			scan_object = scan_tree_node->scan_objects_table[ scan_object_index ];
+		}
+		else
+		{
+			scan_object = scan_tree_node->default_scan_object;
+		}
+		if( scan_object == NULL )
+		{
+			continue;
+		}
+		if( scan_object_index < 256 )
+		{
+			fan_out++;
+		}
+		if( libsigscan_scan_object_get_type(
+		     scan_object,
+		     &scan_object_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan object: %d type.",
+			 function,
+			 scan_object_index );
+
+			return( -1 );
+		}
+		if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
+		{
+			signature = (libsigscan_signature_t *) scan_object->value;
+
+			if( signature == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid scan object: %d - missing signature.",
+				 function,
+				 scan_object_index );
+
+				return( -1 );
+			}
+			if( ( internal_scan_tree_statistics->smallest_pattern_size == 0 )
+			 || ( signature->pattern_size < internal_scan_tree_statistics->smallest_pattern_size ) )
+			{
+				internal_scan_tree_statistics->smallest_pattern_size = signature->pattern_size;
+			}
+			if( signature->pattern_size > internal_scan_tree_statistics->largest_pattern_size )
+			{
+				internal_scan_tree_statistics->largest_pattern_size = signature->pattern_size;
+			}
+			continue;
+		}
+		if( scan_object_type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+		{
+			continue;
+		}
+		if( libsigscan_internal_scan_tree_statistics_add_scan_tree_node(
+		     internal_scan_tree_statistics,
+		     (libsigscan_scan_tree_node_t *) scan_object->value,
+		     depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add sub scan tree node of scan object: %d.",
+			 function,
+			 scan_object_index );
+
+			return( -1 );
+		}
+	}
+	if( fan_out > internal_scan_tree_statistics->maximum_fan_out )
+	{
+		internal_scan_tree_statistics->maximum_fan_out = fan_out;
+	}
+	internal_scan_tree_statistics->total_fan_out += fan_out;
+
+	return( 1 );
+}
+
+/* Fills the scan tree statistics from a (built) scan tree
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_statistics_fill(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_fill";
+	size_t skip_value                                                         = 0;
+	uint16_t byte_value                                                       = 0;
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics = (libsigscan_internal_scan_tree_statistics_t *) scan_tree_statistics;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_tree_statistics->number_of_depths != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree statistics - already filled.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics->number_of_scan_tree_nodes        = scan_tree->number_of_scan_tree_nodes;
+	internal_scan_tree_statistics->number_of_merged_scan_tree_nodes = scan_tree->number_of_merged_scan_tree_nodes;
+
+	if( scan_tree->root_node != NULL )
+	{
+		if( libsigscan_internal_scan_tree_statistics_add_scan_tree_node(
+		     internal_scan_tree_statistics,
+		     scan_tree->root_node,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add root scan tree node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libsigscan_scan_tree_get_memory_usage(
+	     scan_tree,
+	     &( internal_scan_tree_statistics->memory_usage ),
+	     &( internal_scan_tree_statistics->saved_memory_usage ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the unbound scan tree has a skip table
+	 */
+	if( scan_tree->skip_table != NULL )
+	{
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			if( libsigscan_skip_table_get_skip_value(
+			     scan_tree->skip_table,
+			     (uint8_t) byte_value,
+			     &skip_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve skip value: 0x%02" PRIx16 ".",
+				 function,
+				 byte_value );
+
+				return( -1 );
+			}
+			internal_scan_tree_statistics->total_skip_value += skip_value;
+		}
+		internal_scan_tree_statistics->has_skip_table = 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of scan tree nodes
+ * The number of scan tree nodes contains the scan tree nodes that remain after merging
+ * the number of merged scan tree nodes contains the identical scan tree nodes that were merged
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_statistics_get_number_of_scan_tree_nodes(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     int *number_of_scan_tree_nodes,
+     int *number_of_merged_scan_tree_nodes,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_get_number_of_scan_tree_nodes";
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics = (libsigscan_internal_scan_tree_statistics_t *) scan_tree_statistics;
+
+	if( number_of_scan_tree_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of scan tree nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_merged_scan_tree_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of merged scan tree nodes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_scan_tree_nodes        = internal_scan_tree_statistics->number_of_scan_tree_nodes;
+	*number_of_merged_scan_tree_nodes = internal_scan_tree_statistics->number_of_merged_scan_tree_nodes;
+
+	return( 1 );
+}
+
+/* Retrieves the maximum depth
+ * The root scan tree node has depth 0
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_statistics_get_maximum_depth(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     int *maximum_depth,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_get_maximum_depth";
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics = (libsigscan_internal_scan_tree_statistics_t *) scan_tree_statistics;
+
+	if( maximum_depth == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum depth.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_depth = internal_scan_tree_statistics->maximum_depth;
+
+	return( 1 );
+}
+
+/* Retrieves the number of scan tree nodes at a specific depth
+ * A merged scan tree node is counted for every scan tree node that refers to it
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_statistics_get_number_of_scan_tree_nodes_at_depth(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     int depth,
+     int *number_of_scan_tree_nodes,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_get_number_of_scan_tree_nodes_at_depth";
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics = (libsigscan_internal_scan_tree_statistics_t *) scan_tree_statistics;
+
+	if( ( depth < 0 )
+	 || ( depth > internal_scan_tree_statistics->maximum_depth ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_scan_tree_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of scan tree nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( depth >= internal_scan_tree_statistics->number_of_depths )
+	{
+		*number_of_scan_tree_nodes = 0;
+	}
+	else
+	{
+		*number_of_scan_tree_nodes = internal_scan_tree_statistics->number_of_scan_tree_nodes_per_depth[ depth ];
+	}
+
+	return( 1 );
+}
+
+/* Retrieves the fan-out
+ * The fan-out of a scan tree node is the number of byte values that have a scan object
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_statistics_get_fan_out(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     int *maximum_fan_out,
+     double *average_fan_out,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_get_fan_out";
+	uint64_t number_of_scan_tree_nodes                                        = 0;
+	int depth                                                                 = 0;
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics = (libsigscan_internal_scan_tree_statistics_t *) scan_tree_statistics;
+
+	if( maximum_fan_out == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum fan-out.",
+		 function );
+
+		return( -1 );
+	}
+	if( average_fan_out == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid average fan-out.",
+		 function );
+
+		return( -1 );
+	}
+	for( depth = 0;
+	     depth < internal_scan_tree_statistics->number_of_depths;
+	     depth++ )
+	{
+		number_of_scan_tree_nodes += internal_scan_tree_statistics->number_of_scan_tree_nodes_per_depth[ depth ];
+	}
+	*maximum_fan_out = internal_scan_tree_statistics->maximum_fan_out;
+
+	if( number_of_scan_tree_nodes == 0 )
+	{
+		*average_fan_out = 0.0;
+	}
+	else
+	{
+		*average_fan_out = (double) internal_scan_tree_statistics->total_fan_out / (double) number_of_scan_tree_nodes;
+	}
+
+	return( 1 );
+}
+
+/* Retrieves the memory usage
+ * The saved memory usage contains the memory saved by merging identical scan tree nodes
+ * and scan objects
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_statistics_get_memory_usage(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     size64_t *memory_usage,
+     size64_t *saved_memory_usage,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_get_memory_usage";
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics = (libsigscan_internal_scan_tree_statistics_t *) scan_tree_statistics;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( saved_memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid saved memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_usage       = internal_scan_tree_statistics->memory_usage;
+	*saved_memory_usage = internal_scan_tree_statistics->saved_memory_usage;
+
+	return( 1 );
+}
+
+/* Retrieves the smallest and largest pattern sizes
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_statistics_get_pattern_sizes(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     size_t *smallest_pattern_size,
+     size_t *largest_pattern_size,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_get_pattern_sizes";
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics = (libsigscan_internal_scan_tree_statistics_t *) scan_tree_statistics;
+
+	if( smallest_pattern_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid smallest pattern size.",
+		 function );
+
+		return( -1 );
+	}
+	if( largest_pattern_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid largest pattern size.",
+		 function );
+
+		return( -1 );
+	}
+	*smallest_pattern_size = internal_scan_tree_statistics->smallest_pattern_size;
+	*largest_pattern_size  = internal_scan_tree_statistics->largest_pattern_size;
+
+	return( 1 );
+}
+
+/* Retrieves the average skip value
+ * The average skip value is the average of the skip values of all byte values
+ * Only the unbound scan tree has a skip table
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libsigscan_scan_tree_statistics_get_average_skip_value(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     double *average_skip_value,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics = NULL;
+	static char *function                                                     = "libsigscan_scan_tree_statistics_get_average_skip_value";
+
+	if( scan_tree_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_tree_statistics = (libsigscan_internal_scan_tree_statistics_t *) scan_tree_statistics;
+
+	if( average_skip_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid average skip value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_tree_statistics->has_skip_table == 0 )
+	{
+		return( 0 );
+	}
+	*average_skip_value = (double) internal_scan_tree_statistics->total_skip_value / 256.0;
+
+	return( 1 );
+}
+
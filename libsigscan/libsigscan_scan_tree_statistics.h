@@ -0,0 +1,168 @@
+/*
+ * Scan tree statistics functions
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBSIGSCAN_SCAN_TREE_STATISTICS_H )
+#define _LIBSIGSCAN_SCAN_TREE_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_extern.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_internal_scan_tree_statistics libsigscan_internal_scan_tree_statistics_t;
+
+struct libsigscan_internal_scan_tree_statistics
+{
+	/* The number of scan tree nodes
+	 */
+	int number_of_scan_tree_nodes;
+
+	/* The number of merged scan tree nodes
+	 */
+	int number_of_merged_scan_tree_nodes;
+
+	/* The maximum depth
+	 */
+	int maximum_depth;
+
+	/* The number of scan tree nodes per depth
+	 */
+	int *number_of_scan_tree_nodes_per_depth;
+
+	/* The number of depths in the number of scan tree nodes per depth
+	 */
+	int number_of_depths;
+
+	/* The maximum fan-out
+	 */
+	int maximum_fan_out;
+
+	/* The sum of the fan-out of all scan tree nodes per depth
+	 */
+	uint64_t total_fan_out;
+
+	/* The memory usage
+	 */
+	size64_t memory_usage;
+
+	/* The saved memory usage
+	 */
+	size64_t saved_memory_usage;
+
+	/* The smallest pattern size
+	 */
+	size_t smallest_pattern_size;
+
+	/* The largest pattern size
+	 */
+	size_t largest_pattern_size;
+
+	/* Value to indicate the scan tree has a skip table
+	 */
+	uint8_t has_skip_table;
+
+	/* The sum of the skip values of all byte values
+	 */
+	uint64_t total_skip_value;
+};
+
+int libsigscan_scan_tree_statistics_initialize(
+     libsigscan_scan_tree_statistics_t **scan_tree_statistics,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_tree_statistics_free(
+     libsigscan_scan_tree_statistics_t **scan_tree_statistics,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_tree_statistics_add_scan_tree_node(
+     libsigscan_internal_scan_tree_statistics_t *internal_scan_tree_statistics,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     int depth,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_statistics_fill(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_tree_statistics_get_number_of_scan_tree_nodes(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     int *number_of_scan_tree_nodes,
+     int *number_of_merged_scan_tree_nodes,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_tree_statistics_get_maximum_depth(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     int *maximum_depth,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_tree_statistics_get_number_of_scan_tree_nodes_at_depth(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     int depth,
+     int *number_of_scan_tree_nodes,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_tree_statistics_get_fan_out(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     int *maximum_fan_out,
+     double *average_fan_out,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_tree_statistics_get_memory_usage(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     size64_t *memory_usage,
+     size64_t *saved_memory_usage,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_tree_statistics_get_pattern_sizes(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     size_t *smallest_pattern_size,
+     size_t *largest_pattern_size,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_tree_statistics_get_average_skip_value(
+     libsigscan_scan_tree_statistics_t *scan_tree_statistics,
+     double *average_skip_value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_SCAN_TREE_STATISTICS_H ) */
+
@@ -25,16 +25,33 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsigscan_byte_value_frequencies.h"
+#include "libsigscan_compiled_source.h"
 #include "libsigscan_definitions.h"
+#include "libsigscan_direct_file_io_handle.h"
 #include "libsigscan_libbfio.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
+#include "libsigscan_libcthreads.h"
 #include "libsigscan_scanner.h"
+#include "libsigscan_scan_object.h"
 #include "libsigscan_scan_state.h"
 #include "libsigscan_scan_tree.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_scan_tree_statistics.h"
 #include "libsigscan_signature.h"
+#include "libsigscan_skip_table.h"
 #include "libsigscan_types.h"
+#include "libsigscan_unused.h"
 
 /* Creates a scanner
  * Make sure the value scanner is referencing, is set to NULL
@@ -51,6 +68,10 @@ int libsigscan_scanner_initialize(
 	libsigscan_internal_scanner_t *internal_scanner = NULL;
 	static char *function                           = "libsigscan_scanner_initialize";
 
+#if defined( HAVE_SYSCONF ) && defined( _SC_LEVEL2_CACHE_SIZE )
+	long cache_size                                 = 0;
+#endif
+
 	if( scanner == NULL )
 	{
 		libcerror_error_set(
@@ -117,8 +138,19 @@ int libsigscan_scanner_initialize(
 
 		goto on_error;
 	}
-	internal_scanner->buffer_size = LIBSIGSCAN_DEFAULT_SCAN_BUFFER_SIZE;
+#if defined( HAVE_SYSCONF ) && defined( _SC_LEVEL2_CACHE_SIZE )
+	cache_size = sysconf(
+	              _SC_LEVEL2_CACHE_SIZE );
 
+	if( cache_size > 0 )
+	{
+		internal_scanner->cache_size = (size_t) cache_size;
+	}
+#endif
+	if( internal_scanner->cache_size == 0 )
+	{
+		internal_scanner->cache_size = LIBSIGSCAN_DEFAULT_CACHE_SIZE;
+	}
 	*scanner = (libsigscan_scanner_t *) internal_scanner;
 
 	return( 1 );
@@ -228,6 +260,22 @@ int libsigscan_scanner_free(
 
 			result = -1;
 		}
+		if( internal_scanner->byte_value_frequencies != NULL )
+		{
+			if( libsigscan_byte_value_frequencies_free(
+			     &( internal_scanner->byte_value_frequencies ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free byte value frequencies.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_scanner );
 	}
@@ -263,6 +311,8 @@ int libsigscan_scanner_signal_abort(
 }
 
 /* Sets the scan buffer size
+ * A scan buffer size of 0 represents that the scan buffer size is determined
+ * automatically, which is the default
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_scanner_set_scan_buffer_size(
@@ -286,14 +336,13 @@ int libsigscan_scanner_set_scan_buffer_size(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	if( ( scan_buffer_size == 0 )
-	 || ( scan_buffer_size > (size_t) SSIZE_MAX ) )
+	if( scan_buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid scan buffer size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid scan buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
@@ -303,6 +352,103 @@ int libsigscan_scanner_set_scan_buffer_size(
 	return( 1 );
 }
 
+/* Sets the number of read buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_set_number_of_read_buffers(
+     libsigscan_scanner_t *scanner,
+     int number_of_read_buffers,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_set_number_of_read_buffers";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( ( number_of_read_buffers < 0 )
+	 || ( number_of_read_buffers > LIBSIGSCAN_MAXIMUM_NUMBER_OF_READ_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner->number_of_read_buffers = number_of_read_buffers;
+
+	return( 1 );
+}
+
+/* Sets if files are read using direct IO
+ * Direct IO bypasses the page cache of the operating system, which is intended
+ * for scanning large files or raw devices that should not evict cached data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_set_direct_io(
+     libsigscan_scanner_t *scanner,
+     int direct_io,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_set_direct_io";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( ( direct_io != 0 )
+	 && ( direct_io != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported direct IO value.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE )
+	if( direct_io != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: direct IO not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_scanner->direct_io = direct_io;
+
+	return( 1 );
+}
+
 /* Adds a signature
  * Returns 1 if successful, 0 if signature already exists or -1 on error
  */
@@ -441,17 +587,19 @@ on_error:
 	return( -1 );
 }
 
-/* Starts the scan
+/* Updates the byte value frequencies with sample data
+ * The byte value frequencies are used by libsigscan_scanner_scan_start to build
+ * scan trees that first test the byte values that are least frequent in the sample data
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_scan_start(
+int libsigscan_scanner_update_byte_value_frequencies(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scanner_t *internal_scanner = NULL;
-	static char *function                           = "libsigscan_scanner_scan_start";
-	int result                                      = 0;
+	static char *function                           = "libsigscan_scanner_update_byte_value_frequencies";
 
 	if( scanner == NULL )
 	{
@@ -466,133 +614,46 @@ int libsigscan_scanner_scan_start(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	if( internal_scanner->header_scan_tree == NULL )
-	{
-		if( libsigscan_scan_tree_initialize(
-		     &( internal_scanner->header_scan_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create header scan tree.",
-			 function );
-
-			return( -1 );
-		}
-		result = libsigscan_scan_tree_build(
-		          internal_scanner->header_scan_tree,
-		          internal_scanner->signatures_list,
-		          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build header scan tree.",
-			 function );
-
-			libsigscan_scan_tree_free(
-			 &( internal_scanner->header_scan_tree ),
-			 NULL );
-
-			return( -1 );
-		}
-	}
-	if( internal_scanner->footer_scan_tree == NULL )
+	if( ( internal_scanner->header_scan_tree != NULL )
+	 || ( internal_scanner->footer_scan_tree != NULL )
+	 || ( internal_scanner->scan_tree != NULL ) )
 	{
-		if( libsigscan_scan_tree_initialize(
-		     &( internal_scanner->footer_scan_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create footer scan tree.",
-			 function );
-
-			return( -1 );
-		}
-		result = libsigscan_scan_tree_build(
-		          internal_scanner->footer_scan_tree,
-		          internal_scanner->signatures_list,
-		          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build footer scan tree.",
-			 function );
-
-			libsigscan_scan_tree_free(
-			 &( internal_scanner->footer_scan_tree ),
-			 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scan tree already set.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-#ifdef TODO_UNBOUND_SUPPORT
-	if( internal_scanner->scan_tree == NULL )
+	if( internal_scanner->byte_value_frequencies == NULL )
 	{
-		if( libsigscan_scan_tree_initialize(
-		     &( internal_scanner->scan_tree ),
+		if( libsigscan_byte_value_frequencies_initialize(
+		     &( internal_scanner->byte_value_frequencies ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create scan tree.",
-			 function );
-
-			return( -1 );
-		}
-		result = libsigscan_scan_tree_build(
-		          internal_scanner->scan_tree,
-		          internal_scanner->signatures_list,
-		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build scan tree.",
+			 "%s: unable to create byte value frequencies.",
 			 function );
 
-			libsigscan_scan_tree_free(
-			 &( internal_scanner->scan_tree ),
-			 NULL );
-
 			return( -1 );
 		}
 	}
-#endif /* TODO_UNBOUND_SUPPORT */
-
-	if( libsigscan_scan_state_start(
-	     scan_state,
-	     internal_scanner->header_scan_tree,
-	     internal_scanner->footer_scan_tree,
-	     internal_scanner->scan_tree,
-	     internal_scanner->buffer_size,
+	if( libsigscan_byte_value_frequencies_update(
+	     internal_scanner->byte_value_frequencies,
+	     buffer,
+	     buffer_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
+		 "%s: unable to update byte value frequencies.",
 		 function );
 
 		return( -1 );
@@ -600,15 +661,26 @@ int libsigscan_scanner_scan_start(
 	return( 1 );
 }
 
-/* Stops the scan
+/* Retrieves the memory usage
+ * The memory usage contains the signatures and the scan trees built by libsigscan_scanner_scan_start
+ * The saved memory usage contains the memory saved by merging identical scan tree nodes
+ * and scan objects of the scan trees
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_scan_stop(
+int libsigscan_scanner_get_memory_usage(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
+     size64_t *memory_usage,
+     size64_t *saved_memory_usage,
      libcerror_error_t **error )
 {
-	static char *function = "libsigscan_scanner_scan_stop";
+	libcdata_list_element_t *list_element           = NULL;
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	libsigscan_scan_tree_t *scan_trees[ 3 ];
+	libsigscan_signature_t *signature               = NULL;
+	static char *function                           = "libsigscan_scanner_get_memory_usage";
+	size64_t scan_tree_memory_usage                 = 0;
+	size64_t scan_tree_saved_memory_usage           = 0;
+	int scan_tree_index                             = 0;
 
 	if( scanner == NULL )
 	{
@@ -621,170 +693,230 @@ int libsigscan_scanner_scan_stop(
 
 		return( -1 );
 	}
-	if( libsigscan_scan_state_stop(
-	     scan_state,
-	     error ) != 1 )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( memory_usage == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Scans a buffer
- * Returns 1 if successful or -1 on error
- */
-int libsigscan_scanner_scan_buffer(
-     libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     const uint8_t *buffer,
-     size_t buffer_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libsigscan_scanner_scan_buffer";
-
-	if( scanner == NULL )
+	if( saved_memory_usage == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scanner.",
+		 "%s: invalid saved memory usage.",
 		 function );
 
 		return( -1 );
 	}
-	if( libsigscan_scan_state_scan_buffer(
-	     scan_state,
-	     buffer,
-	     buffer_size,
+	*memory_usage       = sizeof( libsigscan_internal_scanner_t );
+	*saved_memory_usage = 0;
+
+	if( internal_scanner->byte_value_frequencies != NULL )
+	{
+		*memory_usage += sizeof( libsigscan_byte_value_frequencies_t );
+	}
+
+	if( libcdata_list_get_first_element(
+	     internal_scanner->signatures_list,
+	     &list_element,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to scan buffer.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first signatures list element.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Scans a file
- * Returns 1 if successful or -1 on error
- */
-int libsigscan_scanner_scan_file(
-     libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     const char *filename,
-     libcerror_error_t **error )
-{
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libsigscan_scanner_scan_file";
-	size_t filename_length           = 0;
-
-	if( scanner == NULL )
+	while( list_element != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scanner.",
-		 function );
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		*memory_usage += sizeof( libsigscan_signature_t ) + signature->identifier_size + signature->pattern_size;
+
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next signatures list element.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( filename == NULL )
+	scan_trees[ 0 ] = internal_scanner->header_scan_tree;
+	scan_trees[ 1 ] = internal_scanner->footer_scan_tree;
+	scan_trees[ 2 ] = internal_scanner->scan_tree;
+
+	for( scan_tree_index = 0;
+	     scan_tree_index < 3;
+	     scan_tree_index++ )
+	{
+		if( scan_trees[ scan_tree_index ] == NULL )
+		{
+			continue;
+		}
+		if( libsigscan_scan_tree_get_memory_usage(
+		     scan_trees[ scan_tree_index ],
+		     &scan_tree_memory_usage,
+		     &scan_tree_saved_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan tree: %d memory usage.",
+			 function,
+			 scan_tree_index );
+
+			return( -1 );
+		}
+		*memory_usage       += scan_tree_memory_usage;
+		*saved_memory_usage += scan_tree_saved_memory_usage;
+	}
+	return( 1 );
+}
+
+/* Retrieves the statistics of a specific scan tree
+ * The scan trees are built by libsigscan_scanner_scan_start
+ * Returns 1 if successful, 0 if the scan tree has not been built or -1 on error
+ */
+int libsigscan_scanner_get_statistics(
+     libsigscan_scanner_t *scanner,
+     int scan_tree_type,
+     libsigscan_scan_tree_statistics_t **scan_tree_statistics,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	libsigscan_scan_tree_t *scan_tree               = NULL;
+	static char *function                           = "libsigscan_scanner_get_statistics";
+
+	if( scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid scanner.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	switch( scan_tree_type )
+	{
+		case LIBSIGSCAN_SCAN_TREE_TYPE_HEADER:
+			scan_tree = internal_scanner->header_scan_tree;
+			break;
+
+		case LIBSIGSCAN_SCAN_TREE_TYPE_FOOTER:
+			scan_tree = internal_scanner->footer_scan_tree;
+			break;
+
+		case LIBSIGSCAN_SCAN_TREE_TYPE_UNBOUND:
+			scan_tree = internal_scanner->scan_tree;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported scan tree type.",
+			 function );
+
+			return( -1 );
+	}
+	if( scan_tree_statistics == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree statistics.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	if( *scan_tree_statistics != NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree statistics value already set.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-	filename_length = narrow_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+	if( scan_tree == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
+		return( 0 );
 	}
-	if( libsigscan_scanner_scan_file_io_handle(
-	     scanner,
-	     scan_state,
-	     file_io_handle,
+	if( libsigscan_scan_tree_statistics_initialize(
+	     scan_tree_statistics,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan tree statistics.",
+		 function );
 
 		goto on_error;
 	}
-	if( libbfio_handle_free(
-	     &file_io_handle,
+	if( libsigscan_scan_tree_statistics_fill(
+	     *scan_tree_statistics,
+	     scan_tree,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill scan tree statistics.",
 		 function );
 
 		goto on_error;
@@ -792,31 +924,36 @@ int libsigscan_scanner_scan_file(
 	return( 1 );
 
 on_error:
-	if( file_io_handle != NULL )
+	if( *scan_tree_statistics != NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
+		libsigscan_scan_tree_statistics_free(
+		 scan_tree_statistics,
 		 NULL );
 	}
 	return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Scans a file
+/* Compiles the scan trees into C source code
+ * The header and footer scan trees are written as scan functions named
+ * prefix_scan_header and prefix_scan_footer
+ * Both functions are always written, the function of a scan tree without
+ * signatures returns NULL
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_scan_file_wide(
-     libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     const wchar_t *filename,
+int libsigscan_internal_scanner_compile_source(
+     libsigscan_internal_scanner_t *internal_scanner,
+     const char *prefix,
+     size_t prefix_length,
+     libsigscan_compiled_source_t **compiled_source,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libsigscan_scanner_scan_file_wide";
-	size_t filename_length           = 0;
+	libsigscan_scan_tree_t *scan_trees[ 2 ];
 
-	if( scanner == NULL )
+	static char *function = "libsigscan_internal_scanner_compile_source";
+	size_t prefix_index   = 0;
+	int scan_tree_index   = 0;
+
+	if( internal_scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -827,133 +964,163 @@ int libsigscan_scanner_scan_file_wide(
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	if( prefix == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid prefix.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( ( prefix_length == 0 )
+	 || ( prefix_length > 128 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid prefix length value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	/* The prefix is used in the function names hence it must be a C identifier
+	 */
+	for( prefix_index = 0;
+	     prefix_index < prefix_length;
+	     prefix_index++ )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		if( ( ( prefix[ prefix_index ] < 'A' )
+		  ||  ( prefix[ prefix_index ] > 'Z' ) )
+		 && ( ( prefix[ prefix_index ] < 'a' )
+		  ||  ( prefix[ prefix_index ] > 'z' ) )
+		 && ( ( prefix_index == 0 )
+		  ||  ( prefix[ prefix_index ] < '0' )
+		  ||  ( prefix[ prefix_index ] > '9' ) )
+		 && ( prefix[ prefix_index ] != '_' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in prefix at index: %" PRIzd ".",
+			 function,
+			 prefix_index );
 
-		goto on_error;
+			return( -1 );
+		}
 	}
-#endif
-	filename_length = wide_string_length(
-	                   filename );
+	if( compiled_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled source.",
+		 function );
 
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
+		return( -1 );
+	}
+	if( libsigscan_internal_scanner_build_scan_trees(
+	     internal_scanner,
 	     error ) != 1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build scan trees.",
+		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_scanner_scan_file_io_handle(
-	     scanner,
-	     scan_state,
-	     file_io_handle,
+	if( libsigscan_compiled_source_initialize(
+	     compiled_source,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compiled source.",
+		 function );
 
 		goto on_error;
 	}
-	if( libbfio_handle_free(
-	     &file_io_handle,
+	if( libsigscan_compiled_source_append_preamble(
+	     *compiled_source,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append preamble.",
 		 function );
 
 		goto on_error;
 	}
+	scan_trees[ 0 ] = internal_scanner->header_scan_tree;
+	scan_trees[ 1 ] = internal_scanner->footer_scan_tree;
+
+	for( scan_tree_index = 0;
+	     scan_tree_index < 2;
+	     scan_tree_index++ )
+	{
+		if( scan_trees[ scan_tree_index ] == NULL )
+		{
+			continue;
+		}
+		if( libsigscan_compiled_source_append_scan_tree(
+		     *compiled_source,
+		     scan_trees[ scan_tree_index ],
+		     prefix,
+		     prefix_length,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan tree: %d.",
+			 function,
+			 scan_tree_index );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
-	if( file_io_handle != NULL )
+	if( *compiled_source != NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
+		libsigscan_compiled_source_free(
+		 compiled_source,
 		 NULL );
 	}
 	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Scans a file using a Basic File IO (bfio) handle
+/* Retrieves the size of the compiled source
+ * The compiled source is C source code that implements the header and footer
+ * scan trees as scan functions named prefix_scan_header and prefix_scan_footer
+ * Both functions are always written, the function of a scan tree without
+ * signatures returns NULL
+ * The size includes the end-of-string character
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_scan_file_io_handle(
+int libsigscan_scanner_get_compiled_source_size(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     libbfio_handle_t *file_io_handle,
+     const char *prefix,
+     size_t prefix_length,
+     size_t *source_size,
      libcerror_error_t **error )
 {
-	libsigscan_internal_scanner_t *internal_scanner = NULL;
-	uint8_t *buffer                                 = NULL;
-	static char *function                           = "libsigscan_scanner_scan_file_io_handle";
-	size64_t file_size                              = 0;
-	uint64_t footer_range_end                       = 0;
-	uint64_t footer_range_size                      = 0;
-	uint64_t footer_range_start                     = 0;
-	uint64_t header_range_end                       = 0;
-	uint64_t header_range_size                      = 0;
-	uint64_t header_range_start                     = 0;
-	size_t buffer_size                              = 0;
-	size_t read_size                                = 0;
-	ssize_t read_count                              = 0;
-	int file_io_handle_is_open                      = 0;
-	int has_footer_range                            = 0;
-	int has_header_range                            = 0;
-	int result                                      = 0;
+	libsigscan_compiled_source_t *compiled_source = NULL;
+	static char *function                         = "libsigscan_scanner_get_compiled_source_size";
 
 	if( scanner == NULL )
 	{
@@ -966,349 +1133,3281 @@ int libsigscan_scanner_scan_file_io_handle(
 
 		return( -1 );
 	}
-	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
-
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
-
-	if( file_io_handle_is_open == -1 )
+	if( source_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source size.",
 		 function );
 
-		goto on_error;
-	}
-	else if( file_io_handle_is_open == 0 )
-	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     LIBBFIO_ACCESS_FLAG_READ,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
-
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
+	if( libsigscan_internal_scanner_compile_source(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     prefix,
+	     prefix_length,
+	     &compiled_source,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compile source.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_scan_state_set_data_size(
-	     scan_state,
-	     file_size,
+	*source_size = compiled_source->string_size;
+
+	if( libsigscan_compiled_source_free(
+	     &compiled_source,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set data size.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compiled source.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_scanner_scan_start(
-	     scanner,
-	     scan_state,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( compiled_source != NULL )
+	{
+		libsigscan_compiled_source_free(
+		 &compiled_source,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the compiled source
+ * The compiled source is C source code that implements the header and footer
+ * scan trees as scan functions named prefix_scan_header and prefix_scan_footer
+ * Both functions are always written, the function of a scan tree without
+ * signatures returns NULL
+ * The size should include the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_get_compiled_source(
+     libsigscan_scanner_t *scanner,
+     const char *prefix,
+     size_t prefix_length,
+     char *source,
+     size_t source_size,
+     libcerror_error_t **error )
+{
+	libsigscan_compiled_source_t *compiled_source = NULL;
+	static char *function                         = "libsigscan_scanner_get_compiled_source";
+
+	if( scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_scanner->header_scan_tree == NULL )
+	if( source == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid sacnner - missing header scan tree.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_scanner->footer_scan_tree == NULL )
+	if( source_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid sacnner - missing footer scan tree.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid source size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libsigscan_scan_state_get_buffer_size(
-	     scan_state,
-	     &buffer_size,
+	if( libsigscan_internal_scanner_compile_source(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     prefix,
+	     prefix_length,
+	     &compiled_source,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to retrieve scan buffer size.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compile source.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( buffer_size == 0 )
-	 || ( buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( source_size < compiled_source->string_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid buffer size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid source size value too small.",
 		 function );
 
 		goto on_error;
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
+	if( memory_copy(
+	     source,
+	     compiled_source->string,
+	     compiled_source->string_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create scan buffer.",
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
 		 function );
 
 		goto on_error;
 	}
-	result = libsigscan_scan_state_get_header_range(
-	          scan_state,
-	          &header_range_start,
-	          &header_range_end,
-	          &header_range_size,
-	          error );
-
-	if( result == -1 )
+	if( libsigscan_compiled_source_free(
+	     &compiled_source,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve header range.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compiled source.",
 		 function );
 
 		goto on_error;
 	}
-	has_header_range = result;
+	return( 1 );
 
-	result = libsigscan_scan_state_get_footer_range(
-	          scan_state,
-	          &footer_range_start,
-	          &footer_range_end,
-	          &footer_range_size,
-	          error );
+on_error:
+	if( compiled_source != NULL )
+	{
+		libsigscan_compiled_source_free(
+		 &compiled_source,
+		 NULL );
+	}
+	return( -1 );
+}
 
-	if( result == -1 )
+/* Builds the scan trees that have not been built yet
+ * If multi-threading is supported the scan trees are built concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_build_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_build_values_t build_values[ 3 ];
+	libsigscan_scan_tree_t **scan_trees[ 3 ];
+	int pattern_offsets_modes[ 3 ];
+
+	static char *function    = "libsigscan_internal_scanner_build_scan_trees";
+	int number_of_scan_trees = 3;
+	int scan_tree_index      = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *build_threads[ 3 ] = { NULL, NULL, NULL };
+#endif
+
+	if( internal_scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve footer range.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	has_footer_range = result;
+	if( memory_set(
+	     build_values,
+	     0,
+	     sizeof( libsigscan_scan_tree_build_values_t ) * 3 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear build values.",
+		 function );
 
-	if( has_footer_range != 0 )
+		return( -1 );
+	}
+	scan_trees[ 0 ] = &( internal_scanner->header_scan_tree );
+	scan_trees[ 1 ] = &( internal_scanner->footer_scan_tree );
+	scan_trees[ 2 ] = &( internal_scanner->scan_tree );
+
+	pattern_offsets_modes[ 0 ] = LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START;
+	pattern_offsets_modes[ 1 ] = LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END;
+	pattern_offsets_modes[ 2 ] = LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND;
+
+	for( scan_tree_index = 0;
+	     scan_tree_index < number_of_scan_trees;
+	     scan_tree_index++ )
 	{
-		if( footer_range_start < header_range_start )
+		if( *( scan_trees[ scan_tree_index ] ) != NULL )
+		{
+			continue;
+		}
+		if( libsigscan_scan_tree_initialize(
+		     scan_trees[ scan_tree_index ],
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid footer range value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan tree: %d.",
+			 function,
+			 scan_tree_index );
 
 			goto on_error;
 		}
-		if( ( footer_range_start >= header_range_start )
-		 && ( footer_range_start <= header_range_end ) )
+		build_values[ scan_tree_index ].scan_tree              = *( scan_trees[ scan_tree_index ] );
+		build_values[ scan_tree_index ].signatures_list        = internal_scanner->signatures_list;
+		build_values[ scan_tree_index ].byte_value_frequencies = internal_scanner->byte_value_frequencies;
+		build_values[ scan_tree_index ].pattern_offsets_mode   = pattern_offsets_modes[ scan_tree_index ];
+	}
+	/* The scan trees only share the signatures and the byte value frequencies
+	 * which are not modified while building
+	 */
+	for( scan_tree_index = 0;
+	     scan_tree_index < number_of_scan_trees;
+	     scan_tree_index++ )
+	{
+		if( build_values[ scan_tree_index ].scan_tree == NULL )
 		{
-			/* The footer range is encapsulated in the header range
-			 */
-			if( footer_range_end <= header_range_end )
-			{
-				has_footer_range = 0;
-			}
-			/* The footer range overlaps the header range at the end
-			 */
-			else if( footer_range_end > header_range_end )
-			{
-				header_range_end = footer_range_end;
-				has_footer_range = 0;
-			}
+			continue;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_thread_create(
+		     &( build_threads[ scan_tree_index ] ),
+		     NULL,
+		     (int (*)(void *)) &libsigscan_scan_tree_build_callback,
+		     (void *) &( build_values[ scan_tree_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create build thread: %d.",
+			 function,
+			 scan_tree_index );
+
+			goto on_error;
 		}
+#else
+		libsigscan_scan_tree_build_callback(
+		 &( build_values[ scan_tree_index ] ) );
+#endif
 	}
-	if( has_header_range != 0 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( scan_tree_index = 0;
+	     scan_tree_index < number_of_scan_trees;
+	     scan_tree_index++ )
 	{
-		if( header_range_end > file_size )
+		if( build_threads[ scan_tree_index ] == NULL )
 		{
-			header_range_size -= (size64_t) header_range_end - file_size;
-			header_range_end   = (off64_t) file_size;
+			continue;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libcthreads_thread_join(
+		     &( build_threads[ scan_tree_index ] ),
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: scanning range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join build thread: %d.",
 			 function,
-			 header_range_start,
-			 header_range_end );
+			 scan_tree_index );
+
+			goto on_error;
 		}
+	}
 #endif
-		if( header_range_size > 0 )
+	for( scan_tree_index = 0;
+	     scan_tree_index < number_of_scan_trees;
+	     scan_tree_index++ )
+	{
+		if( ( build_values[ scan_tree_index ].scan_tree != NULL )
+		 && ( build_values[ scan_tree_index ].result == -1 ) )
 		{
-			if( libbfio_handle_seek_offset(
-			     file_io_handle,
-			     (off64_t) header_range_start,
-			     SEEK_SET,
-			     error ) == -1 )
+			/* Pass the error of the build thread on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek file header offset: 0x%08" PRIx64 ".",
-				 function,
-				 header_range_start );
+				*error = build_values[ scan_tree_index ].error;
 
-				goto on_error;
+				build_values[ scan_tree_index ].error = NULL;
 			}
-			while( header_range_size > 0 )
-			{
-				if( header_range_size > buffer_size )
-				{
-					read_size = buffer_size;
-				}
-				else
-				{
-					read_size = (size_t) header_range_size;
-				}
-				read_count = libbfio_handle_read_buffer(
-					      file_io_handle,
-					      buffer,
-					      read_size,
-					      error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan tree: %d.",
+			 function,
+			 scan_tree_index );
 
-				if( read_count != (ssize_t) read_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read buffer.",
-					 function );
-
-					goto on_error;
-				}
-				if( libsigscan_scan_state_scan_buffer(
-				     scan_state,
-				     buffer,
-				     read_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to scan buffer.",
-					 function );
-
-					goto on_error;
-				}
-				header_range_size -= read_size;
-			}
+			goto on_error;
 		}
 	}
-/* TODO scan unbound */
-	if( has_footer_range != 0 )
+	return( 1 );
+
+on_error:
+	for( scan_tree_index = 0;
+	     scan_tree_index < number_of_scan_trees;
+	     scan_tree_index++ )
 	{
-		if( footer_range_end > file_size )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( build_threads[ scan_tree_index ] != NULL )
 		{
-			footer_range_size -= (size64_t) footer_range_end - file_size;
-			footer_range_end   = (off64_t) file_size;
+			libcthreads_thread_join(
+			 &( build_threads[ scan_tree_index ] ),
+			 NULL );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+#endif
+		if( build_values[ scan_tree_index ].error != NULL )
 		{
-			libcnotify_printf(
-			 "%s: scanning range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
-			 function,
-			 footer_range_start,
-			 footer_range_end );
+			libcerror_error_free(
+			 &( build_values[ scan_tree_index ].error ) );
 		}
-#endif
-		if( footer_range_size > 0 )
+		if( build_values[ scan_tree_index ].scan_tree != NULL )
 		{
-			if( libbfio_handle_seek_offset(
-			     file_io_handle,
-			     (off64_t) footer_range_start,
-			     SEEK_SET,
-			     error ) == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek file header offset: 0x%08" PRIx64 ".",
-				 function,
-				 footer_range_start );
-
-				goto on_error;
-			}
-/* TODO handle unbound */
-			if( libsigscan_scan_state_flush(
-			     scan_state,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to flush scan state.",
-				 function );
+			libsigscan_scan_tree_free(
+			 scan_trees[ scan_tree_index ],
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Starts the scan
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_start(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	libsigscan_skip_table_t *skip_table             = NULL;
+	static char *function                           = "libsigscan_scanner_scan_start";
+	size_t scan_buffer_size                         = 0;
+	size_t skip_block_size                          = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( libsigscan_internal_scanner_build_scan_trees(
+	     internal_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan trees.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_get_skip_block_size(
+	     scan_state,
+	     &skip_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve skip block size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The skip values are only used by the unbound scan tree, if the scan state
+	 * requests another skip block size a skip table is created for the scan state
+	 */
+	if( ( skip_block_size != 0 )
+	 && ( internal_scanner->scan_tree != NULL )
+	 && ( internal_scanner->scan_tree->skip_table != NULL )
+	 && ( internal_scanner->scan_tree->skip_table->block_size != skip_block_size ) )
+	{
+		if( libsigscan_skip_table_initialize(
+		     &skip_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create skip table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_skip_table_fill(
+		     skip_table,
+		     internal_scanner->scan_tree->signatures_list,
+		     internal_scanner->byte_value_frequencies,
+		     skip_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill skip table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* If the scan buffer size is determined automatically the size of the buffers
+	 * that are read is determined per file
+	 */
+	scan_buffer_size = internal_scanner->buffer_size;
+
+	if( scan_buffer_size == 0 )
+	{
+		scan_buffer_size = LIBSIGSCAN_DEFAULT_SCAN_BUFFER_SIZE;
+	}
+	if( libsigscan_scan_state_start(
+	     scan_state,
+	     internal_scanner->header_scan_tree,
+	     internal_scanner->footer_scan_tree,
+	     internal_scanner->scan_tree,
+	     skip_table,
+	     scan_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( skip_table != NULL )
+	{
+		libsigscan_skip_table_free(
+		 &skip_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Stops the scan
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_stop(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_stop";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_stop(
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_buffer(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_buffer";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_scan_buffer(
+	     scan_state,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans the buffer segments (I/O vector) as if they were a single buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_iovec(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const libsigscan_buffer_segment_t *segments,
+     int number_of_segments,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_iovec";
+	int result            = 0;
+	int segment_index     = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of segments value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The scan state keeps the data needed to match signatures that cross
+	 * the segment boundaries hence every segment is scanned in place
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( segments[ segment_index ].buffer_size == 0 )
+		{
+			continue;
+		}
+		result = libsigscan_scan_state_scan_buffer(
+		          scan_state,
+		          segments[ segment_index ].buffer,
+		          segments[ segment_index ].buffer_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		/* Stop if the data size has been reached
+		 */
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Identifies buffers using the header and footer scan trees
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_identify_buffers(
+     libsigscan_internal_scanner_t *internal_scanner,
+     const uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     libsigscan_identify_result_t *results,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_object_t *scan_object = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	const uint8_t *buffer                 = NULL;
+	static char *function                 = "libsigscan_internal_scanner_identify_buffers";
+	size_t buffer_size                    = 0;
+	uint64_t footer_range_size            = 0;
+	uint64_t footer_range_start           = 0;
+	uint64_t header_range_size            = 0;
+	uint64_t header_range_start           = 0;
+	off64_t data_offset                   = 0;
+	int buffer_index                      = 0;
+	int has_footer_range                  = 0;
+	int has_header_range                  = 0;
+	int result                            = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->header_scan_tree != NULL )
+	{
+		has_header_range = libsigscan_scan_tree_get_spanning_range(
+		                    internal_scanner->header_scan_tree,
+		                    &header_range_start,
+		                    &header_range_size,
+		                    error );
+
+		if( has_header_range == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve header pattern spanning range.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_scanner->footer_scan_tree != NULL )
+	{
+		has_footer_range = libsigscan_scan_tree_get_spanning_range(
+		                    internal_scanner->footer_scan_tree,
+		                    &footer_range_start,
+		                    &footer_range_size,
+		                    error );
+
+		if( has_footer_range == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve footer pattern spanning range.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The scan tree nodes are scanned directly against every buffer
+	 * since the buffer contains all the data no scan state is needed
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		buffer      = buffers[ buffer_index ];
+		buffer_size = buffer_sizes[ buffer_index ];
+
+		results[ buffer_index ].identifier      = NULL;
+		results[ buffer_index ].identifier_size = 0;
+		results[ buffer_index ].offset          = 0;
+
+		if( ( buffer == NULL )
+		 || ( buffer_size == 0 ) )
+		{
+			continue;
+		}
+		if( buffer_size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer: %d size value out of bounds.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		result = 0;
+
+		if( has_header_range != 0 )
+		{
+			data_offset = 0;
+
+			result = libsigscan_scan_tree_node_scan_buffer_bound_to_start(
+			          internal_scanner->header_scan_tree->root_node,
+			          data_offset,
+			          (size64_t) buffer_size,
+			          buffer,
+			          buffer_size,
+			          0,
+			          &scan_object,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan buffer: %d by header scan tree.",
+				 function,
+				 buffer_index );
+
+				return( -1 );
+			}
+		}
+		/* The footer scan tree pattern offsets are relative to range start bytes
+		 * before the end of the data
+		 */
+		if( ( result == 0 )
+		 && ( has_footer_range != 0 )
+		 && ( footer_range_start > 0 )
+		 && ( footer_range_start <= (uint64_t) buffer_size ) )
+		{
+			data_offset = (off64_t) ( buffer_size - (size_t) footer_range_start );
+
+			result = libsigscan_scan_tree_node_scan_buffer_bound_to_end(
+			          internal_scanner->footer_scan_tree->root_node,
+			          data_offset,
+			          (size64_t) buffer_size,
+			          buffer,
+			          buffer_size,
+			          (size_t) data_offset,
+			          &scan_object,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan buffer: %d by footer scan tree.",
+				 function,
+				 buffer_index );
+
+				return( -1 );
+			}
+		}
+		if( result == 0 )
+		{
+			continue;
+		}
+		if( ( scan_object == NULL )
+		 || ( scan_object->type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported scan object.",
+			 function );
+
+			return( -1 );
+		}
+		signature = (libsigscan_signature_t *) scan_object->value;
+
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		results[ buffer_index ].identifier      = signature->identifier;
+		results[ buffer_index ].identifier_size = signature->identifier_size;
+		results[ buffer_index ].offset          = data_offset;
+	}
+	return( 1 );
+}
+
+/* Identifies buffers in a thread
+ * The result and error of the identification are stored in the identify values
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_identify_buffers_callback(
+     libsigscan_scanner_identify_values_t *identify_values )
+{
+	if( identify_values == NULL )
+	{
+		return( -1 );
+	}
+	identify_values->result = libsigscan_internal_scanner_identify_buffers(
+	                           identify_values->internal_scanner,
+	                           identify_values->buffers,
+	                           identify_values->buffer_sizes,
+	                           identify_values->number_of_buffers,
+	                           identify_values->results,
+	                           &( identify_values->error ) );
+
+	return( 1 );
+}
+
+/* Identifies buffers using the header and footer signatures
+ * The buffers are scanned without a scan state, where every buffer is
+ * considered to contain all the data, such as a small file or object
+ * The header signature takes precedence over the footer signature
+ * If number_of_threads is larger than 1 and multi-threading is supported
+ * the buffers are divided over the number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_identify_buffers(
+     libsigscan_scanner_t *scanner,
+     const uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     libsigscan_identify_result_t *results,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner       = NULL;
+	libsigscan_scanner_identify_values_t *identify_values = NULL;
+	static char *function                                 = "libsigscan_scanner_identify_buffers";
+	int buffer_index                                      = 0;
+	int number_of_thread_buffers                          = 0;
+	int thread_index                                      = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t **identify_threads = NULL;
+#endif
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBSIGSCAN_MAXIMUM_NUMBER_OF_IDENTIFY_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_internal_scanner_build_scan_trees(
+	     internal_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan trees.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > number_of_buffers )
+	{
+		number_of_threads = number_of_buffers;
+	}
+#else
+	number_of_threads = 1;
+#endif
+	if( number_of_threads <= 1 )
+	{
+		if( libsigscan_internal_scanner_identify_buffers(
+		     internal_scanner,
+		     buffers,
+		     buffer_sizes,
+		     number_of_buffers,
+		     results,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to identify buffers.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( ( buffers == NULL )
+	 || ( buffer_sizes == NULL )
+	 || ( results == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers, buffer sizes or results.",
+		 function );
+
+		return( -1 );
+	}
+	identify_values = (libsigscan_scanner_identify_values_t *) memory_allocate(
+	                                                            sizeof( libsigscan_scanner_identify_values_t ) * number_of_threads );
+
+	if( identify_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identify values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     identify_values,
+	     0,
+	     sizeof( libsigscan_scanner_identify_values_t ) * number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identify values.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	identify_threads = (libcthreads_thread_t **) memory_allocate(
+	                                              sizeof( libcthreads_thread_t * ) * number_of_threads );
+
+	if( identify_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identify threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     identify_threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identify threads.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The buffers are divided in contiguous parts, one for every thread,
+	 * which only share the scan trees that are not modified while scanning
+	 */
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		number_of_thread_buffers = ( number_of_buffers - buffer_index ) / ( number_of_threads - thread_index );
+
+		identify_values[ thread_index ].internal_scanner  = internal_scanner;
+		identify_values[ thread_index ].buffers           = &( buffers[ buffer_index ] );
+		identify_values[ thread_index ].buffer_sizes      = &( buffer_sizes[ buffer_index ] );
+		identify_values[ thread_index ].number_of_buffers = number_of_thread_buffers;
+		identify_values[ thread_index ].results           = &( results[ buffer_index ] );
+
+		buffer_index += number_of_thread_buffers;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_thread_create(
+		     &( identify_threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &libsigscan_internal_scanner_identify_buffers_callback,
+		     (void *) &( identify_values[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create identify thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( identify_threads[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join identify thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+#endif
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( identify_values[ thread_index ].result == -1 )
+		{
+			/* Pass the error of the identify thread on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = identify_values[ thread_index ].error;
+
+				identify_values[ thread_index ].error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to identify buffers in thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	memory_free(
+	 identify_threads );
+#endif
+	memory_free(
+	 identify_values );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( identify_threads != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( identify_threads[ thread_index ] != NULL )
+			{
+				libcthreads_thread_join(
+				 &( identify_threads[ thread_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 identify_threads );
+	}
+#endif
+	if( identify_values != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( identify_values[ thread_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( identify_values[ thread_index ].error ) );
+			}
+		}
+		memory_free(
+		 identify_values );
+	}
+	return( -1 );
+}
+
+/* Scans a file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                = NULL;
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_scan_file";
+	size_t filename_length                          = 0;
+	size_t io_block_size                            = 0;
+
+#if defined( HAVE_STAT ) && !defined( WINAPI )
+	struct stat file_statistics;
+#endif
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	filename_length = narrow_string_length(
+	                   filename );
+
+#if defined( HAVE_STAT ) && !defined( WINAPI )
+	/* The preferred IO block size is used to determine the size of the buffers
+	 * that are read, if it cannot be determined the scan buffer size is determined
+	 * without it
+	 */
+	if( stat(
+	     filename,
+	     &file_statistics ) == 0 )
+	{
+		if( file_statistics.st_blksize > 0 )
+		{
+			io_block_size = (size_t) file_statistics.st_blksize;
+		}
+	}
+#endif
+#if defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE )
+	if( internal_scanner->direct_io != 0 )
+	{
+		if( libsigscan_direct_file_initialize(
+		     &file_io_handle,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create direct file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     filename_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	if( libsigscan_internal_scanner_scan_file_io_handle(
+	     internal_scanner,
+	     scan_state,
+	     file_io_handle,
+	     io_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Scans a file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file_wide(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                = NULL;
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_scan_file_wide";
+	size_t filename_length                          = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	/* Direct IO is only supported for narrow character filenames
+	 */
+	if( internal_scanner->direct_io != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: direct IO not supported for wide character filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_scan_file_io_handle(
+	     scanner,
+	     scan_state,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads a range of a file into the read buffers in a thread
+ * Every read buffer that is filled is pushed onto the full queue, reading stops
+ * after the read buffer for which reading failed has been pushed or when reading
+ * was aborted, hence the scan thread must stop popping read buffers in both cases
+ * The result and error of reading are stored in the read values
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsigscan_internal_scanner_read_range_callback(
+     libsigscan_scanner_read_values_t *read_values )
+{
+	libsigscan_scanner_read_buffer_t *read_buffer = NULL;
+	static char *function                         = "libsigscan_internal_scanner_read_range_callback";
+	size64_t range_size                           = 0;
+	size_t read_size                              = 0;
+	ssize_t read_count                            = 0;
+	off64_t range_offset                          = 0;
+	int is_aborted                                = 0;
+	int result                                    = 1;
+
+	if( read_values == NULL )
+	{
+		return( -1 );
+	}
+	range_offset = read_values->range_offset;
+	range_size   = read_values->range_size;
+
+	while( range_size > 0 )
+	{
+		if( libcthreads_queue_pop(
+		     read_values->empty_queue,
+		     (intptr_t **) &read_buffer,
+		     &( read_values->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( read_values->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to pop read buffer from empty queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( libcthreads_mutex_grab(
+		     read_values->mutex,
+		     &( read_values->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( read_values->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			is_aborted = read_values->abort;
+
+			if( libcthreads_mutex_release(
+			     read_values->mutex,
+			     &( read_values->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( read_values->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The read buffer is not pushed after an abort since the scan thread
+		 * no longer pops read buffers
+		 */
+		if( is_aborted != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( range_size > read_values->buffer_size )
+		{
+			read_size = read_values->buffer_size;
+		}
+		else
+		{
+			read_size = (size_t) range_size;
+		}
+		if( result == 1 )
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              read_values->file_io_handle,
+			              read_buffer->data,
+			              read_size,
+			              range_offset,
+			              &( read_values->error ) );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 &( read_values->error ),
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 range_offset,
+				 range_offset );
+
+				result = -1;
+			}
+		}
+		read_buffer->data_size = read_size;
+		read_buffer->result    = result;
+
+		if( libcthreads_queue_push(
+		     read_values->full_queue,
+		     (intptr_t *) read_buffer,
+		     &( read_values->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( read_values->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push read buffer onto full queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( result != 1 )
+		{
+			break;
+		}
+		range_offset += (off64_t) read_size;
+		range_size   -= read_size;
+	}
+	if( result == -1 )
+	{
+		if( libcthreads_mutex_grab(
+		     read_values->mutex,
+		     NULL ) == 1 )
+		{
+			read_values->result = -1;
+
+			libcthreads_mutex_release(
+			 read_values->mutex,
+			 NULL );
+		}
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a range of a file using a Basic File IO (bfio) handle and scans it
+ * The range is read ahead by a separate thread into a ring of read buffers
+ * while the previously read buffers are scanned, hence reading and scanning overlap
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_file_io_handle_range_pipelined(
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     size_t buffer_size,
+     int number_of_read_buffers,
+     libcerror_error_t **error )
+{
+	libsigscan_scanner_read_buffer_t *read_buffer  = NULL;
+	libsigscan_scanner_read_buffer_t *read_buffers = NULL;
+	libsigscan_scanner_read_values_t read_values;
+
+	libcthreads_thread_t *read_thread              = NULL;
+	uint8_t *data                                  = NULL;
+	uint8_t *data_allocation                       = NULL;
+	static char *function                          = "libsigscan_internal_scanner_scan_file_io_handle_range_pipelined";
+	size64_t remaining_size                        = 0;
+	size_t aligned_buffer_size                     = 0;
+	int read_buffer_index                          = 0;
+	int result                                     = 1;
+
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_read_buffers < 2 )
+	 || ( number_of_read_buffers > LIBSIGSCAN_MAXIMUM_NUMBER_OF_READ_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The read buffers are aligned to support direct IO
+	 */
+	aligned_buffer_size = buffer_size;
+
+	if( ( aligned_buffer_size % LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT ) != 0 )
+	{
+		aligned_buffer_size += LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT - ( aligned_buffer_size % LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT );
+	}
+	if( aligned_buffer_size > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT ) / number_of_read_buffers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &read_values,
+	     0,
+	     sizeof( libsigscan_scanner_read_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read values.",
+		 function );
+
+		return( -1 );
+	}
+	read_buffers = (libsigscan_scanner_read_buffer_t *) memory_allocate(
+	                                                     sizeof( libsigscan_scanner_read_buffer_t ) * number_of_read_buffers );
+
+	if( read_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffers.",
+		 function );
+
+		goto on_error;
+	}
+	data_allocation = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * ( ( aligned_buffer_size * number_of_read_buffers ) + LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT ) );
+
+	if( data_allocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffers data.",
+		 function );
+
+		goto on_error;
+	}
+	data = data_allocation;
+
+	if( ( (intptr_t) data % LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT ) != 0 )
+	{
+		data += LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT - ( (intptr_t) data % LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT );
+	}
+	if( libcthreads_queue_initialize(
+	     &( read_values.empty_queue ),
+	     number_of_read_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create empty queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( read_values.full_queue ),
+	     number_of_read_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create full queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( read_values.mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	for( read_buffer_index = 0;
+	     read_buffer_index < number_of_read_buffers;
+	     read_buffer_index++ )
+	{
+		read_buffers[ read_buffer_index ].data      = &( data[ aligned_buffer_size * read_buffer_index ] );
+		read_buffers[ read_buffer_index ].data_size = 0;
+		read_buffers[ read_buffer_index ].result    = 0;
+
+		if( libcthreads_queue_push(
+		     read_values.empty_queue,
+		     (intptr_t *) &( read_buffers[ read_buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push read buffer: %d onto empty queue.",
+			 function,
+			 read_buffer_index );
+
+			goto on_error;
+		}
+	}
+	read_values.file_io_handle = file_io_handle;
+	read_values.range_offset   = range_offset;
+	read_values.range_size     = range_size;
+	read_values.buffer_size    = buffer_size;
+	read_values.result         = 1;
+
+	if( libcthreads_thread_create(
+	     &read_thread,
+	     NULL,
+	     (int (*)(void *)) &libsigscan_internal_scanner_read_range_callback,
+	     (void *) &read_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: scanning range: %" PRIi64 " - %" PRIi64 " for signatures.\n",
+		 function,
+		 range_offset,
+		 range_offset + (off64_t) range_size );
+	}
+#endif
+	/* Every part of the range is received as a read buffer until reading fails
+	 */
+	remaining_size = range_size;
+
+	while( remaining_size > 0 )
+	{
+		if( libcthreads_queue_pop(
+		     read_values.full_queue,
+		     (intptr_t **) &read_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to pop read buffer from full queue.",
+			 function );
+
+			read_buffer = NULL;
+
+			goto on_error;
+		}
+		if( read_buffer->result != 1 )
+		{
+			result = -1;
+
+			break;
+		}
+		if( libsigscan_scan_state_scan_buffer(
+		     scan_state,
+		     read_buffer->data,
+		     read_buffer->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			goto on_error;
+		}
+		remaining_size -= read_buffer->data_size;
+
+		if( libcthreads_queue_push(
+		     read_values.empty_queue,
+		     (intptr_t *) read_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push read buffer onto empty queue.",
+			 function );
+
+			goto on_error;
+		}
+		read_buffer = NULL;
+	}
+	/* The read thread stops after the read buffer for which reading failed
+	 */
+	if( libcthreads_thread_join(
+	     &read_thread,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join read thread.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_grab(
+	     read_values.mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_values.result != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     read_values.mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		/* Pass the error of the read thread on to the caller
+		 */
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = read_values.error;
+
+			read_values.error = NULL;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read range.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_free(
+	     &( read_values.mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_free(
+	     &( read_values.full_queue ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free full queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_free(
+	     &( read_values.empty_queue ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free empty queue.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data_allocation );
+
+	memory_free(
+	 read_buffers );
+
+	return( 1 );
+
+on_error:
+	if( read_thread != NULL )
+	{
+		/* The read thread is aborted and the read buffer that is being scanned
+		 * is returned, so that the read thread does not block on the empty queue
+		 */
+		if( libcthreads_mutex_grab(
+		     read_values.mutex,
+		     NULL ) == 1 )
+		{
+			read_values.abort = 1;
+
+			libcthreads_mutex_release(
+			 read_values.mutex,
+			 NULL );
+		}
+		if( read_buffer != NULL )
+		{
+			libcthreads_queue_push(
+			 read_values.empty_queue,
+			 (intptr_t *) read_buffer,
+			 NULL );
+		}
+		libcthreads_thread_join(
+		 &read_thread,
+		 NULL );
+	}
+	if( read_values.error != NULL )
+	{
+		libcerror_error_free(
+		 &( read_values.error ) );
+	}
+	if( read_values.mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( read_values.mutex ),
+		 NULL );
+	}
+	if( read_values.full_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( read_values.full_queue ),
+		 NULL,
+		 NULL );
+	}
+	if( read_values.empty_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( read_values.empty_queue ),
+		 NULL,
+		 NULL );
+	}
+	if( data_allocation != NULL )
+	{
+		memory_free(
+		 data_allocation );
+	}
+	if( read_buffers != NULL )
+	{
+		memory_free(
+		 read_buffers );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Reads a range of a file using a Basic File IO (bfio) handle and scans it
+ * The range is read using positional reads, hence no separate seeks are needed
+ * If the number of read buffers is larger than 1 and the range does not fit
+ * in a single buffer the range is read ahead in a separate thread
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_file_io_handle_range(
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int number_of_read_buffers,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scanner_scan_file_io_handle_range";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_read_buffers > 1 )
+	 && ( range_size > (size64_t) buffer_size ) )
+	{
+		if( libsigscan_internal_scanner_scan_file_io_handle_range_pipelined(
+		     scan_state,
+		     file_io_handle,
+		     range_offset,
+		     range_size,
+		     buffer_size,
+		     number_of_read_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan range using read buffers.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#else
+	LIBSIGSCAN_UNREFERENCED_PARAMETER( number_of_read_buffers )
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: scanning range: %" PRIi64 " - %" PRIi64 " for signatures.\n",
+		 function,
+		 range_offset,
+		 range_offset + (off64_t) range_size );
+	}
+#endif
+	while( range_size > 0 )
+	{
+		if( range_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		else
+		{
+			read_size = (size_t) range_size;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              read_size,
+		              range_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 range_offset,
+			 range_offset );
+
+			return( -1 );
+		}
+		if( libsigscan_scan_state_scan_buffer(
+		     scan_state,
+		     buffer,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		range_offset += (off64_t) read_size;
+		range_size   -= read_size;
+	}
+	return( 1 );
+}
+
+/* Determines the size of the buffers to read and scan data
+ * If the scan buffer size was not set, the size is determined from the size
+ * of the data to read, the preferred IO block size of the file, where 0
+ * represents unknown, and the cache size shared by the read buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_get_read_buffer_size(
+     libsigscan_internal_scanner_t *internal_scanner,
+     size64_t read_size,
+     size_t io_block_size,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libsigscan_internal_scanner_get_read_buffer_size";
+	size_t maximum_buffer_size = 0;
+	size_t safe_buffer_size    = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->buffer_size != 0 )
+	{
+		*buffer_size = internal_scanner->buffer_size;
+
+		return( 1 );
+	}
+	/* The data read is copied into a read buffer before it is scanned, hence
+	 * a quarter of the cache is used per read buffer so that the read buffers
+	 * together with the data they are copied from are still cached when scanned
+	 */
+	maximum_buffer_size = internal_scanner->cache_size / 4;
+
+	if( internal_scanner->number_of_read_buffers > 1 )
+	{
+		maximum_buffer_size /= (size_t) internal_scanner->number_of_read_buffers;
+	}
+	if( maximum_buffer_size < LIBSIGSCAN_MINIMUM_AUTOMATIC_SCAN_BUFFER_SIZE )
+	{
+		maximum_buffer_size = LIBSIGSCAN_MINIMUM_AUTOMATIC_SCAN_BUFFER_SIZE;
+	}
+	else if( maximum_buffer_size > LIBSIGSCAN_MAXIMUM_AUTOMATIC_SCAN_BUFFER_SIZE )
+	{
+		maximum_buffer_size = LIBSIGSCAN_MAXIMUM_AUTOMATIC_SCAN_BUFFER_SIZE;
+	}
+	/* The buffer size is a multiple of the preferred IO block size
+	 */
+	if( ( io_block_size < LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT )
+	 || ( io_block_size > LIBSIGSCAN_MAXIMUM_AUTOMATIC_SCAN_BUFFER_SIZE ) )
+	{
+		io_block_size = LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT;
+	}
+	if( maximum_buffer_size < io_block_size )
+	{
+		safe_buffer_size = io_block_size;
+	}
+	else
+	{
+		safe_buffer_size = maximum_buffer_size - ( maximum_buffer_size % io_block_size );
+	}
+	/* Data that fits in a single buffer is read with a buffer of exactly its size
+	 */
+	if( read_size == 0 )
+	{
+		safe_buffer_size = LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT;
+	}
+	else if( read_size < (size64_t) safe_buffer_size )
+	{
+		safe_buffer_size = (size_t) read_size;
+	}
+	*buffer_size = safe_buffer_size;
+
+	return( 1 );
+}
+
+/* Scans a file using a Basic File IO (bfio) handle
+ * The preferred IO block size of the file is used to determine the read buffer size,
+ * where 0 represents unknown
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_file_io_handle(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     size_t io_block_size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer                                 = NULL;
+	static char *function                           = "libsigscan_internal_scanner_scan_file_io_handle";
+	size64_t data_size                              = 0;
+	size64_t file_size                              = 0;
+	uint64_t footer_range_end                       = 0;
+	uint64_t footer_range_size                      = 0;
+	uint64_t footer_range_start                     = 0;
+	uint64_t header_range_end                       = 0;
+	uint64_t header_range_size                      = 0;
+	uint64_t header_range_start                     = 0;
+	uint64_t range_offset                           = 0;
+	uint64_t read_size                              = 0;
+	off64_t data_origin                             = 0;
+	size_t buffer_size                              = 0;
+	int file_io_handle_is_open                      = 0;
+	int has_footer_range                            = 0;
+	int has_header_range                            = 0;
+	int result                                      = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_get_data_origin(
+	     scan_state,
+	     &data_origin,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data origin.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size64_t) data_origin > file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data origin value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data_size = file_size - (size64_t) data_origin;
+
+	if( libsigscan_scan_state_set_data_size(
+	     scan_state,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_scan_start(
+	     (libsigscan_scanner_t *) internal_scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_scanner->header_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sacnner - missing header scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_scanner->footer_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sacnner - missing footer scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsigscan_scan_state_get_header_range(
+	          scan_state,
+	          &header_range_start,
+	          &header_range_end,
+	          &header_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve header range.",
+		 function );
+
+		goto on_error;
+	}
+	has_header_range = result;
+
+	result = libsigscan_scan_state_get_footer_range(
+	          scan_state,
+	          &footer_range_start,
+	          &footer_range_end,
+	          &footer_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve footer range.",
+		 function );
+
+		goto on_error;
+	}
+	has_footer_range = result;
+
+	if( has_header_range != 0 )
+	{
+		if( header_range_end > data_size )
+		{
+			header_range_end = data_size;
+		}
+		/* The end of the header range is aligned to the read alignment of the file
+		 */
+		range_offset = (uint64_t) data_origin + header_range_end;
+
+		if( ( range_offset % LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT ) != 0 )
+		{
+			range_offset += LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT - ( range_offset % LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT );
+
+			if( range_offset > file_size )
+			{
+				range_offset = file_size;
+			}
+			header_range_end = range_offset - (uint64_t) data_origin;
+		}
+		header_range_size = header_range_end - header_range_start;
+	}
+	if( has_footer_range != 0 )
+	{
+		if( footer_range_start < header_range_start )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid footer range value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( footer_range_end > data_size )
+		{
+			footer_range_end = data_size;
+		}
+		/* The start of the footer range is aligned to the read alignment of the file
+		 */
+		range_offset = (uint64_t) data_origin + footer_range_start;
+
+		range_offset -= range_offset % LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT;
+
+		if( range_offset > (uint64_t) data_origin )
+		{
+			footer_range_start = range_offset - (uint64_t) data_origin;
+		}
+		else
+		{
+			footer_range_start = 0;
+		}
+		if( footer_range_end > footer_range_start )
+		{
+			footer_range_size = footer_range_end - footer_range_start;
+		}
+		else
+		{
+			footer_range_size = 0;
+		}
+		/* The header and footer ranges are read as a single range if they overlap
+		 * or the gap between them is small, which is always the case for small files
+		 */
+		if( ( has_header_range != 0 )
+		 && ( footer_range_start <= ( header_range_end + LIBSIGSCAN_SCAN_FILE_MAXIMUM_GAP_SIZE ) ) )
+		{
+			if( footer_range_end > header_range_end )
+			{
+				header_range_end  = footer_range_end;
+				header_range_size = header_range_end - header_range_start;
+			}
+			has_footer_range = 0;
+		}
+	}
+	/* Unbound signatures can match at any offset hence all the data is scanned
+	 */
+	if( ( internal_scanner->scan_tree != NULL )
+	 && ( internal_scanner->scan_tree->root_node != NULL ) )
+	{
+		header_range_start = 0;
+		header_range_end   = data_size;
+		header_range_size  = data_size;
+		has_header_range   = 1;
+		has_footer_range   = 0;
+	}
+	if( has_header_range != 0 )
+	{
+		read_size = header_range_size;
+	}
+	if( ( has_footer_range != 0 )
+	 && ( footer_range_size > read_size ) )
+	{
+		read_size = footer_range_size;
+	}
+	if( libsigscan_internal_scanner_get_read_buffer_size(
+	     internal_scanner,
+	     (size64_t) read_size,
+	     io_block_size,
+	     &buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read buffer size.",
+		 function );
+
+		goto on_error;
+	}
+	/* A single range is read with a single read if it does not exceed the maximum read size
+	 */
+	if( ( has_header_range != 0 )
+	 && ( has_footer_range == 0 )
+	 && ( header_range_size > (uint64_t) buffer_size )
+	 && ( header_range_size <= LIBSIGSCAN_SCAN_FILE_MAXIMUM_READ_SIZE ) )
+	{
+		buffer_size = (size_t) header_range_size;
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( has_header_range != 0 )
+	 && ( header_range_size > 0 ) )
+	{
+		if( libsigscan_internal_scanner_scan_file_io_handle_range(
+		     scan_state,
+		     file_io_handle,
+		     data_origin + (off64_t) header_range_start,
+		     (size64_t) header_range_size,
+		     buffer,
+		     buffer_size,
+		     internal_scanner->number_of_read_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan header range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( has_footer_range != 0 )
+	 && ( footer_range_size > 0 ) )
+	{
+		if( libsigscan_scan_state_flush(
+		     scan_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush scan state.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_state_set_data_offset(
+		     scan_state,
+		     (off64_t) footer_range_start,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data offset.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_internal_scanner_scan_file_io_handle_range(
+		     scan_state,
+		     file_io_handle,
+		     data_origin + (off64_t) footer_range_start,
+		     (size64_t) footer_range_size,
+		     buffer,
+		     buffer_size,
+		     internal_scanner->number_of_read_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan footer range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scanner_scan_stop(
+	     (libsigscan_scanner_t *) internal_scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+/* TODO set scan state to error ? */
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_scan_file_io_handle";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( libsigscan_internal_scanner_scan_file_io_handle(
+	     internal_scanner,
+	     scan_state,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans extents of a file using a Basic File IO (bfio) handle
+ * The extents are scanned in order of offset where overlapping and adjacent
+ * extents are combined, hence the file is read sequentially
+ * The header and footer signatures are relative to the data origin of the scan state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file_io_handle_extents(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     const libsigscan_extent_t *extents,
+     int number_of_extents,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	libsigscan_extent_t *sorted_extents             = NULL;
+	uint8_t *buffer                                 = NULL;
+	static char *function                           = "libsigscan_scanner_scan_file_io_handle_extents";
+	size64_t data_size                              = 0;
+	size64_t file_size                              = 0;
+	off64_t data_offset                             = 0;
+	off64_t data_origin                             = 0;
+	off64_t extent_end_offset                       = 0;
+	off64_t extent_start_offset                     = 0;
+	size_t buffer_size                              = 0;
+	int extent_index                                = 0;
+	int file_io_handle_is_open                      = -1;
+	int number_of_sorted_extents                    = 0;
+	int sorted_extent_index                         = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_extents < 0 )
+	 || ( (size_t) number_of_extents > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libsigscan_extent_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents > 0 )
+	{
+		sorted_extents = (libsigscan_extent_t *) memory_allocate(
+		                                          sizeof( libsigscan_extent_t ) * number_of_extents );
+
+		if( sorted_extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The extents are sorted by offset using an insertion sort since
+	 * the extents are commonly provided in (nearly) sorted order
+	 */
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( ( extents[ extent_index ].offset < 0 )
+		 || ( extents[ extent_index ].size > (size64_t) ( INT64_MAX - extents[ extent_index ].offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent: %d value out of bounds.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extents[ extent_index ].size == 0 )
+		{
+			continue;
+		}
+		sorted_extent_index = number_of_sorted_extents;
+
+		while( ( sorted_extent_index > 0 )
+		    && ( sorted_extents[ sorted_extent_index - 1 ].offset > extents[ extent_index ].offset ) )
+		{
+			sorted_extents[ sorted_extent_index ] = sorted_extents[ sorted_extent_index - 1 ];
+
+			sorted_extent_index--;
+		}
+		sorted_extents[ sorted_extent_index ] = extents[ extent_index ];
+
+		number_of_sorted_extents++;
+	}
+	/* Overlapping and adjacent extents are combined
+	 */
+	if( number_of_sorted_extents > 1 )
+	{
+		sorted_extent_index = 0;
+
+		for( extent_index = 1;
+		     extent_index < number_of_sorted_extents;
+		     extent_index++ )
+		{
+			extent_start_offset = sorted_extents[ extent_index ].offset;
+			extent_end_offset   = sorted_extents[ sorted_extent_index ].offset + (off64_t) sorted_extents[ sorted_extent_index ].size;
+
+			if( extent_start_offset <= extent_end_offset )
+			{
+				extent_start_offset += (off64_t) sorted_extents[ extent_index ].size;
+
+				if( extent_start_offset > extent_end_offset )
+				{
+					sorted_extents[ sorted_extent_index ].size = (size64_t) ( extent_start_offset - sorted_extents[ sorted_extent_index ].offset );
+				}
+			}
+			else
+			{
+				sorted_extent_index++;
+
+				sorted_extents[ sorted_extent_index ] = sorted_extents[ extent_index ];
+			}
+		}
+		number_of_sorted_extents = sorted_extent_index + 1;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			file_io_handle_is_open = -1;
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_get_data_origin(
+	     scan_state,
+	     &data_origin,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data origin.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size64_t) data_origin > file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data origin value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data_size = file_size - (size64_t) data_origin;
+
+	if( libsigscan_scan_state_set_data_size(
+	     scan_state,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_scan_start(
+	     scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_internal_scanner_get_read_buffer_size(
+	     internal_scanner,
+	     data_size,
+	     0,
+	     &buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read buffer size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data offset of the scan state is relative to the data origin
+	 */
+	data_offset = 0;
+
+	for( extent_index = 0;
+	     extent_index < number_of_sorted_extents;
+	     extent_index++ )
+	{
+		extent_start_offset = sorted_extents[ extent_index ].offset;
+		extent_end_offset   = extent_start_offset + (off64_t) sorted_extents[ extent_index ].size;
+
+		/* Only the part of the extent that is inside the data is scanned
+		 */
+		if( extent_start_offset < data_origin )
+		{
+			extent_start_offset = data_origin;
+		}
+		if( extent_end_offset > (off64_t) file_size )
+		{
+			extent_end_offset = (off64_t) file_size;
+		}
+		if( extent_start_offset >= extent_end_offset )
+		{
+			continue;
+		}
+		/* The data kept for signatures that cross the buffer boundary
+		 * is scanned before continuing at a non-contiguous offset
+		 */
+		if( ( extent_start_offset - data_origin ) != data_offset )
+		{
+			if( libsigscan_scan_state_flush(
+			     scan_state,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to flush scan state.",
+				 function );
 
 				goto on_error;
 			}
+			data_offset = extent_start_offset - data_origin;
+
 			if( libsigscan_scan_state_set_data_offset(
 			     scan_state,
-			     (off64_t) footer_range_start,
+			     data_offset,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1320,52 +4419,28 @@ int libsigscan_scanner_scan_file_io_handle(
 
 				goto on_error;
 			}
-/* TODO handle unbound */
-			while( footer_range_size > 0 )
-			{
-				if( footer_range_size > buffer_size )
-				{
-					read_size = buffer_size;
-				}
-				else
-				{
-					read_size = (size_t) footer_range_size;
-				}
-				read_count = libbfio_handle_read_buffer(
-					      file_io_handle,
-					      buffer,
-					      read_size,
-					      error );
-
-				if( read_count != (ssize_t) read_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read buffer.",
-					 function );
-
-					goto on_error;
-				}
-				if( libsigscan_scan_state_scan_buffer(
-				     scan_state,
-				     buffer,
-				     read_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to scan buffer.",
-					 function );
-
-					goto on_error;
-				}
-				footer_range_size -= read_size;
-			}
 		}
+		if( libsigscan_internal_scanner_scan_file_io_handle_range(
+		     scan_state,
+		     file_io_handle,
+		     extent_start_offset,
+		     (size64_t) ( extent_end_offset - extent_start_offset ),
+		     buffer,
+		     buffer_size,
+		     internal_scanner->number_of_read_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		data_offset = extent_end_offset - data_origin;
 	}
 	if( libsigscan_scanner_scan_stop(
 	     scanner,
@@ -1386,6 +4461,13 @@ int libsigscan_scanner_scan_file_io_handle(
 
 	buffer = NULL;
 
+	if( sorted_extents != NULL )
+	{
+		memory_free(
+		 sorted_extents );
+
+		sorted_extents = NULL;
+	}
 	if( file_io_handle_is_open == 0 )
 	{
 		if( libbfio_handle_close(
@@ -1405,12 +4487,16 @@ int libsigscan_scanner_scan_file_io_handle(
 	return( 1 );
 
 on_error:
-/* TODO set scan state to error ? */
 	if( buffer != NULL )
 	{
 		memory_free(
 		 buffer );
 	}
+	if( sorted_extents != NULL )
+	{
+		memory_free(
+		 sorted_extents );
+	}
 	if( file_io_handle_is_open == 0 )
 	{
 		libbfio_handle_close(
@@ -1420,3 +4506,436 @@ on_error:
 	return( -1 );
 }
 
+/* Scans a file in a thread and calls the callback function with its results
+ * The value contains a pointer to the filename in the filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_files_callback(
+     intptr_t *value,
+     libsigscan_scanner_scan_files_values_t *scan_files_values )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	int is_aborted                      = 0;
+	int file_index                      = 0;
+	int file_result                     = 1;
+	int result                          = 1;
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	if( scan_files_values == NULL )
+	{
+		return( -1 );
+	}
+	file_index = (int) ( (const char **) value - scan_files_values->filenames );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_files_values->callback_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     scan_files_values->callback_mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+#endif
+	is_aborted = scan_files_values->abort;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_files_values->callback_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     scan_files_values->callback_mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+#endif
+	/* Files that are queued after an abort are not scanned
+	 */
+	if( ( is_aborted != 0 )
+	 || ( scan_files_values->internal_scanner->abort != 0 ) )
+	{
+		return( 1 );
+	}
+	if( libsigscan_scan_state_initialize(
+	     &scan_state,
+	     &error ) != 1 )
+	{
+		file_result = -1;
+	}
+	else if( libsigscan_scanner_scan_file(
+	          (libsigscan_scanner_t *) scan_files_values->internal_scanner,
+	          scan_state,
+	          scan_files_values->filenames[ file_index ],
+	          &error ) != 1 )
+	{
+		file_result = -1;
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_files_values->callback_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     scan_files_values->callback_mutex,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+#endif
+	if( ( result == 1 )
+	 && ( scan_files_values->abort == 0 ) )
+	{
+		if( scan_files_values->callback_function(
+		     file_index,
+		     file_result,
+		     scan_state,
+		     scan_files_values->callback_function_arguments ) != 1 )
+		{
+			scan_files_values->callback_file_index = file_index;
+			scan_files_values->abort               = 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( result == 1 )
+	 && ( scan_files_values->callback_mutex != NULL ) )
+	{
+		if( libcthreads_mutex_release(
+		     scan_files_values->callback_mutex,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+#endif
+	if( scan_state != NULL )
+	{
+		if( libsigscan_scan_state_free(
+		     &scan_state,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Scans files
+ * Every file is scanned with its own scan state, which is passed to the callback
+ * function together with the index of the file and the result of scanning it,
+ * 1 if successful or -1 on error. The scan state is freed after the callback
+ * function returns. If the callback function does not return 1 scanning the
+ * files is aborted.
+ * If number_of_threads is larger than 1 and multi-threading is supported
+ * the files are scanned by a thread pool, that keeps multiple files in flight,
+ * in which case the callback function is called in the order in which the
+ * files complete, one file at a time
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_files(
+     libsigscan_scanner_t *scanner,
+     const char **filenames,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            int file_result,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_function_arguments ),
+     void *callback_function_arguments,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner  = NULL;
+	libsigscan_scanner_scan_files_values_t scan_files_values;
+
+	static char *function                            = "libsigscan_scanner_scan_files";
+	int file_index                                   = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool           = NULL;
+	int maximum_number_of_queued_files               = 0;
+#endif
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of files value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBSIGSCAN_MAXIMUM_NUMBER_OF_SCAN_FILES_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		if( filenames[ file_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid filename: %d.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+	}
+	if( memory_set(
+	     &scan_files_values,
+	     0,
+	     sizeof( libsigscan_scanner_scan_files_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan files values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The scan trees are built before the files are scanned since they
+	 * are shared by the scan threads
+	 */
+	if( libsigscan_internal_scanner_build_scan_trees(
+	     internal_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan trees.",
+		 function );
+
+		return( -1 );
+	}
+	scan_files_values.internal_scanner            = internal_scanner;
+	scan_files_values.filenames                   = filenames;
+	scan_files_values.callback_function           = callback_function;
+	scan_files_values.callback_function_arguments = callback_function_arguments;
+	scan_files_values.callback_file_index         = -1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > number_of_files )
+	{
+		number_of_threads = number_of_files;
+	}
+#else
+	number_of_threads = 1;
+#endif
+	if( number_of_threads <= 1 )
+	{
+		for( file_index = 0;
+		     file_index < number_of_files;
+		     file_index++ )
+		{
+			if( libsigscan_internal_scanner_scan_files_callback(
+			     (intptr_t *) &( filenames[ file_index ] ),
+			     &scan_files_values ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan file: %d.",
+				 function,
+				 file_index );
+
+				return( -1 );
+			}
+			if( scan_files_values.abort != 0 )
+			{
+				break;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	else
+	{
+		if( libcthreads_mutex_initialize(
+		     &( scan_files_values.callback_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create callback mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* The queue of the thread pool is kept small so that the files
+		 * are pushed as the threads complete them
+		 */
+		maximum_number_of_queued_files = number_of_threads * LIBSIGSCAN_SCAN_FILES_QUEUE_SIZE_PER_THREAD;
+
+		if( maximum_number_of_queued_files > number_of_files )
+		{
+			maximum_number_of_queued_files = number_of_files;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     maximum_number_of_queued_files,
+		     (int (*)(intptr_t *, void *)) &libsigscan_internal_scanner_scan_files_callback,
+		     (void *) &scan_files_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( file_index = 0;
+		     file_index < number_of_files;
+		     file_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( filenames[ file_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push file: %d onto thread pool queue.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_free(
+		     &( scan_files_values.callback_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free callback mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( scan_files_values.callback_file_index != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: callback function failed for file: %d.",
+		 function,
+		 scan_files_values.callback_file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( scan_files_values.callback_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( scan_files_values.callback_mutex ),
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
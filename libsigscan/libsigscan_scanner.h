@@ -25,10 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_byte_value_frequencies.h"
+#include "libsigscan_compiled_source.h"
 #include "libsigscan_extern.h"
 #include "libsigscan_libbfio.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
 #include "libsigscan_scan_tree.h"
 #include "libsigscan_types.h"
 
@@ -40,14 +43,32 @@ typedef struct libsigscan_internal_scanner libsigscan_internal_scanner_t;
 
 struct libsigscan_internal_scanner
 {
-	/* The (scan) buffer size
+	/* The (scan) buffer size, where a value of 0 represents
+	 * that the buffer size is determined automatically
 	 */
 	size_t buffer_size;
 
+	/* The (CPU) cache size
+	 */
+	size_t cache_size;
+
+	/* The number of read buffers, where a value of 0 or 1 represents
+	 * that the data is read and scanned alternately
+	 */
+	int number_of_read_buffers;
+
+	/* Value to indicate files are read using direct IO
+	 */
+	int direct_io;
+
 	/* The signatures list
 	 */
 	libcdata_list_t *signatures_list;
 
+	/* The byte value frequencies (of sample data)
+	 */
+	libsigscan_byte_value_frequencies_t *byte_value_frequencies;
+
 	/* The header (offset relative from start) scan tree
 	 */
 	libsigscan_scan_tree_t *header_scan_tree;
@@ -65,6 +86,142 @@ struct libsigscan_internal_scanner
 	int abort;
 };
 
+typedef struct libsigscan_scanner_identify_values libsigscan_scanner_identify_values_t;
+
+struct libsigscan_scanner_identify_values
+{
+	/* The scanner
+	 */
+	libsigscan_internal_scanner_t *internal_scanner;
+
+	/* The buffers
+	 */
+	const uint8_t **buffers;
+
+	/* The buffer sizes
+	 */
+	const size_t *buffer_sizes;
+
+	/* The number of buffers
+	 */
+	int number_of_buffers;
+
+	/* The results
+	 */
+	libsigscan_identify_result_t *results;
+
+	/* The identify result
+	 */
+	int result;
+
+	/* The identify error
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct libsigscan_scanner_read_buffer libsigscan_scanner_read_buffer_t;
+
+struct libsigscan_scanner_read_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The read result
+	 */
+	int result;
+};
+
+typedef struct libsigscan_scanner_read_values libsigscan_scanner_read_values_t;
+
+struct libsigscan_scanner_read_values
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The range offset
+	 */
+	off64_t range_offset;
+
+	/* The range size
+	 */
+	size64_t range_size;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The queue of read buffers that can be filled
+	 */
+	libcthreads_queue_t *empty_queue;
+
+	/* The queue of read buffers that can be scanned
+	 */
+	libcthreads_queue_t *full_queue;
+
+	/* The mutex that protects the abort and read result values
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+
+	/* Value to indicate if reading was aborted
+	 */
+	int abort;
+
+	/* The read result
+	 */
+	int result;
+
+	/* The read error
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct libsigscan_scanner_scan_files_values libsigscan_scanner_scan_files_values_t;
+
+struct libsigscan_scanner_scan_files_values
+{
+	/* The scanner
+	 */
+	libsigscan_internal_scanner_t *internal_scanner;
+
+	/* The filenames
+	 */
+	const char **filenames;
+
+	/* The callback function that is called with the results of a file
+	 */
+	int (*callback_function)(
+	       int file_index,
+	       int file_result,
+	       libsigscan_scan_state_t *scan_state,
+	       void *callback_function_arguments );
+
+	/* The callback function arguments
+	 */
+	void *callback_function_arguments;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes the calls of the callback function
+	 */
+	libcthreads_mutex_t *callback_mutex;
+#endif
+
+	/* The index of the file for which the callback function failed
+	 */
+	int callback_file_index;
+
+	/* Value to indicate if scanning the files was aborted
+	 */
+	int abort;
+};
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_initialize(
      libsigscan_scanner_t **scanner,
@@ -86,6 +243,18 @@ int libsigscan_scanner_set_scan_buffer_size(
      size_t scan_buffer_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_number_of_read_buffers(
+     libsigscan_scanner_t *scanner,
+     int number_of_read_buffers,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_direct_io(
+     libsigscan_scanner_t *scanner,
+     int direct_io,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_add_signature(
      libsigscan_scanner_t *scanner,
@@ -97,6 +266,55 @@ int libsigscan_scanner_add_signature(
      uint32_t signature_flags,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_update_byte_value_frequencies(
+     libsigscan_scanner_t *scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_memory_usage(
+     libsigscan_scanner_t *scanner,
+     size64_t *memory_usage,
+     size64_t *saved_memory_usage,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_statistics(
+     libsigscan_scanner_t *scanner,
+     int scan_tree_type,
+     libsigscan_scan_tree_statistics_t **scan_tree_statistics,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_compile_source(
+     libsigscan_internal_scanner_t *internal_scanner,
+     const char *prefix,
+     size_t prefix_length,
+     libsigscan_compiled_source_t **compiled_source,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_compiled_source_size(
+     libsigscan_scanner_t *scanner,
+     const char *prefix,
+     size_t prefix_length,
+     size_t *source_size,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_get_compiled_source(
+     libsigscan_scanner_t *scanner,
+     const char *prefix,
+     size_t prefix_length,
+     char *source,
+     size_t source_size,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_build_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_scan_start(
      libsigscan_scanner_t *scanner,
@@ -117,6 +335,35 @@ int libsigscan_scanner_scan_buffer(
      size_t buffer_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_scan_iovec(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const libsigscan_buffer_segment_t *segments,
+     int number_of_segments,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_identify_buffers(
+     libsigscan_internal_scanner_t *internal_scanner,
+     const uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     libsigscan_identify_result_t *results,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_identify_buffers_callback(
+     libsigscan_scanner_identify_values_t *identify_values );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_identify_buffers(
+     libsigscan_scanner_t *scanner,
+     const uint8_t **buffers,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     libsigscan_identify_result_t *results,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_scan_file(
      libsigscan_scanner_t *scanner,
@@ -135,6 +382,46 @@ int libsigscan_scanner_scan_file_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsigscan_internal_scanner_read_range_callback(
+     libsigscan_scanner_read_values_t *read_values );
+
+int libsigscan_internal_scanner_scan_file_io_handle_range_pipelined(
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     size_t buffer_size,
+     int number_of_read_buffers,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libsigscan_internal_scanner_scan_file_io_handle_range(
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int number_of_read_buffers,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_get_read_buffer_size(
+     libsigscan_internal_scanner_t *internal_scanner,
+     size64_t read_size,
+     size_t io_block_size,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_scan_file_io_handle(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     size_t io_block_size,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_scan_file_io_handle(
      libsigscan_scanner_t *scanner,
@@ -142,6 +429,33 @@ int libsigscan_scanner_scan_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_scan_file_io_handle_extents(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     const libsigscan_extent_t *extents,
+     int number_of_extents,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_scan_files_callback(
+     intptr_t *value,
+     libsigscan_scanner_scan_files_values_t *scan_files_values );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_scan_files(
+     libsigscan_scanner_t *scanner,
+     const char **filenames,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            int file_result,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_function_arguments ),
+     void *callback_function_arguments,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -338,6 +339,7 @@ int libsigscan_signature_set(
      libcerror_error_t **error )
 {
 	static char *function    = "libsigscan_signature_set";
+	size_t pattern_index     = 0;
 	uint32_t supported_flags = 0;
 
 	if( signature == NULL )
@@ -493,6 +495,18 @@ int libsigscan_signature_set(
 
 		goto on_error;
 	}
+	/* The pattern prefix allows to reject most non-matching data with a single compare
+	 */
+	signature->pattern_prefix      = 0;
+	signature->pattern_prefix_mask = 0;
+
+	for( pattern_index = 0;
+	     ( pattern_index < 8 ) && ( pattern_index < pattern_size );
+	     pattern_index++ )
+	{
+		signature->pattern_prefix      |= (uint64_t) pattern[ pattern_index ] << ( pattern_index * 8 );
+		signature->pattern_prefix_mask |= (uint64_t) 0xff << ( pattern_index * 8 );
+	}
 	signature->signature_flags = signature_flags;
 
 	return( 1 );
@@ -516,3 +530,94 @@ on_error:
 	}
 	return( -1 );
 }
+
+/* Determines if the signature pattern matches the buffer at a specific offset
+ * If at least 8 bytes are available the pattern prefix is compared first,
+ * which rejects most non-matching data with a single compare
+ * Returns 1 if the pattern matches, 0 if not or -1 on error
+ */
+int libsigscan_signature_match_buffer(
+     libsigscan_signature_t *signature,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_signature_match_buffer";
+	size_t compare_offset = 0;
+	uint64_t buffer_value = 0;
+
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature->pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature - missing pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_offset > buffer_size )
+	 || ( signature->pattern_size > ( buffer_size - buffer_offset ) ) )
+	{
+		return( 0 );
+	}
+	if( ( buffer_size - buffer_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 buffer_value );
+
+		if( ( buffer_value & signature->pattern_prefix_mask ) != signature->pattern_prefix )
+		{
+			return( 0 );
+		}
+		if( signature->pattern_size <= 8 )
+		{
+			return( 1 );
+		}
+		compare_offset = 8;
+	}
+	if( memory_compare(
+	     &( buffer[ buffer_offset + compare_offset ] ),
+	     &( signature->pattern[ compare_offset ] ),
+	     signature->pattern_size - compare_offset ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
@@ -55,6 +55,16 @@ struct libsigscan_signature
 	 */
 	size_t pattern_size;
 
+	/* The pattern prefix
+	 * The first 8 bytes of the pattern as a 64-bit little-endian value
+	 */
+	uint64_t pattern_prefix;
+
+	/* The pattern prefix mask
+	 * The bits of the pattern prefix that are part of the pattern
+	 */
+	uint64_t pattern_prefix_mask;
+
 	/* The signature flags
 	 */
 	uint32_t signature_flags;
@@ -98,6 +108,13 @@ int libsigscan_signature_set(
      uint32_t signature_flags,
      libcerror_error_t **error );
 
+int libsigscan_signature_match_buffer(
+     libsigscan_signature_t *signature,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -313,7 +313,14 @@ int libsigscan_signature_table_fill(
 				break;
 
 			case LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND:
-				add_signature = 1;
+				if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+				{
+					add_signature = 1;
+				}
+				else
+				{
+					add_signature = 0;
+				}
 				break;
 
 			default:
@@ -649,6 +656,111 @@ int libsigscan_signature_table_get_number_of_signatures(
 	return( 1 );
 }
 
+/* Retrieves the signature with the largest pattern
+ * If multiple signatures have the largest pattern the first one is retrieved
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libsigscan_signature_table_get_largest_signature(
+     libsigscan_signature_table_t *signature_table,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element  = NULL;
+	libsigscan_signature_t *list_signature = NULL;
+	static char *function                  = "libsigscan_signature_table_get_largest_signature";
+
+	if( signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature table.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	*signature = NULL;
+
+	if( libcdata_list_get_first_element(
+	     signature_table->signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &list_signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( list_signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( *signature == NULL )
+		 || ( list_signature->pattern_size > ( *signature )->pattern_size ) )
+		{
+			*signature = list_signature;
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( *signature == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Retrieves a clone of the signatures list
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
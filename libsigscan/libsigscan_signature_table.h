@@ -86,6 +86,11 @@ int libsigscan_signature_table_get_number_of_signatures(
      int *number_of_signatures,
      libcerror_error_t **error );
 
+int libsigscan_signature_table_get_largest_signature(
+     libsigscan_signature_table_t *signature_table,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error );
+
 int libsigscan_signature_table_get_signatures_list_clone(
      libsigscan_signature_table_t *signature_table,
      libcdata_list_t **signatures_list,
@@ -23,6 +23,8 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_byte_value_frequencies.h"
+#include "libsigscan_definitions.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
 #include "libsigscan_signature.h"
@@ -128,6 +130,11 @@ int libsigscan_skip_table_free(
 	}
 	if( *skip_table != NULL )
 	{
+		if( ( *skip_table )->block_skip_values != NULL )
+		{
+			memory_free(
+			 ( *skip_table )->block_skip_values );
+		}
 		memory_free(
 		 *skip_table );
 
@@ -137,19 +144,30 @@ int libsigscan_skip_table_free(
 }
 
 /* Fills the skip table
+ * The block size is the number of bytes (q-gram) used to determine the skip value,
+ * where 0 represents the block size is determined from the signatures (Wu-Manber)
+ * If byte value frequencies are provided and the block size is 1 the byte value offset
+ * is chosen that results in the largest expected skip value
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_skip_table_fill(
      libsigscan_skip_table_t *skip_table,
      libcdata_list_t *signatures_list,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     size_t block_size,
      libcerror_error_t **error )
 {
 	libcdata_list_element_t *list_element = NULL;
 	libsigscan_signature_t *signature     = NULL;
 	static char *function                 = "libsigscan_skip_table_fill";
-	size_t pattern_index                  = 0;
+	size_t byte_value_offset              = 0;
 	size_t skip_value                     = 0;
-	uint8_t byte_value                    = 0;
+	uint64_t expected_skip_value          = 0;
+	uint64_t frequency                    = 0;
+	uint64_t largest_expected_skip_value  = 0;
+	uint64_t number_of_signatures         = 0;
+	uint64_t number_of_pattern_bytes      = 0;
+	uint16_t byte_value                   = 0;
 
 	if( skip_table == NULL )
 	{
@@ -162,6 +180,28 @@ int libsigscan_skip_table_fill(
 
 		return( -1 );
 	}
+	if( skip_table->block_skip_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid skip table - block skip values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size > LIBSIGSCAN_SKIP_TABLE_MAXIMUM_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	/* First determine the smallest pattern size
 	 */
 	if( libcdata_list_get_first_element(
@@ -215,6 +255,8 @@ int libsigscan_skip_table_fill(
 		{
 			skip_table->smallest_pattern_size = signature->pattern_size;
 		}
+		number_of_signatures += 1;
+
 		if( libcdata_list_element_get_next_element(
 		     list_element,
 		     &list_element,
@@ -230,8 +272,205 @@ int libsigscan_skip_table_fill(
 			return( -1 );
 		}
 	}
-	/* Next fill the skip table
+	if( skip_table->smallest_pattern_size == 0 )
+	{
+		return( 1 );
+	}
+	if( block_size == 0 )
+	{
+		/* Wu-Manber: a block size of log256( 2 * smallest pattern size * number of signatures )
+		 * keeps most of the blocks absent from the patterns, hence the default skip value is used
+		 */
+		number_of_pattern_bytes = 2 * number_of_signatures * (uint64_t) skip_table->smallest_pattern_size;
+
+		if( number_of_pattern_bytes <= 256 )
+		{
+			block_size = 1;
+		}
+		else if( number_of_pattern_bytes <= 65536 )
+		{
+			block_size = 2;
+		}
+		else
+		{
+			block_size = 3;
+		}
+	}
+	/* The block must fit before the last byte value of the smallest pattern
+	 * otherwise the default skip value is 1
 	 */
+	while( ( block_size > 1 )
+	    && ( block_size >= skip_table->smallest_pattern_size ) )
+	{
+		block_size -= 1;
+	}
+	skip_table->block_size = block_size;
+
+	/* By default the skip value is determined by the last byte value
+	 * in the smallest pattern size (Boyer–Moore–Horspool)
+	 */
+	skip_table->byte_value_offset = skip_table->smallest_pattern_size - 1;
+
+	if( ( block_size > 1 )
+	 && ( skip_table->byte_value_offset >= (size_t) UINT16_MAX ) )
+	{
+		/* The block skip values are stored as 16-bit values
+		 */
+		skip_table->byte_value_offset = (size_t) UINT16_MAX - 1;
+	}
+	if( ( block_size == 1 )
+	 && ( byte_value_frequencies != NULL )
+	 && ( byte_value_frequencies->total_frequency > 0 ) )
+	{
+		/* Determine the byte value offset with the largest skip value
+		 * weighted by the frequency of the byte values
+		 */
+		for( byte_value_offset = skip_table->smallest_pattern_size - 1;
+		     byte_value_offset > 0;
+		     byte_value_offset-- )
+		{
+			if( libsigscan_skip_table_fill_skip_values(
+			     skip_table,
+			     signatures_list,
+			     byte_value_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to fill skip values for byte value offset: %" PRIzd ".",
+				 function,
+				 byte_value_offset );
+
+				return( -1 );
+			}
+			expected_skip_value = 0;
+
+			for( byte_value = 0;
+			     byte_value < 256;
+			     byte_value++ )
+			{
+				if( libsigscan_byte_value_frequencies_get_frequency(
+				     byte_value_frequencies,
+				     (uint8_t) byte_value,
+				     &frequency,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve byte value: 0x%02" PRIx16 " frequency.",
+					 function,
+					 byte_value );
+
+					return( -1 );
+				}
+				skip_value = skip_table->skip_values[ byte_value ];
+
+				if( skip_value == 0 )
+				{
+					skip_value = byte_value_offset + 1;
+				}
+				expected_skip_value += frequency * skip_value;
+			}
+			if( expected_skip_value > largest_expected_skip_value )
+			{
+				largest_expected_skip_value   = expected_skip_value;
+				skip_table->byte_value_offset = byte_value_offset;
+			}
+		}
+	}
+	if( libsigscan_skip_table_fill_skip_values(
+	     skip_table,
+	     signatures_list,
+	     skip_table->byte_value_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill skip values.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size > 1 )
+	{
+		if( libsigscan_skip_table_fill_block_skip_values(
+		     skip_table,
+		     signatures_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill block skip values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Fills the skip values for a specific byte value offset
+ * The skip value of a byte value is the distance between the byte value offset
+ * and the last preceding occurrence of the byte value in the patterns
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_fill_skip_values(
+     libsigscan_skip_table_t *skip_table,
+     libcdata_list_t *signatures_list,
+     size_t byte_value_offset,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_skip_table_fill_skip_values";
+	size_t pattern_index                  = 0;
+	size_t skip_value                     = 0;
+	uint8_t byte_value                    = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_offset >= skip_table->smallest_pattern_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte value offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     skip_table->skip_values,
+	     0,
+	     sizeof( size_t ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear skip values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_list_get_first_element(
 	     signatures_list,
 	     &list_element,
@@ -273,14 +512,15 @@ int libsigscan_skip_table_fill(
 
 			return( -1 );
 		}
-		skip_value = skip_table->smallest_pattern_size;
-
+		/* The byte value at the byte value offset itself is not used,
+		 * a skip value of 0 is reserved for the default skip value
+		 */
 		for( pattern_index = 0;
-		     pattern_index < skip_table->smallest_pattern_size;
+		     pattern_index < byte_value_offset;
 		     pattern_index++ )
 		{
-			skip_value -= 1;
-			byte_value  = signature->pattern[ pattern_index ];
+			skip_value = byte_value_offset - pattern_index;
+			byte_value = signature->pattern[ pattern_index ];
 
 			if( ( skip_table->skip_values[ byte_value ] == 0 )
 			 || ( skip_value < skip_table->skip_values[ byte_value ] ) )
@@ -306,6 +546,186 @@ int libsigscan_skip_table_fill(
 	return( 1 );
 }
 
+/* Fills the block skip values
+ * The block skip value of a block is the distance between the byte value offset
+ * and the end of the last preceding occurrence of the block in the patterns
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_fill_block_skip_values(
+     libsigscan_skip_table_t *skip_table,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_skip_table_fill_block_skip_values";
+	size_t pattern_index                  = 0;
+	uint16_t block_index                  = 0;
+	uint16_t skip_value                   = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_table->block_skip_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid skip table - block skip values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( skip_table->block_size < 2 )
+	 || ( skip_table->block_size > LIBSIGSCAN_SKIP_TABLE_MAXIMUM_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid skip table - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( skip_table->byte_value_offset < ( skip_table->block_size - 1 ) )
+	 || ( skip_table->byte_value_offset >= skip_table->smallest_pattern_size )
+	 || ( skip_table->byte_value_offset >= (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid skip table - byte value offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	skip_table->block_skip_values = (uint16_t *) memory_allocate(
+	                                              sizeof( uint16_t ) * LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_SKIP_VALUES );
+
+	if( skip_table->block_skip_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block skip values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     skip_table->block_skip_values,
+	     0,
+	     sizeof( uint16_t ) * LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_SKIP_VALUES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block skip values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		goto on_error;
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			goto on_error;
+		}
+		/* The pattern index refers to the last byte value of the block,
+		 * the block that ends at the byte value offset itself is not used,
+		 * a block skip value of 0 is reserved for the default skip value
+		 */
+		for( pattern_index = skip_table->block_size - 1;
+		     pattern_index < skip_table->byte_value_offset;
+		     pattern_index++ )
+		{
+			skip_value  = (uint16_t) ( skip_table->byte_value_offset - pattern_index );
+			block_index = libsigscan_skip_table_get_block_index(
+			               &( signature->pattern[ pattern_index + 1 - skip_table->block_size ] ),
+			               skip_table->block_size );
+
+			if( ( skip_table->block_skip_values[ block_index ] == 0 )
+			 || ( skip_value < skip_table->block_skip_values[ block_index ] ) )
+			{
+				skip_table->block_skip_values[ block_index ] = skip_value;
+			}
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( skip_table->block_skip_values != NULL )
+	{
+		memory_free(
+		 skip_table->block_skip_values );
+
+		skip_table->block_skip_values = NULL;
+	}
+	return( -1 );
+}
+
 /* Retrieves the smallest pattern size
  * Returns 1 if successful or -1 on error
  */
@@ -343,6 +763,45 @@ int libsigscan_skip_table_get_smallest_pattern_size(
 	return( 1 );
 }
 
+/* Retrieves the byte value offset
+ * The byte value offset is relative to the start of the scanned data
+ * and refers to the byte value that is used to determine the skip value
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_get_byte_value_offset(
+     libsigscan_skip_table_t *skip_table,
+     size_t *byte_value_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_skip_table_get_byte_value_offset";
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value offset.",
+		 function );
+
+		return( -1 );
+	}
+	*byte_value_offset = skip_table->byte_value_offset;
+
+	return( 1 );
+}
+
 /* Retrieves a specific skip value
  * Returns 1 if successful or -1 on error
  */
@@ -378,7 +837,7 @@ int libsigscan_skip_table_get_skip_value(
 	}
 	if( skip_table->skip_values[ byte_value ] == 0 )
 	{
-		*skip_value = skip_table->smallest_pattern_size;
+		*skip_value = skip_table->byte_value_offset + 1;
 	}
 	else
 	{
@@ -387,6 +846,115 @@ int libsigscan_skip_table_get_skip_value(
 	return( 1 );
 }
 
+/* Retrieves the block size
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_get_block_size(
+     libsigscan_skip_table_t *skip_table,
+     size_t *block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_skip_table_get_block_size";
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	*block_size = skip_table->block_size;
+
+	return( 1 );
+}
+
+/* Retrieves the skip value of a specific block
+ * The block should contain block size bytes and end at the byte value offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_skip_table_get_block_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     const uint8_t *block,
+     size_t *skip_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_skip_table_get_block_skip_value";
+	uint16_t block_index  = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_table->block_skip_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid skip table - missing block skip values.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip value.",
+		 function );
+
+		return( -1 );
+	}
+	block_index = libsigscan_skip_table_get_block_index(
+	               block,
+	               skip_table->block_size );
+
+	if( skip_table->block_skip_values[ block_index ] == 0 )
+	{
+		*skip_value = skip_table->byte_value_offset + 2 - skip_table->block_size;
+	}
+	else
+	{
+		*skip_value = skip_table->block_skip_values[ block_index ];
+	}
+	return( 1 );
+}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 /* Prints a skip table
@@ -413,6 +981,14 @@ int libsigscan_skip_table_printf(
 	libcnotify_printf(
 	 "Skip table:\n" );
 
+	libcnotify_printf(
+	 "\tByte value offset\t: %" PRIzd "\n",
+	 skip_table->byte_value_offset );
+
+	libcnotify_printf(
+	 "\tBlock size\t\t: %" PRIzd "\n",
+	 skip_table->block_size );
+
 	for( byte_value_index = 0;
 	     byte_value_index < 256;
 	     byte_value_index++ )
@@ -427,7 +1003,7 @@ int libsigscan_skip_table_printf(
 	}
 	libcnotify_printf(
 	 "\tDefault\t\t: %" PRIzd "\n",
-         skip_table->smallest_pattern_size );
+         skip_table->byte_value_offset + 1 );
 
 	libcnotify_printf(
 	 "\n" );
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_byte_value_frequencies.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 
@@ -32,6 +33,12 @@
 extern "C" {
 #endif
 
+/* The block index of a block (q-gram) of 2 or 3 bytes,
+ * a block of 3 bytes is hashed into 16-bit
+ */
+#define libsigscan_skip_table_get_block_index( block, block_size ) \
+	(uint16_t) ( ( ( (uint16_t) ( block )[ 0 ] << 8 ) | ( block )[ 1 ] ) ^ ( ( ( block_size ) > 2 ) ? ( (uint16_t) ( block )[ 2 ] << 4 ) : 0 ) )
+
 typedef struct libsigscan_skip_table libsigscan_skip_table_t;
 
 struct libsigscan_skip_table
@@ -44,9 +51,22 @@ struct libsigscan_skip_table
 	 */
 	size_t smallest_pattern_size;
 
+	/* The byte value offset
+	 */
+	size_t byte_value_offset;
+
 	/* The skip values
 	 */
 	size_t skip_values[ 256 ];
+
+	/* The block size
+	 * The number of bytes (q-gram) used to determine the block skip value
+	 */
+	size_t block_size;
+
+	/* The block skip values
+	 */
+	uint16_t *block_skip_values;
 };
 
 int libsigscan_skip_table_initialize(
@@ -58,6 +78,19 @@ int libsigscan_skip_table_free(
      libcerror_error_t **error );
 
 int libsigscan_skip_table_fill(
+     libsigscan_skip_table_t *skip_table,
+     libcdata_list_t *signatures_list,
+     libsigscan_byte_value_frequencies_t *byte_value_frequencies,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libsigscan_skip_table_fill_skip_values(
+     libsigscan_skip_table_t *skip_table,
+     libcdata_list_t *signatures_list,
+     size_t byte_value_offset,
+     libcerror_error_t **error );
+
+int libsigscan_skip_table_fill_block_skip_values(
      libsigscan_skip_table_t *skip_table,
      libcdata_list_t *signatures_list,
      libcerror_error_t **error );
@@ -67,12 +100,28 @@ int libsigscan_skip_table_get_smallest_pattern_size(
      size_t *smallest_pattern_size,
      libcerror_error_t **error );
 
+int libsigscan_skip_table_get_byte_value_offset(
+     libsigscan_skip_table_t *skip_table,
+     size_t *byte_value_offset,
+     libcerror_error_t **error );
+
 int libsigscan_skip_table_get_skip_value(
      libsigscan_skip_table_t *skip_table,
      uint8_t byte_value,
      size_t *skip_value,
      libcerror_error_t **error );
 
+int libsigscan_skip_table_get_block_size(
+     libsigscan_skip_table_t *skip_table,
+     size_t *block_size,
+     libcerror_error_t **error );
+
+int libsigscan_skip_table_get_block_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     const uint8_t *block,
+     size_t *skip_value,
+     libcerror_error_t **error );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 int libsigscan_skip_table_printf(
@@ -36,15 +36,72 @@
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libsigscan_scan_result {}	libsigscan_scan_result_t;
 typedef struct libsigscan_scan_state {}		libsigscan_scan_state_t;
+typedef struct libsigscan_scan_tree_statistics {}	libsigscan_scan_tree_statistics_t;
 typedef struct libsigscan_scanner {}		libsigscan_scanner_t;
 
 #else
 typedef intptr_t libsigscan_scan_result_t;
 typedef intptr_t libsigscan_scan_state_t;
+typedef intptr_t libsigscan_scan_tree_statistics_t;
 typedef intptr_t libsigscan_scanner_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The buffer segment
+ * Describes a segment of non-contiguous data, comparable to struct iovec
+ */
+typedef struct libsigscan_buffer_segment libsigscan_buffer_segment_t;
+
+struct libsigscan_buffer_segment
+{
+	/* The buffer
+	 */
+	const uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+};
+
+/* The extent
+ * Describes a range of the data, such as a file, that is to be scanned
+ */
+typedef struct libsigscan_extent libsigscan_extent_t;
+
+struct libsigscan_extent
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
+/* The identify result
+ * Contains the signature that identifies a buffer
+ */
+typedef struct libsigscan_identify_result libsigscan_identify_result_t;
+
+struct libsigscan_identify_result
+{
+	/* The signature identifier
+	 * This value is NULL if no signature was found and otherwise references
+	 * the identifier of the signature, which is owned by the scanner
+	 */
+	const char *identifier;
+
+	/* The signature identifier size
+	 * This value includes the end-of-string character
+	 */
+	size_t identifier_size;
+
+	/* The offset of the (bounded) signature range that was scanned
+	 */
+	off64_t offset;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBSIGSCAN ) */
 
 #endif /* !defined( _LIBSIGSCAN_INTERNAL_TYPES_H ) */
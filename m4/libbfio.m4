@@ -100,6 +100,11 @@ AC_DEFUN([AX_LIBBFIO_CHECK_LIB],
           libbfio_handle_read_buffer,
           [ac_cv_libbfio_dummy=yes],
           [ac_cv_libbfio=no])
+        AC_CHECK_LIB(
+          bfio,
+          libbfio_handle_read_buffer_at_offset,
+          [ac_cv_libbfio_dummy=yes],
+          [ac_cv_libbfio=no])
         AC_CHECK_LIB(
           bfio,
           libbfio_handle_write_buffer,
@@ -32,9 +32,12 @@
 #include "pysigscan_libcerror.h"
 #include "pysigscan_libsigscan.h"
 #include "pysigscan_python.h"
+#include "pysigscan_scan_files.h"
+#include "pysigscan_scan_operation.h"
 #include "pysigscan_scan_result.h"
 #include "pysigscan_scan_results.h"
 #include "pysigscan_scan_state.h"
+#include "pysigscan_scan_stream.h"
 #include "pysigscan_scanner.h"
 #include "pysigscan_signature_flags.h"
 #include "pysigscan_unused.h"
@@ -160,6 +163,43 @@ PyMODINIT_FUNC initpysigscan(
 #endif
 	gil_state = PyGILState_Ensure();
 
+	/* Setup the scan_files type object
+	 */
+	pysigscan_scan_files_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pysigscan_scan_files_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pysigscan_scan_files_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "scan_files",
+	 (PyObject *) &pysigscan_scan_files_type_object );
+
+#if defined( HAVE_PYSIGSCAN_ASYNC )
+	/* Setup the scan_operation type object
+	 */
+	pysigscan_scan_operation_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pysigscan_scan_operation_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pysigscan_scan_operation_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "scan_operation",
+	 (PyObject *) &pysigscan_scan_operation_type_object );
+
+#endif /* defined( HAVE_PYSIGSCAN_ASYNC ) */
+
 	/* Setup the scan_result type object
 	 */
 	pysigscan_scan_result_type_object.tp_new = PyType_GenericNew;
@@ -211,6 +251,26 @@ PyMODINIT_FUNC initpysigscan(
 	 "scan_state",
 	 (PyObject *) &pysigscan_scan_state_type_object );
 
+#if defined( HAVE_PYSIGSCAN_ASYNC )
+	/* Setup the scan_stream type object
+	 */
+	pysigscan_scan_stream_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pysigscan_scan_stream_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pysigscan_scan_stream_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "scan_stream",
+	 (PyObject *) &pysigscan_scan_stream_type_object );
+
+#endif /* defined( HAVE_PYSIGSCAN_ASYNC ) */
+
 	/* Setup the scanner type object
 	 */
 	pysigscan_scanner_type_object.tp_new = PyType_GenericNew;
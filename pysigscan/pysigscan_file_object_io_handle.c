@@ -23,6 +23,18 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "pysigscan_error.h"
 #include "pysigscan_file_object_io_handle.h"
 #include "pysigscan_integer.h"
@@ -104,6 +116,9 @@ int pysigscan_file_object_io_handle_initialize(
 	}
 	( *file_object_io_handle )->file_object = file_object;
 
+#if defined( HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR )
+	( *file_object_io_handle )->file_descriptor = -1;
+#endif
 	Py_IncRef(
 	 ( *file_object_io_handle )->file_object );
 
@@ -167,6 +182,19 @@ int pysigscan_file_object_initialize(
 
 		goto on_error;
 	}
+	if( pysigscan_file_object_io_handle_set_read_method(
+	     file_object_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read method of file object IO handle.",
+		 function );
+
+		goto on_error;
+	}
 	if( libbfio_handle_initialize(
 	     handle,
 	     (intptr_t *) file_object_io_handle,
@@ -306,6 +334,96 @@ int pysigscan_file_object_io_handle_clone(
 
 		return( -1 );
 	}
+	( *destination_file_object_io_handle )->has_readinto = source_file_object_io_handle->has_readinto;
+
+#if defined( HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR )
+	( *destination_file_object_io_handle )->file_descriptor = source_file_object_io_handle->file_descriptor;
+	( *destination_file_object_io_handle )->size            = source_file_object_io_handle->size;
+#endif
+	return( 1 );
+}
+
+/* Determines how the file object IO handle reads from the file object
+ * Regular files are read directly from the file descriptor without holding the GIL,
+ * other file objects are read using readinto if available and read otherwise
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pysigscan_file_object_io_handle_set_read_method(
+     pysigscan_file_object_io_handle_t *file_object_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "pysigscan_file_object_io_handle_set_read_method";
+
+#if defined( HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR )
+	struct stat file_statistics;
+
+	int file_descriptor   = -1;
+	int result            = 0;
+#endif
+
+	if( file_object_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_object_io_handle->file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file object IO handle - missing file object.",
+		 function );
+
+		return( -1 );
+	}
+	PyErr_Clear();
+
+	/* Prefer readinto over read so that the data is read into the buffer
+	 * without creating an intermediate bytes object
+	 */
+	file_object_io_handle->has_readinto = PyObject_HasAttrString(
+	                                       file_object_io_handle->file_object,
+	                                       "readinto" );
+
+#if defined( HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR )
+	file_object_io_handle->file_descriptor = -1;
+
+	result = pysigscan_file_object_get_file_descriptor(
+	          file_object_io_handle->file_object,
+	          &file_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file descriptor of file object.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ( fstat(
+		       file_descriptor,
+		       &file_statistics ) == 0 )
+		 && S_ISREG( file_statistics.st_mode ) )
+		{
+			file_object_io_handle->file_descriptor = file_descriptor;
+			file_object_io_handle->size            = (size64_t) file_statistics.st_size;
+		}
+	}
+#endif
 	return( 1 );
 }
 
@@ -409,6 +527,180 @@ int pysigscan_file_object_io_handle_close(
 	return( 0 );
 }
 
+/* Retrieves the file descriptor of the file object
+ * Only the file descriptor of the file object types of the io module
+ * that read the file as-is is used, since file object types that for
+ * example decompress the file can return the file descriptor of the
+ * underlying file
+ * The file descriptor of a writable buffered file object is not used,
+ * since data written to its buffer but not yet flushed is not in the file
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int pysigscan_file_object_get_file_descriptor(
+     PyObject *file_object,
+     int *file_descriptor,
+     libcerror_error_t **error )
+{
+	const char *type_names[ 2 ] = { "FileIO", "BufferedReader" };
+
+	PyObject *io_module         = NULL;
+	PyObject *method_name       = NULL;
+	PyObject *method_result     = NULL;
+	PyObject *type_object       = NULL;
+	static char *function       = "pysigscan_file_object_get_file_descriptor";
+	int64_t value_64bit         = 0;
+	int is_supported            = 0;
+	int type_index              = 0;
+
+	if( file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	PyErr_Clear();
+
+	io_module = PyImport_ImportModule(
+	             "io" );
+
+	if( io_module == NULL )
+	{
+		pysigscan_error_fetch(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to import io module.",
+		 function );
+
+		goto on_error;
+	}
+	for( type_index = 0;
+	     type_index < 2;
+	     type_index++ )
+	{
+		type_object = PyObject_GetAttrString(
+		               io_module,
+		               type_names[ type_index ] );
+
+		if( type_object == NULL )
+		{
+			PyErr_Clear();
+
+			continue;
+		}
+		if( (PyObject *) Py_TYPE( file_object ) == type_object )
+		{
+			is_supported = 1;
+		}
+		Py_DecRef(
+		 type_object );
+
+		if( is_supported != 0 )
+		{
+			break;
+		}
+	}
+	Py_DecRef(
+	 io_module );
+
+	io_module = NULL;
+
+	if( is_supported == 0 )
+	{
+		return( 0 );
+	}
+#if PY_MAJOR_VERSION >= 3
+	method_name = PyUnicode_FromString(
+	               "fileno" );
+#else
+	method_name = PyString_FromString(
+	               "fileno" );
+#endif
+	PyErr_Clear();
+
+	method_result = PyObject_CallMethodObjArgs(
+	                 file_object,
+	                 method_name,
+	                 NULL );
+
+	Py_DecRef(
+	 method_name );
+
+	method_name = NULL;
+
+	/* A file object without a file descriptor is read using its methods
+	 */
+	if( ( method_result == NULL )
+	 || PyErr_Occurred() )
+	{
+		PyErr_Clear();
+
+		if( method_result != NULL )
+		{
+			Py_DecRef(
+			 method_result );
+		}
+		return( 0 );
+	}
+	if( pysigscan_integer_signed_copy_to_64bit(
+	     method_result,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to convert method result into file descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	Py_DecRef(
+	 method_result );
+
+	method_result = NULL;
+
+	if( ( value_64bit < 0 )
+	 || ( value_64bit > (int64_t) INT_MAX ) )
+	{
+		return( 0 );
+	}
+	*file_descriptor = (int) value_64bit;
+
+	return( 1 );
+
+on_error:
+	if( method_result != NULL )
+	{
+		Py_DecRef(
+		 method_result );
+	}
+	if( io_module != NULL )
+	{
+		Py_DecRef(
+		 io_module );
+	}
+	return( -1 );
+}
+
 /* Reads a buffer from the file object
  * Make sure to hold the GIL state before calling this function
  * Returns the number of bytes read if successful, or -1 on error
@@ -613,6 +905,216 @@ on_error:
 	return( -1 );
 }
 
+/* Reads a buffer from the file object using the readinto method
+ * The data is read directly into the buffer without creating an intermediate bytes object
+ * Make sure to hold the GIL state before calling this function
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t pysigscan_file_object_readinto_buffer(
+         PyObject *file_object,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	PyObject *buffer_object  = NULL;
+	PyObject *method_name    = NULL;
+	PyObject *method_result  = NULL;
+	static char *function    = "pysigscan_file_object_readinto_buffer";
+	int64_t value_64bit      = 0;
+	size_t buffer_offset     = 0;
+
+#if PY_MAJOR_VERSION >= 3
+	PyObject *release_result = NULL;
+#endif
+
+	if( file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if PY_MAJOR_VERSION >= 3
+	method_name = PyUnicode_FromString(
+	               "readinto" );
+#else
+	method_name = PyString_FromString(
+	               "readinto" );
+#endif
+	/* A raw file object can return less data than requested
+	 * hence readinto is called until the buffer is filled or
+	 * the end of the file is reached
+	 */
+	while( buffer_offset < size )
+	{
+#if PY_MAJOR_VERSION >= 3
+		buffer_object = PyMemoryView_FromMemory(
+		                 (char *) &( buffer[ buffer_offset ] ),
+		                 (Py_ssize_t) ( size - buffer_offset ),
+		                 PyBUF_WRITE );
+#else
+		buffer_object = PyBuffer_FromReadWriteMemory(
+		                 (void *) &( buffer[ buffer_offset ] ),
+		                 (Py_ssize_t) ( size - buffer_offset ) );
+#endif
+		if( buffer_object == NULL )
+		{
+			pysigscan_error_fetch(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create buffer object.",
+			 function );
+
+			goto on_error;
+		}
+		PyErr_Clear();
+
+		method_result = PyObject_CallMethodObjArgs(
+		                 file_object,
+		                 method_name,
+		                 buffer_object,
+		                 NULL );
+
+		if( PyErr_Occurred() )
+		{
+			pysigscan_error_fetch(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file object.",
+			 function );
+
+			goto on_error;
+		}
+		if( method_result == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing method result.",
+			 function );
+
+			goto on_error;
+		}
+#if PY_MAJOR_VERSION >= 3
+		/* Make sure the buffer can no longer be accessed through a reference
+		 * to the memory view object that was retained by the file object
+		 */
+		release_result = PyObject_CallMethod(
+		                  buffer_object,
+		                  "release",
+		                  NULL );
+
+		if( release_result == NULL )
+		{
+			PyErr_Clear();
+		}
+		else
+		{
+			Py_DecRef(
+			 release_result );
+		}
+#endif
+		/* None is returned by a non-blocking file object if no data is available
+		 */
+		if( method_result == Py_None )
+		{
+			value_64bit = 0;
+		}
+		else if( pysigscan_integer_signed_copy_to_64bit(
+		          method_result,
+		          &value_64bit,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to convert method result into read count.",
+			 function );
+
+			goto on_error;
+		}
+		Py_DecRef(
+		 method_result );
+
+		method_result = NULL;
+
+		Py_DecRef(
+		 buffer_object );
+
+		buffer_object = NULL;
+
+		if( ( value_64bit < 0 )
+		 || ( (uint64_t) value_64bit > (uint64_t) ( size - buffer_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid read count value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( value_64bit == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) value_64bit;
+	}
+	Py_DecRef(
+	 method_name );
+
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( method_result != NULL )
+	{
+		Py_DecRef(
+		 method_result );
+	}
+	if( buffer_object != NULL )
+	{
+		Py_DecRef(
+		 buffer_object );
+	}
+	if( method_name != NULL )
+	{
+		Py_DecRef(
+		 method_name );
+	}
+	return( -1 );
+}
+
 /* Reads a buffer from the file object IO handle
  * Returns the number of bytes read if successful, or -1 on error
  */
@@ -626,6 +1128,10 @@ ssize_t pysigscan_file_object_io_handle_read(
 	PyGILState_STATE gil_state = 0;
 	ssize_t read_count         = 0;
 
+#if defined( HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR )
+	size_t buffer_offset       = 0;
+#endif
+
 	if( file_object_io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -637,13 +1143,86 @@ ssize_t pysigscan_file_object_io_handle_read(
 
 		return( -1 );
 	}
+#if defined( HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		/* The file descriptor is read without holding the GIL
+		 */
+		while( buffer_offset < size )
+		{
+			read_count = pread(
+			              file_object_io_handle->file_descriptor,
+			              &( buffer[ buffer_offset ] ),
+			              size - buffer_offset,
+			              (off_t) ( file_object_io_handle->current_offset + buffer_offset ) );
+
+			if( read_count < 0 )
+			{
+				if( errno == EINTR )
+				{
+					continue;
+				}
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read from file descriptor.",
+				 function );
+
+				return( -1 );
+			}
+			if( read_count == 0 )
+			{
+				break;
+			}
+			buffer_offset += (size_t) read_count;
+		}
+		file_object_io_handle->current_offset += (off64_t) buffer_offset;
+
+		return( (ssize_t) buffer_offset );
+	}
+#endif
 	gil_state = PyGILState_Ensure();
 
-	read_count = pysigscan_file_object_read_buffer(
-	              file_object_io_handle->file_object,
-	              buffer,
-	              size,
-	              error );
+	if( file_object_io_handle->has_readinto != 0 )
+	{
+		read_count = pysigscan_file_object_readinto_buffer(
+		              file_object_io_handle->file_object,
+		              buffer,
+		              size,
+		              error );
+	}
+	else
+	{
+		read_count = pysigscan_file_object_read_buffer(
+		              file_object_io_handle->file_object,
+		              buffer,
+		              size,
+		              error );
+	}
 
 	if( read_count == -1 )
 	{
@@ -1152,6 +1731,44 @@ off64_t pysigscan_file_object_io_handle_seek_offset(
 
 		return( -1 );
 	}
+#if defined( HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		if( whence == SEEK_CUR )
+		{
+			offset += file_object_io_handle->current_offset;
+		}
+		else if( whence == SEEK_END )
+		{
+			offset += (off64_t) file_object_io_handle->size;
+		}
+		else if( whence != SEEK_SET )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported whence.",
+			 function );
+
+			return( -1 );
+		}
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		file_object_io_handle->current_offset = offset;
+
+		return( offset );
+	}
+#endif
 	gil_state = PyGILState_Ensure();
 
 	if( pysigscan_file_object_seek_offset(
@@ -1401,6 +2018,25 @@ int pysigscan_file_object_io_handle_get_size(
 
 		return( -1 );
 	}
+#if defined( HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR )
+	if( file_object_io_handle->file_descriptor != -1 )
+	{
+		if( size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid size.",
+			 function );
+
+			return( -1 );
+		}
+		*size = file_object_io_handle->size;
+
+		return( 1 );
+	}
+#endif
 	gil_state = PyGILState_Ensure();
 
 #if PY_MAJOR_VERSION >= 3
@@ -33,6 +33,12 @@
 extern "C" {
 #endif
 
+/* Note that HAVE_FSTAT is not checked since it is undefined by pysigscan_python.h
+ */
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+#define HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR	1
+#endif
+
 typedef struct pysigscan_file_object_io_handle pysigscan_file_object_io_handle_t;
 
 struct pysigscan_file_object_io_handle
@@ -44,6 +50,25 @@ struct pysigscan_file_object_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* Value to indicate the file object has a readinto method
+	 */
+	int has_readinto;
+
+#if defined( HAVE_PYSIGSCAN_FILE_OBJECT_FILE_DESCRIPTOR )
+	/* The file descriptor of the file object, which is used to read
+	 * without holding the GIL, or -1 if not available
+	 */
+	int file_descriptor;
+
+	/* The current offset, used with the file descriptor
+	 */
+	off64_t current_offset;
+
+	/* The size, used with the file descriptor
+	 */
+	size64_t size;
+#endif
 };
 
 int pysigscan_file_object_io_handle_initialize(
@@ -65,6 +90,10 @@ int pysigscan_file_object_io_handle_clone(
      pysigscan_file_object_io_handle_t *source_file_object_io_handle,
      libcerror_error_t **error );
 
+int pysigscan_file_object_io_handle_set_read_method(
+     pysigscan_file_object_io_handle_t *file_object_io_handle,
+     libcerror_error_t **error );
+
 int pysigscan_file_object_io_handle_open(
      pysigscan_file_object_io_handle_t *file_object_io_handle,
      int access_flags,
@@ -74,12 +103,23 @@ int pysigscan_file_object_io_handle_close(
      pysigscan_file_object_io_handle_t *file_object_io_handle,
      libcerror_error_t **error );
 
+int pysigscan_file_object_get_file_descriptor(
+     PyObject *file_object,
+     int *file_descriptor,
+     libcerror_error_t **error );
+
 ssize_t pysigscan_file_object_read_buffer(
          PyObject *file_object,
          uint8_t *buffer,
          size_t size,
          libcerror_error_t **error );
 
+ssize_t pysigscan_file_object_readinto_buffer(
+         PyObject *file_object,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
 ssize_t pysigscan_file_object_io_handle_read(
          pysigscan_file_object_io_handle_t *file_object_io_handle,
          uint8_t *buffer,
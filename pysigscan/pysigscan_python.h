@@ -73,6 +73,17 @@
 #define Py_TPFLAGS_HAVE_ITER		0
 #endif
 
+#if !defined( PYTHREAD_INVALID_THREAD_ID )
+#define PYTHREAD_INVALID_THREAD_ID	( (unsigned long) -1 )
+#endif
+
+/* The asyncio support requires the asynchronous iterator protocol
+ * that was introduced in Python 3.5
+ */
+#if PY_VERSION_HEX >= 0x03050000
+#define HAVE_PYSIGSCAN_ASYNC
+#endif
+
 #if !defined( Py_TYPE )
 #define Py_TYPE( object ) \
 	( ( (PyObject *) object )->ob_type )
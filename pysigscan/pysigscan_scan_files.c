@@ -0,0 +1,1082 @@
+/*
+ * Python object definition of the iterator object of scanning files
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pysigscan_error.h"
+#include "pysigscan_integer.h"
+#include "pysigscan_libcerror.h"
+#include "pysigscan_libsigscan.h"
+#include "pysigscan_python.h"
+#include "pysigscan_scan_files.h"
+#include "pysigscan_scanner.h"
+
+PyTypeObject pysigscan_scan_files_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pysigscan.scan_files",
+	/* tp_basicsize */
+	sizeof( pysigscan_scan_files_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pysigscan_scan_files_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pysigscan iterator object of scanning files",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pysigscan_scan_files_iter,
+	/* tp_iternext */
+	(iternextfunc) pysigscan_scan_files_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pysigscan_scan_files_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Frees file values
+ */
+void pysigscan_scan_files_file_values_free(
+      pysigscan_scan_files_file_values_t *file_values )
+{
+	if( file_values != NULL )
+	{
+		if( file_values->identifiers != NULL )
+		{
+			memory_free(
+			 file_values->identifiers );
+		}
+		if( file_values->offsets != NULL )
+		{
+			memory_free(
+			 file_values->offsets );
+		}
+		memory_free(
+		 file_values );
+	}
+}
+
+/* Creates a new scan files iterator object and starts scanning the files
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scan_files_new(
+           pysigscan_scanner_t *scanner_object,
+           PyObject *paths_object,
+           int number_of_threads )
+{
+	pysigscan_scan_files_t *pysigscan_scan_files = NULL;
+	PyObject *filename_object                    = NULL;
+	PyObject *path_object                        = NULL;
+	static char *function                        = "pysigscan_scan_files_new";
+	Py_ssize_t number_of_paths                   = 0;
+	int file_index                               = 0;
+	int result                                   = 0;
+
+	if( scanner_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner object.",
+		 function );
+
+		return( NULL );
+	}
+	if( paths_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid paths object.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the scan files values are initialized
+	 */
+	pysigscan_scan_files = PyObject_New(
+	                        struct pysigscan_scan_files,
+	                        &pysigscan_scan_files_type_object );
+
+	if( pysigscan_scan_files == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create scan files object.",
+		 function );
+
+		goto on_error;
+	}
+	pysigscan_scan_files->scanner_object    = scanner_object;
+	pysigscan_scan_files->paths_object      = NULL;
+	pysigscan_scan_files->filenames_object  = NULL;
+	pysigscan_scan_files->filenames         = NULL;
+	pysigscan_scan_files->number_of_files   = 0;
+	pysigscan_scan_files->number_of_threads = number_of_threads;
+	pysigscan_scan_files->queue_lock        = NULL;
+	pysigscan_scan_files->signal_lock       = NULL;
+	pysigscan_scan_files->finished_lock     = NULL;
+	pysigscan_scan_files->first_file_values = NULL;
+	pysigscan_scan_files->last_file_values  = NULL;
+	pysigscan_scan_files->thread_started    = 0;
+	pysigscan_scan_files->is_waiting        = 0;
+	pysigscan_scan_files->is_finished       = 0;
+	pysigscan_scan_files->abort             = 0;
+	pysigscan_scan_files->scan_result       = 1;
+	pysigscan_scan_files->scan_error        = NULL;
+
+	Py_IncRef(
+	 (PyObject *) pysigscan_scan_files->scanner_object );
+
+	pysigscan_scan_files->paths_object = PySequence_Fast(
+	                                      paths_object,
+	                                      "paths must be a sequence" );
+
+	if( pysigscan_scan_files->paths_object == NULL )
+	{
+		goto on_error;
+	}
+	number_of_paths = PySequence_Fast_GET_SIZE(
+	                   pysigscan_scan_files->paths_object );
+
+	if( number_of_paths > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of paths value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	pysigscan_scan_files->number_of_files = (int) number_of_paths;
+
+	pysigscan_scan_files->filenames_object = PyList_New(
+	                                          number_of_paths );
+
+	if( pysigscan_scan_files->filenames_object == NULL )
+	{
+		goto on_error;
+	}
+	pysigscan_scan_files->filenames = (const char **) PyMem_Malloc(
+	                                                   sizeof( const char * ) * ( number_of_paths + 1 ) );
+
+	if( pysigscan_scan_files->filenames == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create filenames.",
+		 function );
+
+		goto on_error;
+	}
+	/* The filenames are passed to the library as narrow strings, where Unicode strings
+	 * are converted to UTF-8 as in scan_file
+	 */
+	for( file_index = 0;
+	     file_index < pysigscan_scan_files->number_of_files;
+	     file_index++ )
+	{
+		path_object = PySequence_Fast_GET_ITEM(
+		               pysigscan_scan_files->paths_object,
+		               file_index );
+
+		PyErr_Clear();
+
+		result = PyObject_IsInstance(
+		          path_object,
+		          (PyObject *) &PyUnicode_Type );
+
+		if( result == -1 )
+		{
+			pysigscan_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to determine if path: %d is of type unicode.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			filename_object = PyUnicode_AsUTF8String(
+			                   path_object );
+
+			if( filename_object == NULL )
+			{
+				pysigscan_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to convert path: %d to UTF-8.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+			result = PyObject_IsInstance(
+			          path_object,
+			          (PyObject *) &PyBytes_Type );
+#else
+			result = PyObject_IsInstance(
+			          path_object,
+			          (PyObject *) &PyString_Type );
+#endif
+			if( result == -1 )
+			{
+				pysigscan_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to determine if path: %d is of type string.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				PyErr_Format(
+				 PyExc_TypeError,
+				 "%s: unsupported path: %d object type.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			filename_object = path_object;
+
+			Py_IncRef(
+			 filename_object );
+		}
+		/* PyList_SET_ITEM steals a reference to the filename object
+		 */
+		PyList_SET_ITEM(
+		 pysigscan_scan_files->filenames_object,
+		 (Py_ssize_t) file_index,
+		 filename_object );
+
+#if PY_MAJOR_VERSION >= 3
+		pysigscan_scan_files->filenames[ file_index ] = PyBytes_AsString(
+		                                                 filename_object );
+#else
+		pysigscan_scan_files->filenames[ file_index ] = PyString_AsString(
+		                                                 filename_object );
+#endif
+	}
+	pysigscan_scan_files->filenames[ file_index ] = NULL;
+
+	pysigscan_scan_files->queue_lock = PyThread_allocate_lock();
+
+	if( pysigscan_scan_files->queue_lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create queue lock.",
+		 function );
+
+		goto on_error;
+	}
+	pysigscan_scan_files->signal_lock = PyThread_allocate_lock();
+
+	if( pysigscan_scan_files->signal_lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create signal lock.",
+		 function );
+
+		goto on_error;
+	}
+	pysigscan_scan_files->finished_lock = PyThread_allocate_lock();
+
+	if( pysigscan_scan_files->finished_lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create finished lock.",
+		 function );
+
+		goto on_error;
+	}
+	/* The signal and finished locks are held until they are released by the scan thread
+	 */
+	PyThread_acquire_lock(
+	 pysigscan_scan_files->signal_lock,
+	 WAIT_LOCK );
+
+	PyThread_acquire_lock(
+	 pysigscan_scan_files->finished_lock,
+	 WAIT_LOCK );
+
+	/* The files are scanned by a thread that does not hold the GIL
+	 * so that the iterator can return the results of the files that
+	 * were scanned while the other files are still being scanned
+	 */
+	if( PyThread_start_new_thread(
+	     (void (*)(void *)) &pysigscan_scan_files_thread,
+	     (void *) pysigscan_scan_files ) == PYTHREAD_INVALID_THREAD_ID )
+	{
+		PyErr_Format(
+		 PyExc_RuntimeError,
+		 "%s: unable to start scan thread.",
+		 function );
+
+		goto on_error;
+	}
+	pysigscan_scan_files->thread_started = 1;
+
+	return( (PyObject *) pysigscan_scan_files );
+
+on_error:
+	if( pysigscan_scan_files != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pysigscan_scan_files );
+	}
+	return( NULL );
+}
+
+/* Initializes a scan files iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pysigscan_scan_files_init(
+     pysigscan_scan_files_t *pysigscan_scan_files )
+{
+	static char *function = "pysigscan_scan_files_init";
+
+	if( pysigscan_scan_files == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan files.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the scan files values are initialized
+	 */
+	pysigscan_scan_files->scanner_object    = NULL;
+	pysigscan_scan_files->paths_object      = NULL;
+	pysigscan_scan_files->filenames_object  = NULL;
+	pysigscan_scan_files->filenames         = NULL;
+	pysigscan_scan_files->queue_lock        = NULL;
+	pysigscan_scan_files->signal_lock       = NULL;
+	pysigscan_scan_files->finished_lock     = NULL;
+	pysigscan_scan_files->first_file_values = NULL;
+	pysigscan_scan_files->last_file_values  = NULL;
+	pysigscan_scan_files->thread_started    = 0;
+	pysigscan_scan_files->scan_error        = NULL;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of scan files not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a scan files iterator object
+ * If the files are still being scanned, scanning is aborted
+ */
+void pysigscan_scan_files_free(
+      pysigscan_scan_files_t *pysigscan_scan_files )
+{
+	pysigscan_scan_files_file_values_t *file_values = NULL;
+	struct _typeobject *ob_type                     = NULL;
+	static char *function                           = "pysigscan_scan_files_free";
+
+	if( pysigscan_scan_files == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan files.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pysigscan_scan_files );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pysigscan_scan_files->thread_started != 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pysigscan_scan_files->queue_lock,
+		 WAIT_LOCK );
+
+		pysigscan_scan_files->abort = 1;
+
+		PyThread_release_lock(
+		 pysigscan_scan_files->queue_lock );
+
+		/* Wait for the scan thread to finish
+		 */
+		PyThread_acquire_lock(
+		 pysigscan_scan_files->finished_lock,
+		 WAIT_LOCK );
+
+		Py_END_ALLOW_THREADS
+
+		pysigscan_scan_files->thread_started = 0;
+	}
+	while( pysigscan_scan_files->first_file_values != NULL )
+	{
+		file_values = pysigscan_scan_files->first_file_values;
+
+		pysigscan_scan_files->first_file_values = file_values->next_file_values;
+
+		pysigscan_scan_files_file_values_free(
+		 file_values );
+	}
+	if( pysigscan_scan_files->scan_error != NULL )
+	{
+		libcerror_error_free(
+		 &( pysigscan_scan_files->scan_error ) );
+	}
+	if( pysigscan_scan_files->finished_lock != NULL )
+	{
+		PyThread_free_lock(
+		 pysigscan_scan_files->finished_lock );
+	}
+	if( pysigscan_scan_files->signal_lock != NULL )
+	{
+		PyThread_free_lock(
+		 pysigscan_scan_files->signal_lock );
+	}
+	if( pysigscan_scan_files->queue_lock != NULL )
+	{
+		PyThread_free_lock(
+		 pysigscan_scan_files->queue_lock );
+	}
+	if( pysigscan_scan_files->filenames != NULL )
+	{
+		PyMem_Free(
+		 pysigscan_scan_files->filenames );
+	}
+	if( pysigscan_scan_files->filenames_object != NULL )
+	{
+		Py_DecRef(
+		 pysigscan_scan_files->filenames_object );
+	}
+	if( pysigscan_scan_files->paths_object != NULL )
+	{
+		Py_DecRef(
+		 pysigscan_scan_files->paths_object );
+	}
+	if( pysigscan_scan_files->scanner_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pysigscan_scan_files->scanner_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pysigscan_scan_files );
+}
+
+/* Callback function that queues the results of a scanned file
+ * This function is called by the scan thread without holding the GIL
+ * Returns 1 if successful, 0 if scanning the files should be aborted or -1 on error
+ */
+int pysigscan_scan_files_callback(
+     int file_index,
+     int file_result,
+     libsigscan_scan_state_t *scan_state,
+     pysigscan_scan_files_t *pysigscan_scan_files )
+{
+	pysigscan_scan_files_file_values_t *file_values = NULL;
+	libsigscan_scan_result_t *scan_result           = NULL;
+	off64_t offset                                  = 0;
+	size_t identifier_size                          = 0;
+	size_t identifiers_offset                       = 0;
+	size_t identifiers_size                         = 0;
+	int abort                                       = 0;
+	int result_index                                = 0;
+
+	if( pysigscan_scan_files == NULL )
+	{
+		return( -1 );
+	}
+	PyThread_acquire_lock(
+	 pysigscan_scan_files->queue_lock,
+	 WAIT_LOCK );
+
+	abort = pysigscan_scan_files->abort;
+
+	PyThread_release_lock(
+	 pysigscan_scan_files->queue_lock );
+
+	if( abort != 0 )
+	{
+		return( 0 );
+	}
+	file_values = memory_allocate_structure(
+	               pysigscan_scan_files_file_values_t );
+
+	if( file_values == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     file_values,
+	     0,
+	     sizeof( pysigscan_scan_files_file_values_t ) ) == NULL )
+	{
+		memory_free(
+		 file_values );
+
+		return( -1 );
+	}
+	file_values->file_index  = file_index;
+	file_values->file_result = file_result;
+
+	if( file_result == 1 )
+	{
+		if( libsigscan_scan_state_get_number_of_results(
+		     scan_state,
+		     &( file_values->number_of_results ),
+		     NULL ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( file_values->number_of_results > 0 )
+	{
+		file_values->offsets = (int64_t *) memory_allocate(
+		                                    sizeof( int64_t ) * file_values->number_of_results );
+
+		if( file_values->offsets == NULL )
+		{
+			goto on_error;
+		}
+		for( result_index = 0;
+		     result_index < file_values->number_of_results;
+		     result_index++ )
+		{
+			if( libsigscan_scan_state_get_result(
+			     scan_state,
+			     result_index,
+			     &scan_result,
+			     NULL ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libsigscan_scan_result_get_offset(
+			     scan_result,
+			     &offset,
+			     NULL ) != 1 )
+			{
+				goto on_error;
+			}
+			file_values->offsets[ result_index ] = (int64_t) offset;
+
+			if( libsigscan_scan_result_get_identifier_size(
+			     scan_result,
+			     &identifier_size,
+			     NULL ) != 1 )
+			{
+				goto on_error;
+			}
+			identifiers_size += identifier_size + 1;
+		}
+		file_values->identifiers = (char *) memory_allocate(
+		                                     sizeof( char ) * identifiers_size );
+
+		if( file_values->identifiers == NULL )
+		{
+			goto on_error;
+		}
+		for( result_index = 0;
+		     result_index < file_values->number_of_results;
+		     result_index++ )
+		{
+			if( libsigscan_scan_state_get_result(
+			     scan_state,
+			     result_index,
+			     &scan_result,
+			     NULL ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libsigscan_scan_result_get_identifier_size(
+			     scan_result,
+			     &identifier_size,
+			     NULL ) != 1 )
+			{
+				goto on_error;
+			}
+			if( identifier_size == 0 )
+			{
+				file_values->identifiers[ identifiers_offset++ ] = 0;
+
+				continue;
+			}
+			if( libsigscan_scan_result_get_identifier(
+			     scan_result,
+			     &( file_values->identifiers[ identifiers_offset ] ),
+			     identifier_size,
+			     NULL ) != 1 )
+			{
+				goto on_error;
+			}
+			identifiers_offset += identifier_size;
+
+			file_values->identifiers[ identifiers_offset - 1 ] = 0;
+		}
+	}
+	PyThread_acquire_lock(
+	 pysigscan_scan_files->queue_lock,
+	 WAIT_LOCK );
+
+	if( pysigscan_scan_files->last_file_values == NULL )
+	{
+		pysigscan_scan_files->first_file_values = file_values;
+	}
+	else
+	{
+		pysigscan_scan_files->last_file_values->next_file_values = file_values;
+	}
+	pysigscan_scan_files->last_file_values = file_values;
+
+	if( pysigscan_scan_files->is_waiting != 0 )
+	{
+		pysigscan_scan_files->is_waiting = 0;
+
+		PyThread_release_lock(
+		 pysigscan_scan_files->signal_lock );
+	}
+	PyThread_release_lock(
+	 pysigscan_scan_files->queue_lock );
+
+	return( 1 );
+
+on_error:
+	pysigscan_scan_files_file_values_free(
+	 file_values );
+
+	return( -1 );
+}
+
+/* Thread function that scans the files
+ * This function does not hold the GIL
+ */
+void pysigscan_scan_files_thread(
+      pysigscan_scan_files_t *pysigscan_scan_files )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	if( pysigscan_scan_files == NULL )
+	{
+		return;
+	}
+	result = libsigscan_scanner_scan_files(
+	          pysigscan_scan_files->scanner_object->scanner,
+	          pysigscan_scan_files->filenames,
+	          pysigscan_scan_files->number_of_files,
+	          (int (*)(int, int, libsigscan_scan_state_t *, void *)) &pysigscan_scan_files_callback,
+	          (void *) pysigscan_scan_files,
+	          pysigscan_scan_files->number_of_threads,
+	          &error );
+
+	PyThread_acquire_lock(
+	 pysigscan_scan_files->queue_lock,
+	 WAIT_LOCK );
+
+	pysigscan_scan_files->scan_result = result;
+	pysigscan_scan_files->scan_error  = error;
+	pysigscan_scan_files->is_finished = 1;
+
+	if( pysigscan_scan_files->is_waiting != 0 )
+	{
+		pysigscan_scan_files->is_waiting = 0;
+
+		PyThread_release_lock(
+		 pysigscan_scan_files->signal_lock );
+	}
+	PyThread_release_lock(
+	 pysigscan_scan_files->queue_lock );
+
+	/* The scan files object can be freed after the finished lock is released
+	 */
+	PyThread_release_lock(
+	 pysigscan_scan_files->finished_lock );
+}
+
+/* The scan files iter() function
+ */
+PyObject *pysigscan_scan_files_iter(
+           pysigscan_scan_files_t *pysigscan_scan_files )
+{
+	static char *function = "pysigscan_scan_files_iter";
+
+	if( pysigscan_scan_files == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan files.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pysigscan_scan_files );
+
+	return( (PyObject *) pysigscan_scan_files );
+}
+
+/* The scan files iternext() function
+ * Returns a tuple of the path and a list of (offset, identifier) tuples
+ * or None if the file could not be scanned
+ */
+PyObject *pysigscan_scan_files_iternext(
+           pysigscan_scan_files_t *pysigscan_scan_files )
+{
+	pysigscan_scan_files_file_values_t *file_values = NULL;
+	libcerror_error_t *error                        = NULL;
+	PyObject *identifier_object                     = NULL;
+	PyObject *integer_object                        = NULL;
+	PyObject *path_object                           = NULL;
+	PyObject *results_list_object                   = NULL;
+	PyObject *result_tuple_object                   = NULL;
+	PyObject *tuple_object                          = NULL;
+	const char *errors                              = NULL;
+	const char *identifier                          = NULL;
+	static char *function                           = "pysigscan_scan_files_iternext";
+	size_t identifier_length                        = 0;
+	int is_finished                                 = 0;
+	int result_index                                = 0;
+	int scan_result                                 = 0;
+
+	if( pysigscan_scan_files == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan files.",
+		 function );
+
+		return( NULL );
+	}
+	if( pysigscan_scan_files->queue_lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan files - missing queue lock.",
+		 function );
+
+		return( NULL );
+	}
+	do
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pysigscan_scan_files->queue_lock,
+		 WAIT_LOCK );
+
+		Py_END_ALLOW_THREADS
+
+		file_values = pysigscan_scan_files->first_file_values;
+
+		if( file_values != NULL )
+		{
+			pysigscan_scan_files->first_file_values = file_values->next_file_values;
+
+			if( pysigscan_scan_files->first_file_values == NULL )
+			{
+				pysigscan_scan_files->last_file_values = NULL;
+			}
+		}
+		else if( pysigscan_scan_files->is_finished != 0 )
+		{
+			is_finished = 1;
+			scan_result = pysigscan_scan_files->scan_result;
+			error       = pysigscan_scan_files->scan_error;
+
+			pysigscan_scan_files->scan_result = 1;
+			pysigscan_scan_files->scan_error  = NULL;
+		}
+		else
+		{
+			pysigscan_scan_files->is_waiting = 1;
+		}
+		PyThread_release_lock(
+		 pysigscan_scan_files->queue_lock );
+
+		if( ( file_values == NULL )
+		 && ( is_finished == 0 ) )
+		{
+			/* Wait for the scan thread to signal that file values were queued
+			 * or that it has finished
+			 */
+			Py_BEGIN_ALLOW_THREADS
+
+			PyThread_acquire_lock(
+			 pysigscan_scan_files->signal_lock,
+			 WAIT_LOCK );
+
+			Py_END_ALLOW_THREADS
+		}
+	}
+	while( ( file_values == NULL )
+	    && ( is_finished == 0 ) );
+
+	if( file_values == NULL )
+	{
+		if( scan_result != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to scan files.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	if( file_values->file_result != 1 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		results_list_object = Py_None;
+	}
+	else
+	{
+		results_list_object = PyList_New(
+		                       (Py_ssize_t) file_values->number_of_results );
+
+		if( results_list_object == NULL )
+		{
+			goto on_error;
+		}
+		identifier = file_values->identifiers;
+
+		for( result_index = 0;
+		     result_index < file_values->number_of_results;
+		     result_index++ )
+		{
+			integer_object = pysigscan_integer_signed_new_from_64bit(
+			                  file_values->offsets[ result_index ] );
+
+			if( integer_object == NULL )
+			{
+				goto on_error;
+			}
+			identifier_length = narrow_string_length(
+			                     identifier );
+
+			identifier_object = PyUnicode_DecodeUTF8(
+			                     identifier,
+			                     (Py_ssize_t) identifier_length,
+			                     errors );
+
+			if( identifier_object == NULL )
+			{
+				goto on_error;
+			}
+			identifier += identifier_length + 1;
+
+			result_tuple_object = PyTuple_New(
+			                       2 );
+
+			if( result_tuple_object == NULL )
+			{
+				goto on_error;
+			}
+			/* PyTuple_SetItem steals a reference to the objects
+			 */
+			PyTuple_SetItem(
+			 result_tuple_object,
+			 0,
+			 integer_object );
+
+			integer_object = NULL;
+
+			PyTuple_SetItem(
+			 result_tuple_object,
+			 1,
+			 identifier_object );
+
+			identifier_object = NULL;
+
+			PyList_SET_ITEM(
+			 results_list_object,
+			 (Py_ssize_t) result_index,
+			 result_tuple_object );
+
+			result_tuple_object = NULL;
+		}
+	}
+	tuple_object = PyTuple_New(
+	                2 );
+
+	if( tuple_object == NULL )
+	{
+		goto on_error;
+	}
+	path_object = PySequence_Fast_GET_ITEM(
+	               pysigscan_scan_files->paths_object,
+	               file_values->file_index );
+
+	Py_IncRef(
+	 path_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 0,
+	 path_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 1,
+	 results_list_object );
+
+	pysigscan_scan_files_file_values_free(
+	 file_values );
+
+	return( tuple_object );
+
+on_error:
+	if( identifier_object != NULL )
+	{
+		Py_DecRef(
+		 identifier_object );
+	}
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	if( results_list_object != NULL )
+	{
+		Py_DecRef(
+		 results_list_object );
+	}
+	pysigscan_scan_files_file_values_free(
+	 file_values );
+
+	return( NULL );
+}
+
@@ -0,0 +1,179 @@
+/*
+ * Python object definition of the iterator object of scanning files
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSIGSCAN_SCAN_FILES_H )
+#define _PYSIGSCAN_SCAN_FILES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pysigscan_libcerror.h"
+#include "pysigscan_libsigscan.h"
+#include "pysigscan_python.h"
+#include "pysigscan_scanner.h"
+
+#include <pythread.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pysigscan_scan_files_file_values pysigscan_scan_files_file_values_t;
+
+struct pysigscan_scan_files_file_values
+{
+	/* The index of the file
+	 */
+	int file_index;
+
+	/* The result of scanning the file
+	 */
+	int file_result;
+
+	/* The number of scan results
+	 */
+	int number_of_results;
+
+	/* The offsets of the scan results
+	 */
+	int64_t *offsets;
+
+	/* The identifiers of the scan results, stored consecutively
+	 * as end-of-string character terminated strings
+	 */
+	char *identifiers;
+
+	/* The next file values in the queue
+	 */
+	pysigscan_scan_files_file_values_t *next_file_values;
+};
+
+typedef struct pysigscan_scan_files pysigscan_scan_files_t;
+
+struct pysigscan_scan_files
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The scanner object
+	 */
+	pysigscan_scanner_t *scanner_object;
+
+	/* The paths objects
+	 */
+	PyObject *paths_object;
+
+	/* The narrow string objects of the paths
+	 */
+	PyObject *filenames_object;
+
+	/* The filenames
+	 */
+	const char **filenames;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The lock that protects the queue and the state values
+	 */
+	PyThread_type_lock queue_lock;
+
+	/* The lock that is released to signal the iterator that it no longer needs to wait
+	 */
+	PyThread_type_lock signal_lock;
+
+	/* The lock that is released when the scan thread has finished
+	 */
+	PyThread_type_lock finished_lock;
+
+	/* The first file values in the queue
+	 */
+	pysigscan_scan_files_file_values_t *first_file_values;
+
+	/* The last file values in the queue
+	 */
+	pysigscan_scan_files_file_values_t *last_file_values;
+
+	/* Value to indicate the scan thread was started
+	 */
+	int thread_started;
+
+	/* Value to indicate the iterator is waiting for file values
+	 */
+	int is_waiting;
+
+	/* Value to indicate the scan thread has finished
+	 */
+	int is_finished;
+
+	/* Value to indicate scanning the files should be aborted
+	 */
+	int abort;
+
+	/* The result of scanning the files
+	 */
+	int scan_result;
+
+	/* The error of scanning the files
+	 */
+	libcerror_error_t *scan_error;
+};
+
+extern PyTypeObject pysigscan_scan_files_type_object;
+
+PyObject *pysigscan_scan_files_new(
+           pysigscan_scanner_t *scanner_object,
+           PyObject *paths_object,
+           int number_of_threads );
+
+int pysigscan_scan_files_init(
+     pysigscan_scan_files_t *pysigscan_scan_files );
+
+void pysigscan_scan_files_free(
+      pysigscan_scan_files_t *pysigscan_scan_files );
+
+int pysigscan_scan_files_callback(
+     int file_index,
+     int file_result,
+     libsigscan_scan_state_t *scan_state,
+     pysigscan_scan_files_t *pysigscan_scan_files );
+
+void pysigscan_scan_files_thread(
+      pysigscan_scan_files_t *pysigscan_scan_files );
+
+PyObject *pysigscan_scan_files_iter(
+           pysigscan_scan_files_t *pysigscan_scan_files );
+
+PyObject *pysigscan_scan_files_iternext(
+           pysigscan_scan_files_t *pysigscan_scan_files );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYSIGSCAN_SCAN_FILES_H ) */
+
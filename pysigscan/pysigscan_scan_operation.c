@@ -0,0 +1,739 @@
+/*
+ * Python object definition of an asynchronous scan operation
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pysigscan_error.h"
+#include "pysigscan_libcerror.h"
+#include "pysigscan_libsigscan.h"
+#include "pysigscan_python.h"
+#include "pysigscan_scan_operation.h"
+#include "pysigscan_scan_state.h"
+#include "pysigscan_scanner.h"
+#include "pysigscan_unused.h"
+
+#include <pythread.h>
+
+#if defined( HAVE_PYSIGSCAN_ASYNC )
+
+PyMethodDef pysigscan_scan_operation_complete_method_definition = {
+	"complete",
+	(PyCFunction) pysigscan_scan_operation_complete,
+	METH_NOARGS,
+	"complete() -> None\n"
+	"\n"
+	"Resolves the future of the scan operation." };
+
+PyTypeObject pysigscan_scan_operation_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pysigscan.scan_operation",
+	/* tp_basicsize */
+	sizeof( pysigscan_scan_operation_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pysigscan_scan_operation_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pysigscan asynchronous scan operation object",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pysigscan_scan_operation_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Retrieves the event loop of the current thread, as asyncio.ensure_future does
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scan_operation_get_event_loop(
+           void )
+{
+	PyObject *asyncio_module = NULL;
+	PyObject *event_loop     = NULL;
+
+	asyncio_module = PyImport_ImportModule(
+	                  "asyncio" );
+
+	if( asyncio_module == NULL )
+	{
+		return( NULL );
+	}
+	/* Returns the running event loop when called from a coroutine or callback
+	 */
+	event_loop = PyObject_CallMethod(
+	              asyncio_module,
+	              "get_event_loop",
+	              NULL );
+
+	Py_DecRef(
+	 asyncio_module );
+
+	return( event_loop );
+}
+
+/* Sets the exception that was raised as the exception of a future
+ * The exception is discarded if the future is already done
+ * Returns 1 if successful or -1 on error
+ */
+int pysigscan_scan_operation_set_future_exception(
+     PyObject *future )
+{
+	PyObject *exception_traceback = NULL;
+	PyObject *exception_type      = NULL;
+	PyObject *exception_value     = NULL;
+	PyObject *method_result       = NULL;
+	static char *function         = "pysigscan_scan_operation_set_future_exception";
+	int result                    = 0;
+
+	if( future == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid future.",
+		 function );
+
+		return( -1 );
+	}
+	PyErr_Fetch(
+	 &exception_type,
+	 &exception_value,
+	 &exception_traceback );
+
+	if( exception_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_RuntimeError,
+		 "%s: missing exception.",
+		 function );
+
+		return( -1 );
+	}
+	PyErr_NormalizeException(
+	 &exception_type,
+	 &exception_value,
+	 &exception_traceback );
+
+	if( exception_traceback != NULL )
+	{
+		PyException_SetTraceback(
+		 exception_value,
+		 exception_traceback );
+	}
+	method_result = PyObject_CallMethod(
+	                 future,
+	                 "done",
+	                 NULL );
+
+	if( method_result == NULL )
+	{
+		goto on_error;
+	}
+	result = PyObject_IsTrue(
+	          method_result );
+
+	Py_DecRef(
+	 method_result );
+
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		method_result = PyObject_CallMethod(
+		                 future,
+		                 "set_exception",
+		                 "O",
+		                 exception_value );
+
+		if( method_result == NULL )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 method_result );
+	}
+	Py_DecRef(
+	 exception_traceback );
+	Py_DecRef(
+	 exception_value );
+	Py_DecRef(
+	 exception_type );
+
+	return( 1 );
+
+on_error:
+	Py_DecRef(
+	 exception_traceback );
+	Py_DecRef(
+	 exception_value );
+	Py_DecRef(
+	 exception_type );
+
+	return( -1 );
+}
+
+/* Creates a new scan operation object
+ * The data object must be a bytes object that contains the buffer to scan
+ * or the narrow string of the filename to scan, or NULL to stop the scan
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scan_operation_new(
+           pysigscan_scanner_t *scanner_object,
+           pysigscan_scan_state_t *scan_state_object,
+           int operation_type,
+           PyObject *data_object,
+           PyObject *event_loop )
+{
+	pysigscan_scan_operation_t *pysigscan_scan_operation = NULL;
+	static char *function                                = "pysigscan_scan_operation_new";
+
+	if( scanner_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner object.",
+		 function );
+
+		return( NULL );
+	}
+	if( scan_state_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan state object.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( operation_type != PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_BUFFER )
+	 && ( operation_type != PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_FILE )
+	 && ( operation_type != PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_STOP ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported operation type.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( operation_type != PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_STOP )
+	 && ( data_object == NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data object.",
+		 function );
+
+		return( NULL );
+	}
+	if( event_loop == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid event loop.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the scan operation values are initialized
+	 */
+	pysigscan_scan_operation = PyObject_New(
+	                            struct pysigscan_scan_operation,
+	                            &pysigscan_scan_operation_type_object );
+
+	if( pysigscan_scan_operation == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create scan operation object.",
+		 function );
+
+		goto on_error;
+	}
+	pysigscan_scan_operation->scanner_object    = scanner_object;
+	pysigscan_scan_operation->scan_state_object = scan_state_object;
+	pysigscan_scan_operation->operation_type    = operation_type;
+	pysigscan_scan_operation->data_object       = data_object;
+	pysigscan_scan_operation->data              = NULL;
+	pysigscan_scan_operation->data_size         = 0;
+	pysigscan_scan_operation->event_loop        = event_loop;
+	pysigscan_scan_operation->future            = NULL;
+	pysigscan_scan_operation->scan_result       = -1;
+	pysigscan_scan_operation->scan_error        = NULL;
+
+	Py_IncRef(
+	 (PyObject *) pysigscan_scan_operation->scanner_object );
+
+	Py_IncRef(
+	 (PyObject *) pysigscan_scan_operation->scan_state_object );
+
+	Py_IncRef(
+	 pysigscan_scan_operation->data_object );
+
+	Py_IncRef(
+	 pysigscan_scan_operation->event_loop );
+
+	/* The data is retrieved while holding the GIL, the bytes object
+	 * is immutable and kept alive by the scan operation hence it
+	 * can be accessed by the scan thread
+	 */
+	if( data_object != NULL )
+	{
+		pysigscan_scan_operation->data = (const uint8_t *) PyBytes_AsString(
+		                                                    data_object );
+
+		if( pysigscan_scan_operation->data == NULL )
+		{
+			goto on_error;
+		}
+		pysigscan_scan_operation->data_size = (size_t) PyBytes_Size(
+		                                                data_object );
+	}
+	pysigscan_scan_operation->future = PyObject_CallMethod(
+	                                    event_loop,
+	                                    "create_future",
+	                                    NULL );
+
+	if( pysigscan_scan_operation->future == NULL )
+	{
+		goto on_error;
+	}
+	return( (PyObject *) pysigscan_scan_operation );
+
+on_error:
+	if( pysigscan_scan_operation != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pysigscan_scan_operation );
+	}
+	return( NULL );
+}
+
+/* Initializes a scan operation object
+ * Returns 0 if successful or -1 on error
+ */
+int pysigscan_scan_operation_init(
+     pysigscan_scan_operation_t *pysigscan_scan_operation )
+{
+	static char *function = "pysigscan_scan_operation_init";
+
+	if( pysigscan_scan_operation == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan operation.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the scan operation values are initialized
+	 */
+	pysigscan_scan_operation->scanner_object    = NULL;
+	pysigscan_scan_operation->scan_state_object = NULL;
+	pysigscan_scan_operation->data_object       = NULL;
+	pysigscan_scan_operation->event_loop        = NULL;
+	pysigscan_scan_operation->future            = NULL;
+	pysigscan_scan_operation->scan_error        = NULL;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of scan operation not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a scan operation object
+ */
+void pysigscan_scan_operation_free(
+      pysigscan_scan_operation_t *pysigscan_scan_operation )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pysigscan_scan_operation_free";
+
+	if( pysigscan_scan_operation == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan operation.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pysigscan_scan_operation );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pysigscan_scan_operation->scan_error != NULL )
+	{
+		libcerror_error_free(
+		 &( pysigscan_scan_operation->scan_error ) );
+	}
+	if( pysigscan_scan_operation->future != NULL )
+	{
+		Py_DecRef(
+		 pysigscan_scan_operation->future );
+	}
+	if( pysigscan_scan_operation->event_loop != NULL )
+	{
+		Py_DecRef(
+		 pysigscan_scan_operation->event_loop );
+	}
+	if( pysigscan_scan_operation->data_object != NULL )
+	{
+		Py_DecRef(
+		 pysigscan_scan_operation->data_object );
+	}
+	if( pysigscan_scan_operation->scan_state_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pysigscan_scan_operation->scan_state_object );
+	}
+	if( pysigscan_scan_operation->scanner_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pysigscan_scan_operation->scanner_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pysigscan_scan_operation );
+}
+
+/* Starts the scan operation on a thread that does not hold the GIL
+ * Returns the future that is resolved when the scan operation has completed or NULL on error
+ */
+PyObject *pysigscan_scan_operation_start(
+           pysigscan_scan_operation_t *pysigscan_scan_operation )
+{
+	static char *function = "pysigscan_scan_operation_start";
+
+	if( pysigscan_scan_operation == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan operation.",
+		 function );
+
+		return( NULL );
+	}
+	/* The scan thread holds a reference to the scan operation
+	 * that it releases after it has scheduled the completion
+	 */
+	Py_IncRef(
+	 (PyObject *) pysigscan_scan_operation );
+
+	if( PyThread_start_new_thread(
+	     (void (*)(void *)) &pysigscan_scan_operation_thread,
+	     (void *) pysigscan_scan_operation ) == PYTHREAD_INVALID_THREAD_ID )
+	{
+		Py_DecRef(
+		 (PyObject *) pysigscan_scan_operation );
+
+		PyErr_Format(
+		 PyExc_RuntimeError,
+		 "%s: unable to start scan thread.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 pysigscan_scan_operation->future );
+
+	return( pysigscan_scan_operation->future );
+}
+
+/* The scan operation thread function
+ */
+void pysigscan_scan_operation_thread(
+      pysigscan_scan_operation_t *pysigscan_scan_operation )
+{
+	PyObject *callback_object  = NULL;
+	PyObject *method_result    = NULL;
+	libcerror_error_t *error   = NULL;
+	static char *function      = "pysigscan_scan_operation_thread";
+	PyGILState_STATE gil_state = 0;
+	int result                 = -1;
+
+	if( pysigscan_scan_operation == NULL )
+	{
+		return;
+	}
+	switch( pysigscan_scan_operation->operation_type )
+	{
+		case PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_BUFFER:
+			result = libsigscan_scanner_scan_buffer(
+			          pysigscan_scan_operation->scanner_object->scanner,
+			          pysigscan_scan_operation->scan_state_object->scan_state,
+			          pysigscan_scan_operation->data,
+			          pysigscan_scan_operation->data_size,
+			          &error );
+			break;
+
+		case PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_FILE:
+			result = libsigscan_scanner_scan_file(
+			          pysigscan_scan_operation->scanner_object->scanner,
+			          pysigscan_scan_operation->scan_state_object->scan_state,
+			          (const char *) pysigscan_scan_operation->data,
+			          &error );
+			break;
+
+		case PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_STOP:
+			result = libsigscan_scanner_scan_stop(
+			          pysigscan_scan_operation->scanner_object->scanner,
+			          pysigscan_scan_operation->scan_state_object->scan_state,
+			          &error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported operation type.",
+			 function );
+
+			break;
+	}
+	pysigscan_scan_operation->scan_result = result;
+	pysigscan_scan_operation->scan_error  = error;
+
+	gil_state = PyGILState_Ensure();
+
+	/* The future is resolved on the thread of the event loop
+	 * since asyncio futures are not thread-safe
+	 */
+	callback_object = PyCFunction_New(
+	                   &pysigscan_scan_operation_complete_method_definition,
+	                   (PyObject *) pysigscan_scan_operation );
+
+	if( callback_object != NULL )
+	{
+		method_result = PyObject_CallMethod(
+		                 pysigscan_scan_operation->event_loop,
+		                 "call_soon_threadsafe",
+		                 "O",
+		                 callback_object );
+	}
+	/* Scheduling fails if the event loop was closed in the meantime
+	 */
+	if( method_result == NULL )
+	{
+		PyErr_Clear();
+	}
+	Py_DecRef(
+	 method_result );
+
+	Py_DecRef(
+	 callback_object );
+
+	Py_DecRef(
+	 (PyObject *) pysigscan_scan_operation );
+
+	PyGILState_Release(
+	 gil_state );
+}
+
+/* Resolves the future of the scan operation
+ * This function is called on the thread of the event loop
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scan_operation_complete(
+           pysigscan_scan_operation_t *pysigscan_scan_operation,
+           PyObject *arguments PYSIGSCAN_ATTRIBUTE_UNUSED )
+{
+	PyObject *method_result = NULL;
+	static char *function   = "pysigscan_scan_operation_complete";
+	int result              = 0;
+
+	PYSIGSCAN_UNREFERENCED_PARAMETER( arguments )
+
+	if( pysigscan_scan_operation == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan operation.",
+		 function );
+
+		return( NULL );
+	}
+	/* The future is already done if it was cancelled
+	 */
+	method_result = PyObject_CallMethod(
+	                 pysigscan_scan_operation->future,
+	                 "done",
+	                 NULL );
+
+	if( method_result == NULL )
+	{
+		return( NULL );
+	}
+	result = PyObject_IsTrue(
+	          method_result );
+
+	Py_DecRef(
+	 method_result );
+
+	if( result == -1 )
+	{
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		if( pysigscan_scan_operation->scan_result == 1 )
+		{
+			method_result = PyObject_CallMethod(
+			                 pysigscan_scan_operation->future,
+			                 "set_result",
+			                 "O",
+			                 Py_None );
+
+			if( method_result == NULL )
+			{
+				return( NULL );
+			}
+			Py_DecRef(
+			 method_result );
+		}
+		else
+		{
+			pysigscan_error_raise(
+			 pysigscan_scan_operation->scan_error,
+			 PyExc_IOError,
+			 "%s: unable to scan.",
+			 function );
+
+			libcerror_error_free(
+			 &( pysigscan_scan_operation->scan_error ) );
+
+			if( pysigscan_scan_operation_set_future_exception(
+			     pysigscan_scan_operation->future ) != 1 )
+			{
+				return( NULL );
+			}
+		}
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+#endif /* defined( HAVE_PYSIGSCAN_ASYNC ) */
+
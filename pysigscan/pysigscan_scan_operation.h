@@ -0,0 +1,138 @@
+/*
+ * Python object definition of an asynchronous scan operation
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSIGSCAN_SCAN_OPERATION_H )
+#define _PYSIGSCAN_SCAN_OPERATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pysigscan_libcerror.h"
+#include "pysigscan_libsigscan.h"
+#include "pysigscan_python.h"
+#include "pysigscan_scan_state.h"
+#include "pysigscan_scanner.h"
+
+#if defined( HAVE_PYSIGSCAN_ASYNC )
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The scan operation types
+ */
+enum PYSIGSCAN_SCAN_OPERATION_TYPES
+{
+	PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_BUFFER	= 1,
+	PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_FILE		= 2,
+	PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_STOP		= 3
+};
+
+typedef struct pysigscan_scan_operation pysigscan_scan_operation_t;
+
+struct pysigscan_scan_operation
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The scanner object
+	 */
+	pysigscan_scanner_t *scanner_object;
+
+	/* The scan state object
+	 */
+	pysigscan_scan_state_t *scan_state_object;
+
+	/* The operation type
+	 */
+	int operation_type;
+
+	/* The bytes object that contains the buffer or the narrow string of the filename
+	 */
+	PyObject *data_object;
+
+	/* The data of the data object
+	 */
+	const uint8_t *data;
+
+	/* The size of the data of the data object
+	 */
+	size_t data_size;
+
+	/* The event loop
+	 */
+	PyObject *event_loop;
+
+	/* The future that is resolved when the scan operation has completed
+	 */
+	PyObject *future;
+
+	/* The result of the scan operation
+	 */
+	int scan_result;
+
+	/* The error of the scan operation
+	 */
+	libcerror_error_t *scan_error;
+};
+
+extern PyMethodDef pysigscan_scan_operation_complete_method_definition;
+
+extern PyTypeObject pysigscan_scan_operation_type_object;
+
+PyObject *pysigscan_scan_operation_get_event_loop(
+           void );
+
+int pysigscan_scan_operation_set_future_exception(
+     PyObject *future );
+
+PyObject *pysigscan_scan_operation_new(
+           pysigscan_scanner_t *scanner_object,
+           pysigscan_scan_state_t *scan_state_object,
+           int operation_type,
+           PyObject *data_object,
+           PyObject *event_loop );
+
+int pysigscan_scan_operation_init(
+     pysigscan_scan_operation_t *pysigscan_scan_operation );
+
+void pysigscan_scan_operation_free(
+      pysigscan_scan_operation_t *pysigscan_scan_operation );
+
+PyObject *pysigscan_scan_operation_start(
+           pysigscan_scan_operation_t *pysigscan_scan_operation );
+
+void pysigscan_scan_operation_thread(
+      pysigscan_scan_operation_t *pysigscan_scan_operation );
+
+PyObject *pysigscan_scan_operation_complete(
+           pysigscan_scan_operation_t *pysigscan_scan_operation,
+           PyObject *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* defined( HAVE_PYSIGSCAN_ASYNC ) */
+
+#endif /* !defined( _PYSIGSCAN_SCAN_OPERATION_H ) */
+
@@ -27,6 +27,7 @@
 #endif
 
 #include "pysigscan_error.h"
+#include "pysigscan_integer.h"
 #include "pysigscan_libcerror.h"
 #include "pysigscan_libsigscan.h"
 #include "pysigscan_python.h"
@@ -43,6 +44,13 @@ PyMethodDef pysigscan_scan_result_object_methods[] = {
 	  "\n"
 	  "Retrieves the identifier." },
 
+	{ "get_offset",
+	  (PyCFunction) pysigscan_scan_result_get_offset,
+	  METH_NOARGS,
+	  "get_offset() -> Integer\n"
+	  "\n"
+	  "Retrieves the offset." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -55,6 +63,12 @@ PyGetSetDef pysigscan_scan_result_object_get_set_definitions[] = {
 	  "The identifier.",
 	  NULL },
 
+	{ "offset",
+	  (getter) pysigscan_scan_result_get_offset,
+	  (setter) 0,
+	  "The offset.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -428,3 +442,55 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the offset
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scan_result_get_offset(
+           pysigscan_scan_result_t *pysigscan_scan_result,
+           PyObject *arguments PYSIGSCAN_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	PyObject *integer_object = NULL;
+	static char *function    = "pysigscan_scan_result_get_offset";
+	off64_t offset           = 0;
+	int result               = 0;
+
+	PYSIGSCAN_UNREFERENCED_PARAMETER( arguments )
+
+	if( pysigscan_scan_result == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid scan result.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libsigscan_scan_result_get_offset(
+	          pysigscan_scan_result->scan_result,
+	          &offset,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pysigscan_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve offset.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pysigscan_integer_signed_new_from_64bit(
+	                  (int64_t) offset );
+
+	return( integer_object );
+}
+
@@ -68,6 +68,10 @@ PyObject *pysigscan_scan_result_get_identifier(
            pysigscan_scan_result_t *pysigscan_scan_result,
            PyObject *arguments );
 
+PyObject *pysigscan_scan_result_get_offset(
+           pysigscan_scan_result_t *pysigscan_scan_result,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
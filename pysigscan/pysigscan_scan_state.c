@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
@@ -60,6 +61,17 @@ PyMethodDef pysigscan_scan_state_object_methods[] = {
 	  "\n"
 	  "Retrieves a specific scan result." },
 
+	{ "get_scan_results_array",
+	  (PyCFunction) pysigscan_scan_state_get_scan_results_array,
+	  METH_NOARGS,
+	  "get_scan_results_array() -> Tuple(Object, List)\n"
+	  "\n"
+	  "Retrieves the offsets and identifiers of all scan results at once.\n"
+	  "The offsets are returned as an array.array of type 'q', which supports\n"
+	  "the buffer protocol, e.g. numpy.frombuffer(offsets, dtype=numpy.int64).\n"
+	  "The identifiers are returned as a list of Unicode strings where results\n"
+	  "of the same signature share the same string object." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -600,3 +612,387 @@ PyObject *pysigscan_scan_state_get_scan_results(
 	return( scan_results_object );
 }
 
+/* Retrieves the offsets and identifiers of the scan results
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scan_state_get_scan_results_array(
+           pysigscan_scan_state_t *pysigscan_scan_state,
+           PyObject *arguments PYSIGSCAN_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error                = NULL;
+	libsigscan_scan_result_t *scan_result   = NULL;
+	PyObject *array_module                  = NULL;
+	PyObject *identifier_object             = NULL;
+	PyObject *identifiers_dictionary_object = NULL;
+	PyObject *identifiers_list_object       = NULL;
+	PyObject *last_identifier_object        = NULL;
+	PyObject *offsets_array_object          = NULL;
+	PyObject *offsets_bytes_object          = NULL;
+	PyObject *shared_identifier_object      = NULL;
+	PyObject *tuple_object                  = NULL;
+	const char *errors                      = NULL;
+	char *identifier                        = NULL;
+	char *last_identifier                   = NULL;
+	char *reallocation                      = NULL;
+	int64_t *offsets                        = NULL;
+	static char *function                   = "pysigscan_scan_state_get_scan_results_array";
+	size_t identifier_buffer_size           = 0;
+	size_t identifier_size                  = 0;
+	size_t last_identifier_size             = 0;
+	off64_t offset                          = 0;
+	int number_of_results                   = 0;
+	int result_index                        = 0;
+
+	PYSIGSCAN_UNREFERENCED_PARAMETER( arguments )
+
+	if( pysigscan_scan_state == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( NULL );
+	}
+	if( libsigscan_scan_state_get_number_of_results(
+	     pysigscan_scan_state->scan_state,
+	     &number_of_results,
+	     &error ) != 1 )
+	{
+		pysigscan_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of scan results.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	offsets_bytes_object = PyBytes_FromStringAndSize(
+	                        NULL,
+	                        (Py_ssize_t) ( sizeof( int64_t ) * number_of_results ) );
+
+	if( offsets_bytes_object == NULL )
+	{
+		goto on_error;
+	}
+	offsets = (int64_t *) PyBytes_AsString(
+	                       offsets_bytes_object );
+
+	identifiers_list_object = PyList_New(
+	                           (Py_ssize_t) number_of_results );
+
+	if( identifiers_list_object == NULL )
+	{
+		goto on_error;
+	}
+	/* The dictionary maps an identifier to the string object that is shared
+	 * by all the scan results with that identifier
+	 */
+	identifiers_dictionary_object = PyDict_New();
+
+	if( identifiers_dictionary_object == NULL )
+	{
+		goto on_error;
+	}
+	/* The scan results are stored in memory hence the GIL is not released
+	 * per scan result, since that would cost more than retrieving the values
+	 */
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( libsigscan_scan_state_get_result(
+		     pysigscan_scan_state->scan_state,
+		     result_index,
+		     &scan_result,
+		     &error ) != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve scan result: %d.",
+			 function,
+			 result_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_result_get_offset(
+		     scan_result,
+		     &offset,
+		     &error ) != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve scan result: %d offset.",
+			 function,
+			 result_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		offsets[ result_index ] = (int64_t) offset;
+
+		if( libsigscan_scan_result_get_identifier_size(
+		     scan_result,
+		     &identifier_size,
+		     &error ) != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve scan result: %d identifier size.",
+			 function,
+			 result_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		if( identifier_size == 0 )
+		{
+			shared_identifier_object = Py_None;
+		}
+		else
+		{
+			if( identifier_size > identifier_buffer_size )
+			{
+				reallocation = (char *) PyMem_Realloc(
+				                         identifier,
+				                         sizeof( char ) * identifier_size );
+
+				if( reallocation == NULL )
+				{
+					PyErr_Format(
+					 PyExc_MemoryError,
+					 "%s: unable to resize identifier.",
+					 function );
+
+					goto on_error;
+				}
+				identifier = reallocation;
+
+				reallocation = (char *) PyMem_Realloc(
+				                         last_identifier,
+				                         sizeof( char ) * identifier_size );
+
+				if( reallocation == NULL )
+				{
+					PyErr_Format(
+					 PyExc_MemoryError,
+					 "%s: unable to resize last identifier.",
+					 function );
+
+					goto on_error;
+				}
+				last_identifier = reallocation;
+
+				identifier_buffer_size = identifier_size;
+			}
+			if( libsigscan_scan_result_get_identifier(
+			     scan_result,
+			     identifier,
+			     identifier_size,
+			     &error ) != 1 )
+			{
+				pysigscan_error_raise(
+				 error,
+				 PyExc_IOError,
+				 "%s: unable to retrieve scan result: %d identifier.",
+				 function,
+				 result_index );
+
+				libcerror_error_free(
+				 &error );
+
+				goto on_error;
+			}
+			/* Consecutive scan results commonly have the same identifier
+			 */
+			if( ( last_identifier_object != NULL )
+			 && ( identifier_size == last_identifier_size )
+			 && ( memory_compare(
+			       identifier,
+			       last_identifier,
+			       identifier_size ) == 0 ) )
+			{
+				shared_identifier_object = last_identifier_object;
+			}
+			else
+			{
+				/* Pass the string length to PyUnicode_DecodeUTF8
+				 * otherwise it makes the end of string character is part
+				 * of the string
+				 */
+				identifier_object = PyUnicode_DecodeUTF8(
+				                     identifier,
+				                     (Py_ssize_t) identifier_size - 1,
+				                     errors );
+
+				if( identifier_object == NULL )
+				{
+					goto on_error;
+				}
+				shared_identifier_object = PyDict_GetItem(
+				                            identifiers_dictionary_object,
+				                            identifier_object );
+
+				if( shared_identifier_object == NULL )
+				{
+					if( PyDict_SetItem(
+					     identifiers_dictionary_object,
+					     identifier_object,
+					     identifier_object ) != 0 )
+					{
+						goto on_error;
+					}
+					shared_identifier_object = identifier_object;
+				}
+				Py_DecRef(
+				 identifier_object );
+
+				identifier_object = NULL;
+
+				/* Swap the identifier buffers so that the current identifier
+				 * becomes the last identifier
+				 */
+				reallocation    = last_identifier;
+				last_identifier = identifier;
+				identifier      = reallocation;
+
+				last_identifier_size   = identifier_size;
+				last_identifier_object = shared_identifier_object;
+			}
+		}
+		Py_IncRef(
+		 shared_identifier_object );
+
+		PyList_SET_ITEM(
+		 identifiers_list_object,
+		 (Py_ssize_t) result_index,
+		 shared_identifier_object );
+	}
+	if( identifier != NULL )
+	{
+		PyMem_Free(
+		 identifier );
+
+		identifier = NULL;
+	}
+	if( last_identifier != NULL )
+	{
+		PyMem_Free(
+		 last_identifier );
+
+		last_identifier = NULL;
+	}
+	Py_DecRef(
+	 identifiers_dictionary_object );
+
+	identifiers_dictionary_object = NULL;
+
+	/* The offsets are stored in an array of signed 64-bit integers
+	 * that is created from the bytes buffer
+	 */
+	array_module = PyImport_ImportModule(
+	                "array" );
+
+	if( array_module == NULL )
+	{
+		goto on_error;
+	}
+	offsets_array_object = PyObject_CallMethod(
+	                        array_module,
+	                        "array",
+	                        "sO",
+	                        "q",
+	                        offsets_bytes_object );
+
+	if( offsets_array_object == NULL )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 array_module );
+
+	array_module = NULL;
+
+	Py_DecRef(
+	 offsets_bytes_object );
+
+	offsets_bytes_object = NULL;
+
+	tuple_object = PyTuple_New(
+	                2 );
+
+	if( tuple_object == NULL )
+	{
+		goto on_error;
+	}
+	/* PyTuple_SetItem steals a reference to the objects
+	 */
+	PyTuple_SetItem(
+	 tuple_object,
+	 0,
+	 offsets_array_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 1,
+	 identifiers_list_object );
+
+	return( tuple_object );
+
+on_error:
+	if( offsets_array_object != NULL )
+	{
+		Py_DecRef(
+		 offsets_array_object );
+	}
+	if( array_module != NULL )
+	{
+		Py_DecRef(
+		 array_module );
+	}
+	if( identifier_object != NULL )
+	{
+		Py_DecRef(
+		 identifier_object );
+	}
+	if( last_identifier != NULL )
+	{
+		PyMem_Free(
+		 last_identifier );
+	}
+	if( identifier != NULL )
+	{
+		PyMem_Free(
+		 identifier );
+	}
+	if( identifiers_dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 identifiers_dictionary_object );
+	}
+	if( identifiers_list_object != NULL )
+	{
+		Py_DecRef(
+		 identifiers_list_object );
+	}
+	if( offsets_bytes_object != NULL )
+	{
+		Py_DecRef(
+		 offsets_bytes_object );
+	}
+	return( NULL );
+}
+
@@ -80,6 +80,10 @@ PyObject *pysigscan_scan_state_get_scan_results(
            pysigscan_scan_state_t *pysigscan_scan_state,
            PyObject *arguments );
 
+PyObject *pysigscan_scan_state_get_scan_results_array(
+           pysigscan_scan_state_t *pysigscan_scan_state,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,941 @@
+/*
+ * Python object definition of the asynchronous iterator object of scanning a stream
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pysigscan_error.h"
+#include "pysigscan_libcerror.h"
+#include "pysigscan_libsigscan.h"
+#include "pysigscan_python.h"
+#include "pysigscan_scan_operation.h"
+#include "pysigscan_scan_state.h"
+#include "pysigscan_scan_stream.h"
+#include "pysigscan_scanner.h"
+
+#if defined( HAVE_PYSIGSCAN_ASYNC )
+
+PyMethodDef pysigscan_scan_stream_read_done_method_definition = {
+	"read_done",
+	(PyCFunction) pysigscan_scan_stream_read_done,
+	METH_O,
+	"read_done(read_task) -> None\n"
+	"\n"
+	"Scans the data that was read from the stream." };
+
+PyMethodDef pysigscan_scan_stream_scan_done_method_definition = {
+	"scan_done",
+	(PyCFunction) pysigscan_scan_stream_scan_done,
+	METH_O,
+	"scan_done(scan_future) -> None\n"
+	"\n"
+	"Continues after the data that was read from the stream was scanned." };
+
+PyAsyncMethods pysigscan_scan_stream_async_methods = {
+	/* am_await */
+	0,
+	/* am_aiter */
+	(unaryfunc) pysigscan_scan_stream_aiter,
+	/* am_anext */
+	(unaryfunc) pysigscan_scan_stream_anext
+};
+
+PyTypeObject pysigscan_scan_stream_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pysigscan.scan_stream",
+	/* tp_basicsize */
+	sizeof( pysigscan_scan_stream_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pysigscan_scan_stream_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_as_async */
+	&pysigscan_scan_stream_async_methods,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pysigscan asynchronous iterator object of scanning a stream",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pysigscan_scan_stream_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new scan stream object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scan_stream_new(
+           pysigscan_scanner_t *scanner_object,
+           pysigscan_scan_state_t *scan_state_object,
+           PyObject *reader_object,
+           Py_ssize_t read_size )
+{
+	pysigscan_scan_stream_t *pysigscan_scan_stream = NULL;
+	static char *function                          = "pysigscan_scan_stream_new";
+
+	if( scanner_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner object.",
+		 function );
+
+		return( NULL );
+	}
+	if( scan_state_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan state object.",
+		 function );
+
+		return( NULL );
+	}
+	if( reader_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid reader object.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_size <= 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read size value zero or less.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the scan stream values are initialized
+	 */
+	pysigscan_scan_stream = PyObject_New(
+	                         struct pysigscan_scan_stream,
+	                         &pysigscan_scan_stream_type_object );
+
+	if( pysigscan_scan_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create scan stream object.",
+		 function );
+
+		return( NULL );
+	}
+	pysigscan_scan_stream->scanner_object    = scanner_object;
+	pysigscan_scan_stream->scan_state_object = scan_state_object;
+	pysigscan_scan_stream->reader_object     = reader_object;
+	pysigscan_scan_stream->read_size         = read_size;
+	pysigscan_scan_stream->event_loop        = NULL;
+	pysigscan_scan_stream->result_future     = NULL;
+	pysigscan_scan_stream->result_index      = 0;
+	pysigscan_scan_stream->is_started        = 0;
+	pysigscan_scan_stream->is_busy           = 0;
+	pysigscan_scan_stream->is_stopping       = 0;
+	pysigscan_scan_stream->is_finished       = 0;
+
+	Py_IncRef(
+	 (PyObject *) pysigscan_scan_stream->scanner_object );
+
+	Py_IncRef(
+	 (PyObject *) pysigscan_scan_stream->scan_state_object );
+
+	Py_IncRef(
+	 pysigscan_scan_stream->reader_object );
+
+	return( (PyObject *) pysigscan_scan_stream );
+}
+
+/* Initializes a scan stream object
+ * Returns 0 if successful or -1 on error
+ */
+int pysigscan_scan_stream_init(
+     pysigscan_scan_stream_t *pysigscan_scan_stream )
+{
+	static char *function = "pysigscan_scan_stream_init";
+
+	if( pysigscan_scan_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the scan stream values are initialized
+	 */
+	pysigscan_scan_stream->scanner_object    = NULL;
+	pysigscan_scan_stream->scan_state_object = NULL;
+	pysigscan_scan_stream->reader_object     = NULL;
+	pysigscan_scan_stream->event_loop        = NULL;
+	pysigscan_scan_stream->result_future     = NULL;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of scan stream not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a scan stream object
+ */
+void pysigscan_scan_stream_free(
+      pysigscan_scan_stream_t *pysigscan_scan_stream )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pysigscan_scan_stream_free";
+
+	if( pysigscan_scan_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan stream.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pysigscan_scan_stream );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pysigscan_scan_stream->result_future != NULL )
+	{
+		Py_DecRef(
+		 pysigscan_scan_stream->result_future );
+	}
+	if( pysigscan_scan_stream->event_loop != NULL )
+	{
+		Py_DecRef(
+		 pysigscan_scan_stream->event_loop );
+	}
+	if( pysigscan_scan_stream->reader_object != NULL )
+	{
+		Py_DecRef(
+		 pysigscan_scan_stream->reader_object );
+	}
+	if( pysigscan_scan_stream->scan_state_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pysigscan_scan_stream->scan_state_object );
+	}
+	if( pysigscan_scan_stream->scanner_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pysigscan_scan_stream->scanner_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pysigscan_scan_stream );
+}
+
+/* Sets the exception that was raised as the exception of the result future
+ * and releases the reference to the result future
+ * Returns 1 if successful or -1 on error
+ */
+int pysigscan_scan_stream_set_result_exception(
+     pysigscan_scan_stream_t *pysigscan_scan_stream )
+{
+	static char *function = "pysigscan_scan_stream_set_result_exception";
+	int result            = 0;
+
+	if( pysigscan_scan_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* The exception is discarded if there is no result future
+	 */
+	if( pysigscan_scan_stream->result_future == NULL )
+	{
+		PyErr_Clear();
+
+		return( 1 );
+	}
+	result = pysigscan_scan_operation_set_future_exception(
+	          pysigscan_scan_stream->result_future );
+
+	Py_DecRef(
+	 pysigscan_scan_stream->result_future );
+
+	pysigscan_scan_stream->result_future = NULL;
+
+	return( result );
+}
+
+/* Resolves the result future with the next scan result or reads more data from the stream
+ * This function must not be called while a read or scan operation is in progress
+ * or without a result future
+ * Returns 1 if successful or -1 on error
+ */
+int pysigscan_scan_stream_next_step(
+     pysigscan_scan_stream_t *pysigscan_scan_stream )
+{
+	PyObject *asyncio_module     = NULL;
+	PyObject *callback_object    = NULL;
+	PyObject *method_result      = NULL;
+	PyObject *read_object        = NULL;
+	PyObject *read_task          = NULL;
+	PyObject *scan_result_object = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "pysigscan_scan_stream_next_step";
+	int number_of_results        = 0;
+	int result                   = 0;
+
+	if( pysigscan_scan_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan stream.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_scan_state_get_number_of_results(
+	          pysigscan_scan_stream->scan_state_object->scan_state,
+	          &number_of_results,
+	          &error );
+
+	if( result != 1 )
+	{
+		pysigscan_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of scan results.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( pysigscan_scan_stream->result_index < number_of_results )
+	{
+		scan_result_object = pysigscan_scan_state_get_scan_result_by_index(
+		                      (PyObject *) pysigscan_scan_stream->scan_state_object,
+		                      pysigscan_scan_stream->result_index );
+
+		if( scan_result_object == NULL )
+		{
+			goto on_error;
+		}
+		pysigscan_scan_stream->result_index += 1;
+
+		method_result = PyObject_CallMethod(
+		                 pysigscan_scan_stream->result_future,
+		                 "set_result",
+		                 "O",
+		                 scan_result_object );
+
+		Py_DecRef(
+		 scan_result_object );
+	}
+	else if( pysigscan_scan_stream->is_finished != 0 )
+	{
+		method_result = PyObject_CallMethod(
+		                 pysigscan_scan_stream->result_future,
+		                 "set_exception",
+		                 "O",
+		                 PyExc_StopAsyncIteration );
+	}
+	else
+	{
+		/* The stream is only read when the next scan result is awaited
+		 * hence the consumer of the scan results applies backpressure
+		 */
+		read_object = PyObject_CallMethod(
+		               pysigscan_scan_stream->reader_object,
+		               "read",
+		               "n",
+		               pysigscan_scan_stream->read_size );
+
+		if( read_object == NULL )
+		{
+			goto on_error;
+		}
+		asyncio_module = PyImport_ImportModule(
+		                  "asyncio" );
+
+		if( asyncio_module == NULL )
+		{
+			goto on_error;
+		}
+		read_task = PyObject_CallMethod(
+		             asyncio_module,
+		             "ensure_future",
+		             "O",
+		             read_object );
+
+		if( read_task == NULL )
+		{
+			goto on_error;
+		}
+		callback_object = PyCFunction_New(
+		                   &pysigscan_scan_stream_read_done_method_definition,
+		                   (PyObject *) pysigscan_scan_stream );
+
+		if( callback_object == NULL )
+		{
+			goto on_error;
+		}
+		method_result = PyObject_CallMethod(
+		                 read_task,
+		                 "add_done_callback",
+		                 "O",
+		                 callback_object );
+
+		if( method_result != NULL )
+		{
+			pysigscan_scan_stream->is_busy = 1;
+		}
+		Py_DecRef(
+		 callback_object );
+
+		Py_DecRef(
+		 read_task );
+
+		Py_DecRef(
+		 asyncio_module );
+
+		Py_DecRef(
+		 read_object );
+	}
+	if( method_result == NULL )
+	{
+		return( -1 );
+	}
+	Py_DecRef(
+	 method_result );
+
+	/* The reference to the result future is released when it is resolved
+	 * since its exception can reference the frame of the consumer
+	 */
+	if( pysigscan_scan_stream->is_busy == 0 )
+	{
+		Py_DecRef(
+		 pysigscan_scan_stream->result_future );
+
+		pysigscan_scan_stream->result_future = NULL;
+	}
+	return( 1 );
+
+on_error:
+	Py_DecRef(
+	 read_task );
+
+	Py_DecRef(
+	 asyncio_module );
+
+	Py_DecRef(
+	 read_object );
+
+	return( -1 );
+}
+
+/* Scans the data that was read from the stream
+ * This function is called on the thread of the event loop when the read task is done
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scan_stream_read_done(
+           pysigscan_scan_stream_t *pysigscan_scan_stream,
+           PyObject *read_task )
+{
+	PyObject *callback_object   = NULL;
+	PyObject *data_object       = NULL;
+	PyObject *method_result     = NULL;
+	PyObject *scan_future       = NULL;
+	PyObject *scan_operation    = NULL;
+	static char *function       = "pysigscan_scan_stream_read_done";
+	int operation_type          = PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_BUFFER;
+
+	if( pysigscan_scan_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan stream.",
+		 function );
+
+		return( NULL );
+	}
+	data_object = PyObject_CallMethod(
+	               read_task,
+	               "result",
+	               NULL );
+
+	if( data_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyBytes_Check(
+	     data_object ) == 0 )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported data object type returned by read.",
+		 function );
+
+		goto on_error;
+	}
+	/* The end of the stream is reached when read returns no data
+	 */
+	if( PyBytes_Size(
+	     data_object ) == 0 )
+	{
+		Py_DecRef(
+		 data_object );
+
+		data_object    = NULL;
+		operation_type = PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_STOP;
+
+		pysigscan_scan_stream->is_stopping = 1;
+	}
+	scan_operation = pysigscan_scan_operation_new(
+	                  pysigscan_scan_stream->scanner_object,
+	                  pysigscan_scan_stream->scan_state_object,
+	                  operation_type,
+	                  data_object,
+	                  pysigscan_scan_stream->event_loop );
+
+	if( scan_operation == NULL )
+	{
+		goto on_error;
+	}
+	scan_future = pysigscan_scan_operation_start(
+	               (pysigscan_scan_operation_t *) scan_operation );
+
+	if( scan_future == NULL )
+	{
+		goto on_error;
+	}
+	callback_object = PyCFunction_New(
+	                   &pysigscan_scan_stream_scan_done_method_definition,
+	                   (PyObject *) pysigscan_scan_stream );
+
+	if( callback_object == NULL )
+	{
+		goto on_error;
+	}
+	method_result = PyObject_CallMethod(
+	                 scan_future,
+	                 "add_done_callback",
+	                 "O",
+	                 callback_object );
+
+	if( method_result == NULL )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 method_result );
+
+	Py_DecRef(
+	 callback_object );
+
+	Py_DecRef(
+	 scan_future );
+
+	Py_DecRef(
+	 scan_operation );
+
+	Py_DecRef(
+	 data_object );
+
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+
+on_error:
+	Py_DecRef(
+	 callback_object );
+
+	Py_DecRef(
+	 scan_future );
+
+	Py_DecRef(
+	 scan_operation );
+
+	Py_DecRef(
+	 data_object );
+
+	/* The scan thread will not continue the stream if it was not started
+	 */
+	if( scan_future == NULL )
+	{
+		pysigscan_scan_stream->is_busy = 0;
+	}
+	if( pysigscan_scan_stream_set_result_exception(
+	     pysigscan_scan_stream ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Continues after the data that was read from the stream was scanned
+ * This function is called on the thread of the event loop when the scan future is done
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scan_stream_scan_done(
+           pysigscan_scan_stream_t *pysigscan_scan_stream,
+           PyObject *scan_future )
+{
+	PyObject *method_result = NULL;
+	static char *function   = "pysigscan_scan_stream_scan_done";
+	int result              = 0;
+
+	if( pysigscan_scan_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan stream.",
+		 function );
+
+		return( NULL );
+	}
+	pysigscan_scan_stream->is_busy = 0;
+
+	if( pysigscan_scan_stream->is_stopping != 0 )
+	{
+		pysigscan_scan_stream->is_finished = 1;
+	}
+	/* Retrieving the result raises the exception of the scan operation if it failed
+	 */
+	method_result = PyObject_CallMethod(
+	                 scan_future,
+	                 "result",
+	                 NULL );
+
+	if( method_result == NULL )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 method_result );
+
+	/* The next step is taken by the next call to anext if the result future was cancelled
+	 */
+	if( pysigscan_scan_stream->result_future == NULL )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	method_result = PyObject_CallMethod(
+	                 pysigscan_scan_stream->result_future,
+	                 "done",
+	                 NULL );
+
+	if( method_result == NULL )
+	{
+		goto on_error;
+	}
+	result = PyObject_IsTrue(
+	          method_result );
+
+	Py_DecRef(
+	 method_result );
+
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( pysigscan_scan_stream_next_step(
+		     pysigscan_scan_stream ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+
+on_error:
+	if( pysigscan_scan_stream_set_result_exception(
+	     pysigscan_scan_stream ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* The scan stream aiter() function
+ */
+PyObject *pysigscan_scan_stream_aiter(
+           pysigscan_scan_stream_t *pysigscan_scan_stream )
+{
+	static char *function = "pysigscan_scan_stream_aiter";
+
+	if( pysigscan_scan_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pysigscan_scan_stream );
+
+	return( (PyObject *) pysigscan_scan_stream );
+}
+
+/* The scan stream anext() function
+ * Returns a future that is resolved with the next scan result
+ */
+PyObject *pysigscan_scan_stream_anext(
+           pysigscan_scan_stream_t *pysigscan_scan_stream )
+{
+	PyObject *method_result  = NULL;
+	PyObject *result_future  = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pysigscan_scan_stream_anext";
+	int result               = 0;
+
+	if( pysigscan_scan_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( pysigscan_scan_stream->result_future != NULL )
+	{
+		method_result = PyObject_CallMethod(
+		                 pysigscan_scan_stream->result_future,
+		                 "done",
+		                 NULL );
+
+		if( method_result == NULL )
+		{
+			return( NULL );
+		}
+		result = PyObject_IsTrue(
+		          method_result );
+
+		Py_DecRef(
+		 method_result );
+
+		if( result == -1 )
+		{
+			return( NULL );
+		}
+		else if( result == 0 )
+		{
+			PyErr_Format(
+			 PyExc_RuntimeError,
+			 "%s: previous scan result is still awaited.",
+			 function );
+
+			return( NULL );
+		}
+		Py_DecRef(
+		 pysigscan_scan_stream->result_future );
+
+		pysigscan_scan_stream->result_future = NULL;
+	}
+	if( pysigscan_scan_stream->event_loop == NULL )
+	{
+		pysigscan_scan_stream->event_loop = pysigscan_scan_operation_get_event_loop();
+
+		if( pysigscan_scan_stream->event_loop == NULL )
+		{
+			return( NULL );
+		}
+	}
+	if( pysigscan_scan_stream->is_started == 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libsigscan_scanner_scan_start(
+		          pysigscan_scan_stream->scanner_object->scanner,
+		          pysigscan_scan_stream->scan_state_object->scan_state,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to start scan.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		pysigscan_scan_stream->is_started = 1;
+	}
+	result_future = PyObject_CallMethod(
+	                 pysigscan_scan_stream->event_loop,
+	                 "create_future",
+	                 NULL );
+
+	if( result_future == NULL )
+	{
+		return( NULL );
+	}
+	Py_IncRef(
+	 result_future );
+
+	pysigscan_scan_stream->result_future = result_future;
+
+	/* If a read or scan operation is in progress, for example because
+	 * the previous result future was cancelled, the next step is taken
+	 * when the operation has completed
+	 */
+	if( pysigscan_scan_stream->is_busy == 0 )
+	{
+		if( pysigscan_scan_stream_next_step(
+		     pysigscan_scan_stream ) != 1 )
+		{
+			if( pysigscan_scan_stream_set_result_exception(
+			     pysigscan_scan_stream ) != 1 )
+			{
+				Py_DecRef(
+				 result_future );
+
+				return( NULL );
+			}
+		}
+	}
+	return( result_future );
+}
+
+#endif /* defined( HAVE_PYSIGSCAN_ASYNC ) */
+
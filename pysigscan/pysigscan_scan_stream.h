@@ -0,0 +1,139 @@
+/*
+ * Python object definition of the asynchronous iterator object of scanning a stream
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSIGSCAN_SCAN_STREAM_H )
+#define _PYSIGSCAN_SCAN_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pysigscan_libcerror.h"
+#include "pysigscan_libsigscan.h"
+#include "pysigscan_python.h"
+#include "pysigscan_scan_state.h"
+#include "pysigscan_scanner.h"
+
+#if defined( HAVE_PYSIGSCAN_ASYNC )
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pysigscan_scan_stream pysigscan_scan_stream_t;
+
+struct pysigscan_scan_stream
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The scanner object
+	 */
+	pysigscan_scanner_t *scanner_object;
+
+	/* The scan state object
+	 */
+	pysigscan_scan_state_t *scan_state_object;
+
+	/* The reader object
+	 */
+	PyObject *reader_object;
+
+	/* The read size
+	 */
+	Py_ssize_t read_size;
+
+	/* The event loop
+	 */
+	PyObject *event_loop;
+
+	/* The future of the scan result that is currently awaited
+	 */
+	PyObject *result_future;
+
+	/* The index of the next scan result
+	 */
+	int result_index;
+
+	/* Value to indicate the scan was started
+	 */
+	int is_started;
+
+	/* Value to indicate a read or scan operation is in progress
+	 */
+	int is_busy;
+
+	/* Value to indicate the end of the stream was reached and the scan is being stopped
+	 */
+	int is_stopping;
+
+	/* Value to indicate the scan was stopped
+	 */
+	int is_finished;
+};
+
+extern PyMethodDef pysigscan_scan_stream_read_done_method_definition;
+extern PyMethodDef pysigscan_scan_stream_scan_done_method_definition;
+
+extern PyAsyncMethods pysigscan_scan_stream_async_methods;
+
+extern PyTypeObject pysigscan_scan_stream_type_object;
+
+PyObject *pysigscan_scan_stream_new(
+           pysigscan_scanner_t *scanner_object,
+           pysigscan_scan_state_t *scan_state_object,
+           PyObject *reader_object,
+           Py_ssize_t read_size );
+
+int pysigscan_scan_stream_init(
+     pysigscan_scan_stream_t *pysigscan_scan_stream );
+
+void pysigscan_scan_stream_free(
+      pysigscan_scan_stream_t *pysigscan_scan_stream );
+
+int pysigscan_scan_stream_set_result_exception(
+     pysigscan_scan_stream_t *pysigscan_scan_stream );
+
+int pysigscan_scan_stream_next_step(
+     pysigscan_scan_stream_t *pysigscan_scan_stream );
+
+PyObject *pysigscan_scan_stream_read_done(
+           pysigscan_scan_stream_t *pysigscan_scan_stream,
+           PyObject *read_task );
+
+PyObject *pysigscan_scan_stream_scan_done(
+           pysigscan_scan_stream_t *pysigscan_scan_stream,
+           PyObject *scan_future );
+
+PyObject *pysigscan_scan_stream_aiter(
+           pysigscan_scan_stream_t *pysigscan_scan_stream );
+
+PyObject *pysigscan_scan_stream_anext(
+           pysigscan_scan_stream_t *pysigscan_scan_stream );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* defined( HAVE_PYSIGSCAN_ASYNC ) */
+
+#endif /* !defined( _PYSIGSCAN_SCAN_STREAM_H ) */
+
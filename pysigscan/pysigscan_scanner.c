@@ -33,7 +33,10 @@
 #include "pysigscan_libsigscan.h"
 #include "pysigscan_python.h"
 #include "pysigscan_scanner.h"
+#include "pysigscan_scan_files.h"
+#include "pysigscan_scan_operation.h"
 #include "pysigscan_scan_state.h"
+#include "pysigscan_scan_stream.h"
 #include "pysigscan_unused.h"
 
 #if !defined( LIBSIGSCAN_HAVE_BFIO )
@@ -61,7 +64,24 @@ PyMethodDef pysigscan_scanner_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "set_scan_buffer_size(buffer_size) -> None\n"
 	  "\n"
-	  "Set the size of the scan buffer." },
+	  "Set the size of the scan buffer, where 0 represents the size is\n"
+	  "determined automatically." },
+
+	{ "set_number_of_read_buffers",
+	  (PyCFunction) pysigscan_scanner_set_number_of_read_buffers,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_number_of_read_buffers(number_of_read_buffers) -> None\n"
+	  "\n"
+	  "Set the number of read buffers, where a value larger than 1 reads ahead\n"
+	  "in a separate thread while the previously read data is scanned." },
+
+	{ "set_direct_io",
+	  (PyCFunction) pysigscan_scanner_set_direct_io,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_direct_io(direct_io) -> None\n"
+	  "\n"
+	  "Set if files that are scanned by name are read using direct IO,\n"
+	  "bypassing the page cache." },
 
 	/* Functions to access signatures */
 
@@ -93,7 +113,8 @@ PyMethodDef pysigscan_scanner_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "scan_buffer(scan_state, buffer) -> None\n"
 	  "\n"
-	  "Scans the buffer." },
+	  "Scans the buffer, which can be any object that supports the buffer\n"
+	  "protocol, such as bytes, bytearray, memoryview or mmap, without copying it." },
 
 	{ "scan_file",
 	  (PyCFunction) pysigscan_scanner_scan_file,
@@ -109,6 +130,40 @@ PyMethodDef pysigscan_scanner_object_methods[] = {
 	  "\n"
 	  "Scans a file using a file-like object." },
 
+	{ "scan_files",
+	  (PyCFunction) pysigscan_scanner_scan_files,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "scan_files(paths, threads=1) -> Object\n"
+	  "\n"
+	  "Scans files on a native thread pool of threads that do not hold the GIL.\n"
+	  "Returns an iterator that yields a (path, scan_results) tuple per file,\n"
+	  "in the order in which the files are scanned, where scan_results is a list\n"
+	  "of (offset, identifier) tuples or None if the file could not be scanned." },
+
+#if defined( HAVE_PYSIGSCAN_ASYNC )
+
+	{ "scan_file_async",
+	  (PyCFunction) pysigscan_scanner_scan_file_async,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "scan_file_async(scan_state, filename) -> Object\n"
+	  "\n"
+	  "Scans a file on a native thread that does not hold the GIL.\n"
+	  "Returns an asyncio future of the current event loop that is resolved\n"
+	  "when the file was scanned. The scan state must not be used until then." },
+
+	{ "scan_stream",
+	  (PyCFunction) pysigscan_scanner_scan_stream,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "scan_stream(scan_state, reader, read_size=65536) -> Object\n"
+	  "\n"
+	  "Scans the data returned by awaiting reader.read(read_size), such as\n"
+	  "of an asyncio.StreamReader, until it returns no data. Returns an\n"
+	  "asynchronous iterator that yields the scan results as they are found.\n"
+	  "The data is only read when the next scan result is awaited and is\n"
+	  "scanned on a native thread that does not hold the GIL." },
+
+#endif /* defined( HAVE_PYSIGSCAN_ASYNC ) */
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -467,6 +522,108 @@ PyObject *pysigscan_scanner_set_scan_buffer_size(
 	return( Py_None );
 }
 
+/* Sets the number of read buffers
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scanner_set_number_of_read_buffers(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pysigscan_scanner_set_number_of_read_buffers";
+	static char *keyword_list[] = { "number_of_read_buffers", NULL };
+	int number_of_read_buffers  = 0;
+	int result                  = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &number_of_read_buffers ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libsigscan_scanner_set_number_of_read_buffers(
+	          pysigscan_scanner->scanner,
+	          number_of_read_buffers,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pysigscan_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set number of read buffers.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Sets if files are read using direct IO
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scanner_set_direct_io(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pysigscan_scanner_set_direct_io";
+	static char *keyword_list[] = { "direct_io", NULL };
+	int direct_io               = 0;
+	int result                  = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &direct_io ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libsigscan_scanner_set_direct_io(
+	          pysigscan_scanner->scanner,
+	          ( direct_io != 0 ) ? 1 : 0,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pysigscan_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set direct IO.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
 /* Adds a signature
  * Returns a Python object if successful or NULL on error
  */
@@ -853,14 +1010,14 @@ PyObject *pysigscan_scanner_scan_buffer(
            PyObject *arguments,
            PyObject *keywords )
 {
+	Py_buffer buffer;
+
 	pysigscan_scan_state_t *pysigscan_scan_state = NULL;
-	PyObject *string_object                      = NULL;
+	PyObject *buffer_object                      = NULL;
 	PyObject *scan_state_object                  = NULL;
 	libcerror_error_t *error                     = NULL;
 	static char *function                        = "pysigscan_scanner_scan_buffer";
 	static char *keyword_list[]                  = { "scan_state", "buffer", NULL };
-	char *buffer                                 = NULL;
-	Py_ssize_t buffer_size                       = 0;
 	int result                                   = 0;
 
 	if( pysigscan_scanner == NULL )
@@ -878,7 +1035,7 @@ PyObject *pysigscan_scanner_scan_buffer(
 	     "OO",
 	     keyword_list,
 	     &scan_state_object,
-	     &string_object ) == 0 )
+	     &buffer_object ) == 0 )
 	{
 		return( NULL );
 	}
@@ -908,22 +1065,27 @@ PyObject *pysigscan_scanner_scan_buffer(
 	}
 	pysigscan_scan_state = (pysigscan_scan_state_t *) scan_state_object;
 
-#if PY_MAJOR_VERSION >= 3
-	buffer = PyBytes_AsString(
-		  string_object );
-
-	buffer_size = PyBytes_Size(
-		       string_object );
-#else
-	buffer = PyString_AsString(
-		  string_object );
+	/* The buffer is scanned in place, the buffer view keeps the data valid
+	 * while the GIL is released until the view is released
+	 */
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer,
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		pysigscan_error_fetch_and_raise(
+		 PyExc_TypeError,
+		 "%s: unsupported buffer object type.",
+		 function );
 
-	buffer_size = PyString_Size(
-		       string_object );
-#endif
-	if( ( buffer_size < 0 )
-	 || ( buffer_size > (Py_ssize_t) SSIZE_MAX ) )
+		return( NULL );
+	}
+	if( ( buffer.len < 0 )
+	 || ( buffer.len > (Py_ssize_t) SSIZE_MAX ) )
 	{
+		PyBuffer_Release(
+		 &buffer );
+
 		PyErr_Format(
 		 PyExc_ValueError,
 		 "%s: invalid argument buffer size value out of bounds.",
@@ -936,12 +1098,15 @@ PyObject *pysigscan_scanner_scan_buffer(
 	result = libsigscan_scanner_scan_buffer(
 		  pysigscan_scanner->scanner,
 		  pysigscan_scan_state->scan_state,
-		  (uint8_t *) buffer,
-		  buffer_size,
+		  (uint8_t *) buffer.buf,
+		  (size_t) buffer.len,
 		  &error );
 
 	Py_END_ALLOW_THREADS
 
+	PyBuffer_Release(
+	 &buffer );
+
 	if( result != 1 )
 	{
 		pysigscan_error_raise(
@@ -1321,3 +1486,305 @@ on_error:
 	return( NULL );
 }
 
+/* Scans files
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scanner_scan_files(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *paths_object      = NULL;
+	PyObject *scan_files_object = NULL;
+	static char *function       = "pysigscan_scanner_scan_files";
+	static char *keyword_list[] = { "paths", "threads", NULL };
+	int number_of_threads       = 1;
+
+	if( pysigscan_scanner == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|i",
+	     keyword_list,
+	     &paths_object,
+	     &number_of_threads ) == 0 )
+	{
+		return( NULL );
+	}
+	if( number_of_threads < 1 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of threads value less than 1.",
+		 function );
+
+		return( NULL );
+	}
+	scan_files_object = pysigscan_scan_files_new(
+	                     pysigscan_scanner,
+	                     paths_object,
+	                     number_of_threads );
+
+	return( scan_files_object );
+}
+
+#if defined( HAVE_PYSIGSCAN_ASYNC )
+
+/* Scans a file asynchronously
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scanner_scan_file_async(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *event_loop        = NULL;
+	PyObject *filename_object   = NULL;
+	PyObject *future            = NULL;
+	PyObject *scan_operation    = NULL;
+	PyObject *scan_state_object = NULL;
+	PyObject *string_object     = NULL;
+	static char *function       = "pysigscan_scanner_scan_file_async";
+	static char *keyword_list[] = { "scan_state", "filename", NULL };
+	int result                  = 0;
+
+	if( pysigscan_scanner == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OO",
+	     keyword_list,
+	     &scan_state_object,
+	     &string_object ) == 0 )
+	{
+		return( NULL );
+	}
+	PyErr_Clear();
+
+	result = PyObject_IsInstance(
+	          scan_state_object,
+	          (PyObject *) &pysigscan_scan_state_type_object );
+
+	if( result == -1 )
+	{
+		pysigscan_error_fetch_and_raise(
+	         PyExc_RuntimeError,
+		 "%s: unable to determine if state object is of type pysigscan_scan_state.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported state object type.",
+		 function );
+
+		return( NULL );
+	}
+	/* The filename is passed to the library as a narrow string, where a Unicode string
+	 * is converted to UTF-8 as in scan_files
+	 */
+	PyErr_Clear();
+
+	result = PyObject_IsInstance(
+	          string_object,
+	          (PyObject *) &PyUnicode_Type );
+
+	if( result == -1 )
+	{
+		pysigscan_error_fetch_and_raise(
+	         PyExc_RuntimeError,
+		 "%s: unable to determine if string object is of type unicode.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		filename_object = PyUnicode_AsUTF8String(
+		                   string_object );
+
+		if( filename_object == NULL )
+		{
+			pysigscan_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to convert unicode string to UTF-8.",
+			 function );
+
+			return( NULL );
+		}
+	}
+	else
+	{
+		PyErr_Clear();
+
+		result = PyObject_IsInstance(
+		          string_object,
+		          (PyObject *) &PyBytes_Type );
+
+		if( result == -1 )
+		{
+			pysigscan_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to determine if string object is of type string.",
+			 function );
+
+			return( NULL );
+		}
+		else if( result == 0 )
+		{
+			PyErr_Format(
+			 PyExc_TypeError,
+			 "%s: unsupported string object type.",
+			 function );
+
+			return( NULL );
+		}
+		filename_object = string_object;
+
+		Py_IncRef(
+		 filename_object );
+	}
+	event_loop = pysigscan_scan_operation_get_event_loop();
+
+	if( event_loop == NULL )
+	{
+		goto on_error;
+	}
+	scan_operation = pysigscan_scan_operation_new(
+	                  pysigscan_scanner,
+	                  (pysigscan_scan_state_t *) scan_state_object,
+	                  PYSIGSCAN_SCAN_OPERATION_TYPE_SCAN_FILE,
+	                  filename_object,
+	                  event_loop );
+
+	if( scan_operation == NULL )
+	{
+		goto on_error;
+	}
+	future = pysigscan_scan_operation_start(
+	          (pysigscan_scan_operation_t *) scan_operation );
+
+	if( future == NULL )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 scan_operation );
+
+	Py_DecRef(
+	 event_loop );
+
+	Py_DecRef(
+	 filename_object );
+
+	return( future );
+
+on_error:
+	Py_DecRef(
+	 scan_operation );
+
+	Py_DecRef(
+	 event_loop );
+
+	Py_DecRef(
+	 filename_object );
+
+	return( NULL );
+}
+
+/* Scans a stream asynchronously
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scanner_scan_stream(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *reader_object     = NULL;
+	PyObject *scan_state_object = NULL;
+	static char *function       = "pysigscan_scanner_scan_stream";
+	static char *keyword_list[] = { "scan_state", "reader", "read_size", NULL };
+	Py_ssize_t read_size        = 65536;
+	int result                  = 0;
+
+	if( pysigscan_scanner == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OO|n",
+	     keyword_list,
+	     &scan_state_object,
+	     &reader_object,
+	     &read_size ) == 0 )
+	{
+		return( NULL );
+	}
+	PyErr_Clear();
+
+	result = PyObject_IsInstance(
+	          scan_state_object,
+	          (PyObject *) &pysigscan_scan_state_type_object );
+
+	if( result == -1 )
+	{
+		pysigscan_error_fetch_and_raise(
+	         PyExc_RuntimeError,
+		 "%s: unable to determine if state object is of type pysigscan_scan_state.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported state object type.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_size <= 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read size value zero or less.",
+		 function );
+
+		return( NULL );
+	}
+	return( pysigscan_scan_stream_new(
+	         pysigscan_scanner,
+	         (pysigscan_scan_state_t *) scan_state_object,
+	         reader_object,
+	         read_size ) );
+}
+
+#endif /* defined( HAVE_PYSIGSCAN_ASYNC ) */
+
@@ -66,6 +66,16 @@ PyObject *pysigscan_scanner_set_scan_buffer_size(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pysigscan_scanner_set_number_of_read_buffers(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pysigscan_scanner_set_direct_io(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pysigscan_scanner_add_signature(
            pysigscan_scanner_t *pysigscan_scanner,
            PyObject *arguments,
@@ -96,6 +106,25 @@ PyObject *pysigscan_scanner_scan_file_object(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pysigscan_scanner_scan_files(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#if defined( HAVE_PYSIGSCAN_ASYNC )
+
+PyObject *pysigscan_scanner_scan_file_async(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pysigscan_scanner_scan_stream(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#endif /* defined( HAVE_PYSIGSCAN_ASYNC ) */
+
 #if defined( __cplusplus )
 }
 #endif
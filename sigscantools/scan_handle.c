@@ -20,18 +20,28 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
 #include <types.h>
 
 #include "scan_handle.h"
 #include "sigscantools_libcerror.h"
 #include "sigscantools_libcfile.h"
 #include "sigscantools_libsigscan.h"
+#include "sigscantools_libuna.h"
 
 #define SCAN_HANDLE_BUFFER_SIZE			16 * 1024 * 1024
 #define SCAN_HANDLE_NOTIFY_STREAM		stdout
 
+/* The scan buffer size and number of read buffers used for direct IO,
+ * where the data is not read ahead by the operating system
+ */
+#define SCAN_HANDLE_DIRECT_IO_SCAN_BUFFER_SIZE	1024 * 1024
+#define SCAN_HANDLE_DIRECT_IO_READ_BUFFERS	4
+
 /* Creates a scan handle
  * Make sure the value scan_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -213,6 +223,157 @@ int scan_handle_signal_abort(
 	return( 1 );
 }
 
+/* Sets if the input is read using direct IO
+ * Direct IO is combined with larger scan buffers that are read ahead
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_set_direct_io(
+     scan_handle_t *scan_handle,
+     int direct_io,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_set_direct_io";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scanner_set_direct_io(
+	     scan_handle->scanner,
+	     direct_io,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set direct IO in scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io != 0 )
+	{
+		if( libsigscan_scanner_set_scan_buffer_size(
+		     scan_handle->scanner,
+		     SCAN_HANDLE_DIRECT_IO_SCAN_BUFFER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set scan buffer size in scanner.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsigscan_scanner_set_number_of_read_buffers(
+		     scan_handle->scanner,
+		     SCAN_HANDLE_DIRECT_IO_READ_BUFFERS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set number of read buffers in scanner.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scan_handle_set_output_format(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "bin" ),
+		     3 ) == 0 )
+		{
+			scan_handle->output_format = SCAN_HANDLE_OUTPUT_FORMAT_BINARY;
+			result                     = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "tsv" ),
+		          3 ) == 0 )
+		{
+			scan_handle->output_format = SCAN_HANDLE_OUTPUT_FORMAT_TSV;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
+		{
+			scan_handle->output_format = SCAN_HANDLE_OUTPUT_FORMAT_TEXT;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
+		{
+			scan_handle->output_format = SCAN_HANDLE_OUTPUT_FORMAT_JSONL;
+			result                     = 1;
+		}
+	}
+	return( result );
+}
+
 /* Copies the string to an offset
  * Returns 1 if successful or -1 on error
  */
@@ -995,19 +1156,40 @@ int scan_handle_scan_input(
 
 		return( -1 );
 	}
-	if( scan_handle_scan_results_fprint(
-	     scan_handle,
-	     scan_state,
-	     error ) != 1 )
+	if( scan_handle->output_format == SCAN_HANDLE_OUTPUT_FORMAT_TEXT )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-		 "%s: unable to print scan results.",
-		 function );
+		if( scan_handle_scan_results_fprint(
+		     scan_handle,
+		     scan_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print scan results.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( scan_handle_scan_results_write_records(
+		     scan_handle,
+		     scan_state,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write scan results.",
+			 function );
+
+			return( -1 );
+		}
 	}
 	return( 1 );
 }
@@ -1192,3 +1374,1248 @@ on_error:
 	return( -1 );
 }
 
+/* Determines the size of the UTF-8 encoded character at a specific index
+ * Overlong encodings, surrogates and code points above U+10FFFF are invalid
+ * Returns 1 if successful, 0 if the UTF-8 encoded character is invalid or -1 on error
+ */
+int scan_handle_get_utf8_character_size(
+     const uint8_t *string,
+     size_t string_size,
+     size_t string_index,
+     size_t *utf8_character_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "scan_handle_get_utf8_character_size";
+	size_t character_index         = 0;
+	size_t character_size          = 0;
+	uint8_t byte_value             = 0;
+	uint8_t maximum_byte_value     = 0xbf;
+	uint8_t minimum_byte_value     = 0x80;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index >= string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_character_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 character size.",
+		 function );
+
+		return( -1 );
+	}
+	byte_value = string[ string_index ];
+
+	if( byte_value < 0x80 )
+	{
+		character_size = 1;
+	}
+	else if( ( byte_value >= 0xc2 )
+	      && ( byte_value <= 0xdf ) )
+	{
+		character_size = 2;
+	}
+	else if( ( byte_value >= 0xe0 )
+	      && ( byte_value <= 0xef ) )
+	{
+		if( byte_value == 0xe0 )
+		{
+			minimum_byte_value = 0xa0;
+		}
+		else if( byte_value == 0xed )
+		{
+			maximum_byte_value = 0x9f;
+		}
+		character_size = 3;
+	}
+	else if( ( byte_value >= 0xf0 )
+	      && ( byte_value <= 0xf4 ) )
+	{
+		if( byte_value == 0xf0 )
+		{
+			minimum_byte_value = 0x90;
+		}
+		else if( byte_value == 0xf4 )
+		{
+			maximum_byte_value = 0x8f;
+		}
+		character_size = 4;
+	}
+	else
+	{
+		return( 0 );
+	}
+	if( character_size > ( string_size - string_index ) )
+	{
+		return( 0 );
+	}
+	/* The range of the second byte depends on the first byte
+	 * the range of the remaining bytes is always 0x80 - 0xbf
+	 */
+	for( character_index = 1;
+	     character_index < character_size;
+	     character_index++ )
+	{
+		byte_value = string[ string_index + character_index ];
+
+		if( ( byte_value < minimum_byte_value )
+		 || ( byte_value > maximum_byte_value ) )
+		{
+			return( 0 );
+		}
+		maximum_byte_value = 0xbf;
+		minimum_byte_value = 0x80;
+	}
+	*utf8_character_size = character_size;
+
+	return( 1 );
+}
+
+/* Writes a string escaped for the output format
+ * Backslash, tab, newline and carriage return characters are escaped for the tsv
+ * and jsonl output formats, quote and other control characters for jsonl
+ * Since JSON requires valid UTF-8 every byte of an invalid UTF-8 encoded
+ * character is replaced by U+FFFD for jsonl
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_write_escaped_string(
+     scan_handle_t *scan_handle,
+     const uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	char escaped_character[ 7 ];
+
+	const char *escape_sequence    = NULL;
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "scan_handle_write_escaped_string";
+	size_t run_index               = 0;
+	size_t string_index            = 0;
+	size_t utf8_character_size     = 0;
+	uint8_t byte_value             = 0;
+	int result                     = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Consecutive characters that do not need to be escaped are written at once
+	 */
+	for( string_index = 0;
+	     string_index < string_size;
+	     string_index++ )
+	{
+		byte_value      = string[ string_index ];
+		escape_sequence = NULL;
+
+		if( byte_value == (uint8_t) '\\' )
+		{
+			escape_sequence = "\\\\";
+		}
+		else if( byte_value == (uint8_t) '\t' )
+		{
+			escape_sequence = "\\t";
+		}
+		else if( byte_value == (uint8_t) '\n' )
+		{
+			escape_sequence = "\\n";
+		}
+		else if( byte_value == (uint8_t) '\r' )
+		{
+			escape_sequence = "\\r";
+		}
+		else if( scan_handle->output_format == SCAN_HANDLE_OUTPUT_FORMAT_JSONL )
+		{
+			if( byte_value == (uint8_t) '"' )
+			{
+				escape_sequence = "\\\"";
+			}
+			else if( byte_value < 0x20 )
+			{
+				escaped_character[ 0 ] = '\\';
+				escaped_character[ 1 ] = 'u';
+				escaped_character[ 2 ] = '0';
+				escaped_character[ 3 ] = '0';
+				escaped_character[ 4 ] = hexadecimal_digits[ byte_value >> 4 ];
+				escaped_character[ 5 ] = hexadecimal_digits[ byte_value & 0x0f ];
+				escaped_character[ 6 ] = 0;
+
+				escape_sequence = escaped_character;
+			}
+			else if( byte_value >= 0x80 )
+			{
+				result = scan_handle_get_utf8_character_size(
+				          string,
+				          string_size,
+				          string_index,
+				          &utf8_character_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine UTF-8 character size.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					escape_sequence = "\\ufffd";
+				}
+				else
+				{
+					string_index += utf8_character_size - 1;
+				}
+			}
+		}
+		if( escape_sequence != NULL )
+		{
+			if( string_index > run_index )
+			{
+				fwrite(
+				 &( string[ run_index ] ),
+				 1,
+				 string_index - run_index,
+				 scan_handle->notify_stream );
+			}
+			fputs(
+			 escape_sequence,
+			 scan_handle->notify_stream );
+
+			run_index = string_index + 1;
+		}
+	}
+	if( string_size > run_index )
+	{
+		fwrite(
+		 &( string[ run_index ] ),
+		 1,
+		 string_size - run_index,
+		 scan_handle->notify_stream );
+	}
+	return( 1 );
+}
+
+/* Writes a scan result record in the output format
+ * The path and identifier are UTF-8 strings without end-of-string character
+ *
+ * A bin record consists of a 64-bit offset, a 32-bit path size and
+ * a 32-bit identifier size, all stored in little-endian, followed by
+ * the path and identifier
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_write_record(
+     scan_handle_t *scan_handle,
+     const uint8_t *path,
+     size_t path_size,
+     off64_t offset,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     libcerror_error_t **error )
+{
+	uint8_t record_header[ 16 ];
+
+	static char *function = "scan_handle_write_record";
+	int result            = 1;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid identifier size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( scan_handle->output_format )
+	{
+		case SCAN_HANDLE_OUTPUT_FORMAT_BINARY:
+			byte_stream_copy_from_uint64_little_endian(
+			 &( record_header[ 0 ] ),
+			 (uint64_t) offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( record_header[ 8 ] ),
+			 (uint32_t) path_size );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( record_header[ 12 ] ),
+			 (uint32_t) identifier_size );
+
+			fwrite(
+			 record_header,
+			 1,
+			 16,
+			 scan_handle->notify_stream );
+
+			fwrite(
+			 path,
+			 1,
+			 path_size,
+			 scan_handle->notify_stream );
+
+			fwrite(
+			 identifier,
+			 1,
+			 identifier_size,
+			 scan_handle->notify_stream );
+
+			break;
+
+		case SCAN_HANDLE_OUTPUT_FORMAT_JSONL:
+			fputs(
+			 "{\"path\":\"",
+			 scan_handle->notify_stream );
+
+			result = scan_handle_write_escaped_string(
+			          scan_handle,
+			          path,
+			          path_size,
+			          error );
+
+			if( result == 1 )
+			{
+				fprintf(
+				 scan_handle->notify_stream,
+				 "\",\"offset\":%" PRIi64 ",\"identifier\":\"",
+				 (int64_t) offset );
+
+				result = scan_handle_write_escaped_string(
+				          scan_handle,
+				          identifier,
+				          identifier_size,
+				          error );
+			}
+			if( result == 1 )
+			{
+				fputs(
+				 "\"}\n",
+				 scan_handle->notify_stream );
+			}
+			break;
+
+		case SCAN_HANDLE_OUTPUT_FORMAT_TSV:
+			result = scan_handle_write_escaped_string(
+			          scan_handle,
+			          path,
+			          path_size,
+			          error );
+
+			if( result == 1 )
+			{
+				fprintf(
+				 scan_handle->notify_stream,
+				 "\t%" PRIi64 "\t",
+				 (int64_t) offset );
+
+				result = scan_handle_write_escaped_string(
+				          scan_handle,
+				          identifier,
+				          identifier_size,
+				          error );
+			}
+			if( result == 1 )
+			{
+				fputc(
+				 '\n',
+				 scan_handle->notify_stream );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported output format.",
+			 function );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write escaped string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a record per scan result in the output format
+ * The records are written to the buffered output stream as soon as the file
+ * was scanned, without waiting for other files to be scanned
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_results_write_records(
+     scan_handle_t *scan_handle,
+     libsigscan_scan_state_t *scan_state,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_result_t *scan_result = NULL;
+	uint8_t *identifier                   = NULL;
+	uint8_t *path                         = NULL;
+	void *reallocation                    = NULL;
+	static char *function                 = "scan_handle_scan_results_write_records";
+	size_t identifier_size                = 0;
+	size_t maximum_identifier_size        = 0;
+	size_t path_size                      = 0;
+	off64_t offset                        = 0;
+	int number_of_results                 = 0;
+	int result_index                      = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t filename_length                = 0;
+	size_t utf8_path_size                 = 0;
+	int result                            = 0;
+#endif
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_get_number_of_results(
+	     scan_state,
+	     &number_of_results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of scan results.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_results == 0 )
+	{
+		return( 1 );
+	}
+	/* The path is written as an UTF-8 string
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	filename_length = system_string_length(
+	                   filename );
+
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_size_from_utf32(
+	          (libuna_utf32_character_t *) filename,
+	          filename_length + 1,
+	          &utf8_path_size,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_size_from_utf16(
+	          (libuna_utf16_character_t *) filename,
+	          filename_length + 1,
+	          &utf8_path_size,
+	          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 path size.",
+		 function );
+
+		goto on_error;
+	}
+	path = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * utf8_path_size );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_copy_from_utf32(
+	          (libuna_utf8_character_t *) path,
+	          utf8_path_size,
+	          (libuna_utf32_character_t *) filename,
+	          filename_length + 1,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_copy_from_utf16(
+	          (libuna_utf8_character_t *) path,
+	          utf8_path_size,
+	          (libuna_utf16_character_t *) filename,
+	          filename_length + 1,
+	          error );
+#endif /* SIZEOF_WCHAR_T */
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+	path_size = utf8_path_size - 1;
+#else
+	path      = (uint8_t *) filename;
+	path_size = narrow_string_length(
+	             filename );
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( libsigscan_scan_state_get_result(
+		     scan_state,
+		     result_index,
+		     &scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan result: %d.",
+			 function,
+			 result_index + 1 );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_result_get_offset(
+		     scan_result,
+		     &offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan result: %d offset.",
+			 function,
+			 result_index + 1 );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_result_get_identifier_size(
+		     scan_result,
+		     &identifier_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan result: %d identifier size.",
+			 function,
+			 result_index + 1 );
+
+			goto on_error;
+		}
+		/* The identifier buffer is reused for the scan results
+		 * and only grown when an identifier does not fit
+		 */
+		if( identifier_size > maximum_identifier_size )
+		{
+			reallocation = memory_reallocate(
+			                identifier,
+			                sizeof( uint8_t ) * identifier_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize identifier.",
+				 function );
+
+				goto on_error;
+			}
+			identifier              = (uint8_t *) reallocation;
+			maximum_identifier_size = identifier_size;
+		}
+		if( identifier_size > 0 )
+		{
+			if( libsigscan_scan_result_get_identifier(
+			     scan_result,
+			     (char *) identifier,
+			     identifier_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve scan result: %d identifier.",
+				 function,
+				 result_index + 1 );
+
+				goto on_error;
+			}
+			/* The identifier size includes the end-of-string character
+			 */
+			identifier_size -= 1;
+		}
+		if( scan_handle_write_record(
+		     scan_handle,
+		     path,
+		     path_size,
+		     offset,
+		     identifier,
+		     identifier_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write scan result: %d record.",
+			 function,
+			 result_index + 1 );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_result_free(
+		     &scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan result.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Write errors of the buffered output stream are only detected afterwards
+	 */
+	if( ferror(
+	     scan_handle->notify_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write records.",
+		 function );
+
+		goto on_error;
+	}
+	if( identifier != NULL )
+	{
+		memory_free(
+		 identifier );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	memory_free(
+	 path );
+#endif
+	return( 1 );
+
+on_error:
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( identifier != NULL )
+	{
+		memory_free(
+		 identifier );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+#endif
+	return( -1 );
+}
+
+/* Prints the scan tree statistics
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_tree_statistics_fprint(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_statistics_t *scan_tree_statistics = NULL;
+	const char *scan_tree_names[ 3 ]                        = { "Header", "Footer", "Unbound" };
+	static char *function                                   = "scan_handle_scan_tree_statistics_fprint";
+	size64_t memory_usage                                   = 0;
+	size64_t saved_memory_usage                             = 0;
+	size_t largest_pattern_size                             = 0;
+	size_t smallest_pattern_size                            = 0;
+	double average_fan_out                                  = 0.0;
+	double average_skip_value                               = 0.0;
+	int scan_tree_types[ 3 ]                                = { LIBSIGSCAN_SCAN_TREE_TYPE_HEADER, LIBSIGSCAN_SCAN_TREE_TYPE_FOOTER, LIBSIGSCAN_SCAN_TREE_TYPE_UNBOUND };
+	int depth                                               = 0;
+	int maximum_depth                                       = 0;
+	int maximum_fan_out                                     = 0;
+	int number_of_merged_scan_tree_nodes                    = 0;
+	int number_of_scan_tree_nodes                           = 0;
+	int result                                              = 0;
+	int scan_tree_index                                     = 0;
+	int skip_value_result                                   = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( scan_tree_index = 0;
+	     scan_tree_index < 3;
+	     scan_tree_index++ )
+	{
+		result = libsigscan_scanner_get_statistics(
+		          scan_handle->scanner,
+		          scan_tree_types[ scan_tree_index ],
+		          &scan_tree_statistics,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve %s scan tree statistics.",
+			 function,
+			 scan_tree_names[ scan_tree_index ] );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libsigscan_scan_tree_statistics_get_number_of_scan_tree_nodes(
+		     scan_tree_statistics,
+		     &number_of_scan_tree_nodes,
+		     &number_of_merged_scan_tree_nodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of scan tree nodes.",
+			 function );
+
+			goto on_error;
+		}
+		/* The unbound scan tree is empty if none of the signatures is unbound
+		 */
+		if( ( scan_tree_types[ scan_tree_index ] == LIBSIGSCAN_SCAN_TREE_TYPE_UNBOUND )
+		 && ( number_of_scan_tree_nodes == 0 ) )
+		{
+			if( libsigscan_scan_tree_statistics_free(
+			     &scan_tree_statistics,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan tree statistics.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( libsigscan_scan_tree_statistics_get_maximum_depth(
+		     scan_tree_statistics,
+		     &maximum_depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum depth.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_tree_statistics_get_fan_out(
+		     scan_tree_statistics,
+		     &maximum_fan_out,
+		     &average_fan_out,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve fan-out.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_tree_statistics_get_memory_usage(
+		     scan_tree_statistics,
+		     &memory_usage,
+		     &saved_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_scan_tree_statistics_get_pattern_sizes(
+		     scan_tree_statistics,
+		     &smallest_pattern_size,
+		     &largest_pattern_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve pattern sizes.",
+			 function );
+
+			goto on_error;
+		}
+		skip_value_result = libsigscan_scan_tree_statistics_get_average_skip_value(
+		                     scan_tree_statistics,
+		                     &average_skip_value,
+		                     error );
+
+		if( skip_value_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve average skip value.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 scan_handle->notify_stream,
+		 "%s scan tree statistics:\n",
+		 scan_tree_names[ scan_tree_index ] );
+
+		fprintf(
+		 scan_handle->notify_stream,
+		 "\tNumber of nodes\t\t: %d (%d merged)\n",
+		 number_of_scan_tree_nodes,
+		 number_of_merged_scan_tree_nodes );
+
+		fprintf(
+		 scan_handle->notify_stream,
+		 "\tMaximum depth\t\t: %d\n",
+		 maximum_depth );
+
+		for( depth = 0;
+		     depth <= maximum_depth;
+		     depth++ )
+		{
+			if( libsigscan_scan_tree_statistics_get_number_of_scan_tree_nodes_at_depth(
+			     scan_tree_statistics,
+			     depth,
+			     &number_of_scan_tree_nodes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of scan tree nodes at depth: %d.",
+				 function,
+				 depth );
+
+				goto on_error;
+			}
+			fprintf(
+			 scan_handle->notify_stream,
+			 "\tNodes at depth: %d\t: %d\n",
+			 depth,
+			 number_of_scan_tree_nodes );
+		}
+		fprintf(
+		 scan_handle->notify_stream,
+		 "\tMaximum fan-out\t\t: %d\n",
+		 maximum_fan_out );
+
+		fprintf(
+		 scan_handle->notify_stream,
+		 "\tAverage fan-out\t\t: %.2f\n",
+		 average_fan_out );
+
+		fprintf(
+		 scan_handle->notify_stream,
+		 "\tMemory usage\t\t: %" PRIu64 " bytes (%" PRIu64 " bytes saved)\n",
+		 memory_usage,
+		 saved_memory_usage );
+
+		fprintf(
+		 scan_handle->notify_stream,
+		 "\tSmallest pattern size\t: %" PRIzd "\n",
+		 smallest_pattern_size );
+
+		fprintf(
+		 scan_handle->notify_stream,
+		 "\tLargest pattern size\t: %" PRIzd "\n",
+		 largest_pattern_size );
+
+		if( skip_value_result != 0 )
+		{
+			fprintf(
+			 scan_handle->notify_stream,
+			 "\tAverage skip value\t: %.2f\n",
+			 average_skip_value );
+		}
+
+		fprintf(
+		 scan_handle->notify_stream,
+		 "\n" );
+
+		if( libsigscan_scan_tree_statistics_free(
+		     &scan_tree_statistics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan tree statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( scan_tree_statistics != NULL )
+	{
+		libsigscan_scan_tree_statistics_free(
+		 &scan_tree_statistics,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the signatures compiled into C source code to a file
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_write_compiled_source(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     const char *prefix,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *file = NULL;
+	char *source          = NULL;
+	static char *function = "scan_handle_write_compiled_source";
+	size_t prefix_length  = 0;
+	size_t source_size    = 0;
+	ssize_t write_count   = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefix.",
+		 function );
+
+		return( -1 );
+	}
+	prefix_length = narrow_string_length(
+	                 prefix );
+
+	if( libsigscan_scanner_get_compiled_source_size(
+	     scan_handle->scanner,
+	     prefix,
+	     prefix_length,
+	     &source_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compiled source size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( source_size == 0 )
+	 || ( source_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compiled source size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	source = narrow_string_allocate(
+	          source_size );
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_get_compiled_source(
+	     scan_handle->scanner,
+	     prefix,
+	     prefix_length,
+	     source,
+	     source_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compiled source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The end-of-string character is not written
+	 */
+	write_count = libcfile_file_write_buffer(
+	               file,
+	               (uint8_t *) source,
+	               source_size - 1,
+	               error );
+
+	if( write_count != (ssize_t) ( source_size - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write compiled source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 source );
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	if( source != NULL )
+	{
+		memory_free(
+		 source );
+	}
+	return( -1 );
+}
+
@@ -33,6 +33,14 @@
 extern "C" {
 #endif
 
+enum SCAN_HANDLE_OUTPUT_FORMATS
+{
+	SCAN_HANDLE_OUTPUT_FORMAT_TEXT		= 0,
+	SCAN_HANDLE_OUTPUT_FORMAT_BINARY	= 1,
+	SCAN_HANDLE_OUTPUT_FORMAT_JSONL		= 2,
+	SCAN_HANDLE_OUTPUT_FORMAT_TSV		= 3
+};
+
 typedef struct scan_handle scan_handle_t;
 
 struct scan_handle
@@ -45,6 +53,10 @@ struct scan_handle
 	 */
 	FILE *notify_stream;
 
+	/* The output format
+	 */
+	int output_format;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -62,6 +74,16 @@ int scan_handle_signal_abort(
      scan_handle_t *scan_handle,
      libcerror_error_t **error );
 
+int scan_handle_set_direct_io(
+     scan_handle_t *scan_handle,
+     int direct_io,
+     libcerror_error_t **error );
+
+int scan_handle_set_output_format(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int scan_handle_copy_string_to_offset(
      const uint8_t *string,
      size_t string_size,
@@ -91,6 +113,44 @@ int scan_handle_scan_results_fprint(
      libsigscan_scan_state_t *scan_state,
      libcerror_error_t **error );
 
+int scan_handle_get_utf8_character_size(
+     const uint8_t *string,
+     size_t string_size,
+     size_t string_index,
+     size_t *utf8_character_size,
+     libcerror_error_t **error );
+
+int scan_handle_write_escaped_string(
+     scan_handle_t *scan_handle,
+     const uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int scan_handle_write_record(
+     scan_handle_t *scan_handle,
+     const uint8_t *path,
+     size_t path_size,
+     off64_t offset,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     libcerror_error_t **error );
+
+int scan_handle_scan_results_write_records(
+     scan_handle_t *scan_handle,
+     libsigscan_scan_state_t *scan_state,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_handle_scan_tree_statistics_fprint(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_write_compiled_source(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     const char *prefix,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
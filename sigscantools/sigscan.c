@@ -43,6 +43,10 @@
 #include "sigscantools_signal.h"
 #include "sigscantools_unused.h"
 
+/* The size of the buffer of stdout for the record output formats
+ */
+#define SIGSCAN_OUTPUT_BUFFER_SIZE	65536
+
 scan_handle_t *sigscan_scan_handle = NULL;
 int sigscan_abort                  = 0;
 
@@ -57,13 +61,21 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use sigscan to scan a file for binary signatures.\n\n" );
 
-	fprintf( stream, "Usage: sigscan [ -c configuration_file ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: sigscan [ -c configuration_file ] [ -o output_format ] [ -dhtvV ]\n"
+	                 "              source [ source ... ]\n\n" );
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\tsource: the source file, multiple source files are scanned\n"
+	                 "\t        one after the other\n\n" );
 
 	fprintf( stream, "\t-c:     specify the configuration file, defaults\n"
 	                 "\t        to: sigscan.conf\n" );
+	fprintf( stream, "\t-d:     read the source using direct IO, bypassing the page cache,\n"
+	                 "\t        intended for large files and raw devices\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-o:     specify the output format, options: bin, jsonl, text (default),\n"
+	                 "\t        tsv. The bin, jsonl and tsv formats write one record per\n"
+	                 "\t        scan result, with the path, offset and identifier\n" );
+	fprintf( stream, "\t-t:     print the scan tree statistics\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -122,10 +134,16 @@ int main( int argc, char * const argv[] )
 {
 	libcerror_error_t *error                      = NULL;
 	system_character_t *option_configuration_file = _SYSTEM_STRING( "sigscan.conf" );
+	system_character_t *option_output_format      = NULL;
 	system_character_t *source                    = NULL;
 	libsigscan_scan_state_t *scan_state           = NULL;
 	char *program                                 = "sigscan";
 	system_integer_t option                       = 0;
+	int number_of_failed_sources                  = 0;
+	int print_scan_tree_statistics                = 0;
+	int result                                    = 0;
+	int source_index                              = 0;
+	int use_direct_io                             = 0;
 	int verbose                                   = 0;
 
 	libcnotify_stream_set(
@@ -154,19 +172,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	sigscanoutput_version_fprint(
-	 stdout,
-	 program );
-
 	while( ( option = sigscantools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:hvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "c:dho:tvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
 			case (system_integer_t) '?':
 			default:
+				sigscanoutput_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -182,18 +200,41 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'd':
+				use_direct_io = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
+				sigscanoutput_version_fprint(
+				 stdout,
+				 program );
+
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				print_scan_tree_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
 				break;
 
 			case (system_integer_t) 'V':
+				sigscanoutput_version_fprint(
+				 stdout,
+				 program );
+
 				sigscanoutput_copyright_fprint(
 				 stdout );
 
@@ -202,6 +243,10 @@ int main( int argc, char * const argv[] )
 	}
 	if( optind == argc )
 	{
+		sigscanoutput_version_fprint(
+		 stdout,
+		 program );
+
 		fprintf(
 		 stderr,
 		 "Missing source file.\n" );
@@ -211,8 +256,6 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
-
 	libcnotify_verbose_set(
 	 verbose );
 	libsigscan_notify_set_stream(
@@ -233,16 +276,74 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libsigscan_scan_state_initialize(
-	     &scan_state,
-	     &error ) != 1 )
+	if( option_output_format != NULL )
+	{
+		result = scan_handle_set_output_format(
+		          sigscan_scan_handle,
+		          option_output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format: %" PRIs_SYSTEM ".\n",
+			 option_output_format );
+
+			usage_fprint(
+			 stdout );
+
+			goto on_error;
+		}
+	}
+	/* The version is not printed for the record output formats
+	 * so that the output only contains records
+	 */
+	if( sigscan_scan_handle->output_format == SCAN_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		sigscanoutput_version_fprint(
+		 stdout,
+		 program );
+	}
+#if !defined( __BORLANDC__ )
+	/* The records are written to a fully buffered stdout, stderr remains unbuffered
+	 */
+	else if( setvbuf(
+	          stdout,
+	          NULL,
+	          _IOFBF,
+	          SIGSCAN_OUTPUT_BUFFER_SIZE ) != 0 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create scan state.\n" );
+		 "Unable to set IO mode of stdout.\n" );
 
 		goto on_error;
 	}
+#endif /* !defined( __BORLANDC__ ) */
+
+	if( use_direct_io != 0 )
+	{
+		if( scan_handle_set_direct_io(
+		     sigscan_scan_handle,
+		     use_direct_io,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set direct IO.\n" );
+
+			goto on_error;
+		}
+	}
 	if( scan_handle_read_signature_definitions(
 	     sigscan_scan_handle,
 	     option_configuration_file,
@@ -255,28 +356,73 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( scan_handle_scan_input(
-	     sigscan_scan_handle,
-	     scan_state,
-	     source,
-	     &error ) != 1 )
+	/* The scan results of a source are written when the source was scanned,
+	 * a source that cannot be scanned does not prevent scanning the other sources
+	 */
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to scan: %" PRIs_SYSTEM ".\n",
-		 source );
+		if( sigscan_abort != 0 )
+		{
+			break;
+		}
+		source = argv[ source_index ];
 
-		goto on_error;
+		if( libsigscan_scan_state_initialize(
+		     &scan_state,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create scan state.\n" );
+
+			goto on_error;
+		}
+		if( scan_handle_scan_input(
+		     sigscan_scan_handle,
+		     scan_state,
+		     source,
+		     &error ) != 1 )
+		{
+			fflush(
+			 stdout );
+
+			fprintf(
+			 stderr,
+			 "Unable to scan: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			number_of_failed_sources++;
+		}
+		if( libsigscan_scan_state_free(
+		     &scan_state,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free scan state.\n" );
+
+			goto on_error;
+		}
 	}
-	if( libsigscan_scan_state_free(
-	     &scan_state,
-	     &error ) != 1 )
+	if( print_scan_tree_statistics != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to free scan state.\n" );
+		if( scan_handle_scan_tree_statistics_fprint(
+		     sigscan_scan_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print scan tree statistics.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	if( scan_handle_free(
 	     &sigscan_scan_handle,
@@ -288,6 +434,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( fflush(
+	     stdout ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write output.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( number_of_failed_sources > 0 )
+	{
+		return( EXIT_FAILURE );
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,281 @@
+/*
+ * Compiles binary signatures into C source code
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scan_handle.h"
+#include "sigscantools_getopt.h"
+#include "sigscantools_libcerror.h"
+#include "sigscantools_libclocale.h"
+#include "sigscantools_libcnotify.h"
+#include "sigscantools_libsigscan.h"
+#include "sigscantools_output.h"
+#include "sigscantools_unused.h"
+
+/* The maximum size of the prefix including the end-of-string character
+ */
+#define SIGSCANCOMPILE_MAXIMUM_PREFIX_SIZE	129
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use sigscancompile to compile binary signatures into C source code.\n\n" );
+
+	fprintf( stream, "Usage: sigscancompile [ -c configuration_file ] [ -p prefix ]\n"
+	                 "                      [ -hvV ] target\n\n" );
+
+	fprintf( stream, "\ttarget: the C source file to write\n\n" );
+
+	fprintf( stream, "\t-c:     specify the configuration file, defaults\n"
+	                 "\t        to: sigscan.conf\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-p:     specify the prefix of the scan function names,\n"
+	                 "\t        defaults to: sigscan\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	char prefix[ SIGSCANCOMPILE_MAXIMUM_PREFIX_SIZE ];
+
+	libcerror_error_t *error                      = NULL;
+	scan_handle_t *sigscancompile_scan_handle     = NULL;
+	system_character_t *option_configuration_file = _SYSTEM_STRING( "sigscan.conf" );
+	system_character_t *option_prefix             = _SYSTEM_STRING( "sigscan" );
+	system_character_t *target                    = NULL;
+	char *program                                 = "sigscancompile";
+	size_t prefix_index                           = 0;
+	system_integer_t option                       = 0;
+	int verbose                                   = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sigscantools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sigscantools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	sigscanoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = sigscantools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:hp:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_configuration_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'p':
+				option_prefix = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sigscanoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	target = argv[ optind ];
+
+	/* The prefix is used in C function names hence only ASCII characters are supported
+	 */
+	for( prefix_index = 0;
+	     prefix_index < ( SIGSCANCOMPILE_MAXIMUM_PREFIX_SIZE - 1 );
+	     prefix_index++ )
+	{
+		if( ( option_prefix[ prefix_index ] == 0 )
+		 || ( (uint32_t) option_prefix[ prefix_index ] > 0x7f ) )
+		{
+			break;
+		}
+		prefix[ prefix_index ] = (char) option_prefix[ prefix_index ];
+	}
+	if( option_prefix[ prefix_index ] != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported prefix.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	prefix[ prefix_index ] = 0;
+
+	libcnotify_verbose_set(
+	 verbose );
+	libsigscan_notify_set_stream(
+	 stderr,
+	 NULL );
+	libsigscan_notify_set_verbose(
+	 verbose );
+
+	if( scan_handle_initialize(
+	     &sigscancompile_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create scan handle.\n" );
+
+		goto on_error;
+	}
+	if( scan_handle_read_signature_definitions(
+	     sigscancompile_scan_handle,
+	     option_configuration_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read signatures from: %" PRIs_SYSTEM ".\n",
+		 option_configuration_file );
+
+		goto on_error;
+	}
+	if( scan_handle_write_compiled_source(
+	     sigscancompile_scan_handle,
+	     target,
+	     prefix,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write compiled source to: %" PRIs_SYSTEM ".\n",
+		 target );
+
+		goto on_error;
+	}
+	if( scan_handle_free(
+	     &sigscancompile_scan_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free scan handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( sigscancompile_scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &sigscancompile_scan_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -19,7 +19,11 @@
 # You should have received a copy of the GNU Lesser General Public License
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+import io
+import os
+import shutil
 import sys
+import tempfile
 
 import pysigscan
 
@@ -45,13 +49,21 @@ def pysigscan_test_scan_buffer(scanner, buffer, expected_scan_results):
   scanner.scan_stop(scan_state)
 
   scan_results = []
+  scan_result_offsets = []
   for scan_result in scan_state.scan_results:
     scan_results.append(scan_result.identifier)
+    scan_result_offsets.append(scan_result.offset)
 
-  if sorted(scan_results) == sorted(expected_scan_results):
-    result = True
-  else:
+  offsets, identifiers = scan_state.get_scan_results_array()
+
+  if sorted(scan_results) != sorted(expected_scan_results):
     result = False
+  elif identifiers != scan_results:
+    result = False
+  elif offsets.typecode != "q" or list(offsets) != scan_result_offsets:
+    result = False
+  else:
+    result = True
 
   print("Testing scan\t"),
   if not result:
@@ -62,6 +74,157 @@ def pysigscan_test_scan_buffer(scanner, buffer, expected_scan_results):
   return True
 
 
+def pysigscan_test_scan_file_object(scanner, buffer, expected_scan_results):
+  temporary_directory = tempfile.mkdtemp()
+
+  try:
+    path = os.path.join(temporary_directory, "file")
+    with open(path, "wb") as file_object:
+      file_object.write(buffer)
+
+    result = True
+
+    # A regular file is read using its file descriptor, other file objects
+    # using readinto.
+    with open(path, "rb") as file_object:
+      for scanned_file_object in (file_object, io.BytesIO(buffer)):
+        scan_state = pysigscan.scan_state()
+
+        scanner.scan_file_object(scan_state, scanned_file_object)
+
+        scan_results = [
+            scan_result.identifier for scan_result in scan_state.scan_results]
+
+        if sorted(scan_results) != sorted(expected_scan_results):
+          result = False
+
+    # A writable buffered file object is read using readinto, since its
+    # file descriptor does not provide the data that was not yet flushed.
+    with open(path, "w+b") as file_object:
+      file_object.write(buffer)
+
+      scan_state = pysigscan.scan_state()
+
+      scanner.scan_file_object(scan_state, file_object)
+
+      scan_results = [
+          scan_result.identifier for scan_result in scan_state.scan_results]
+
+      if sorted(scan_results) != sorted(expected_scan_results):
+        result = False
+
+  finally:
+    shutil.rmtree(temporary_directory, True)
+
+  print("Testing scan file object\t"),
+  if not result:
+    print("(FAIL)")
+    return False
+  print("(PASS)")
+
+  return True
+
+
+def pysigscan_test_scan_files(scanner, buffers, expected_scan_results):
+  temporary_directory = tempfile.mkdtemp()
+
+  try:
+    paths = []
+    for index, buffer in enumerate(buffers):
+      path = os.path.join(temporary_directory, "file{0:d}".format(index))
+      with open(path, "wb") as file_object:
+        file_object.write(buffer)
+      paths.append(path)
+
+    # A file that does not exist results in None instead of scan results.
+    paths.append(os.path.join(temporary_directory, "bogus"))
+
+    scan_results = {}
+    for path, path_scan_results in scanner.scan_files(paths, threads=4):
+      if path_scan_results is not None:
+        path_scan_results = [
+            identifier for _, identifier in path_scan_results]
+      scan_results[path] = path_scan_results
+
+    expected_scan_results = dict(zip(paths, expected_scan_results + [None]))
+
+  finally:
+    shutil.rmtree(temporary_directory, True)
+
+  result = bool(scan_results == expected_scan_results)
+
+  print("Testing scan files\t"),
+  if not result:
+    print("(FAIL)")
+    return False
+  print("(PASS)")
+
+  return True
+
+
+def pysigscan_test_scan_async(scanner, buffer, expected_scan_results):
+  # The asyncio support is not available for Python 2.
+  if not hasattr(scanner, "scan_file_async"):
+    return True
+
+  import asyncio
+
+  event_loop = asyncio.new_event_loop()
+  asyncio.set_event_loop(event_loop)
+
+  temporary_directory = tempfile.mkdtemp()
+
+  try:
+    path = os.path.join(temporary_directory, "file")
+    with open(path, "wb") as file_object:
+      file_object.write(buffer)
+
+    scan_state = pysigscan.scan_state()
+    event_loop.run_until_complete(scanner.scan_file_async(scan_state, path))
+
+    file_scan_results = [
+        scan_result.identifier for scan_result in scan_state.scan_results]
+
+    # The remainder of the data is fed to the stream while it is being
+    # scanned to test that the scan waits for the data to be read.
+    stream_reader = asyncio.StreamReader()
+    stream_reader.feed_data(buffer[:4])
+
+    def feed_remainder():
+      stream_reader.feed_data(buffer[4:])
+      stream_reader.feed_eof()
+
+    event_loop.call_soon(feed_remainder)
+
+    scan_stream = scanner.scan_stream(
+        pysigscan.scan_state(), stream_reader, read_size=4)
+
+    stream_scan_results = []
+    while True:
+      try:
+        scan_result = event_loop.run_until_complete(scan_stream.__anext__())
+      except StopAsyncIteration:
+        break
+      stream_scan_results.append(scan_result.identifier)
+
+  finally:
+    asyncio.set_event_loop(None)
+    event_loop.close()
+    shutil.rmtree(temporary_directory, True)
+
+  result = bool(
+      file_scan_results == expected_scan_results and
+      stream_scan_results == expected_scan_results)
+
+  print("Testing scan async\t"),
+  if not result:
+    print("(FAIL)")
+    return False
+  print("(PASS)")
+
+  return True
+
+
 def main():
   RELATIVE_FROM_START = pysigscan.signature_flags.RELATIVE_FROM_START
   RELATIVE_FROM_END = pysigscan.signature_flags.RELATIVE_FROM_END
@@ -130,6 +293,33 @@ def main():
       scanner, random_data, expected_scan_results):
     return False
 
+  expected_scan_results = ["regf"]
+  if not pysigscan_test_scan_buffer(
+      scanner, bytearray(regf_pattern), expected_scan_results):
+    return False
+
+  expected_scan_results = ["lnk"]
+  if not pysigscan_test_scan_buffer(
+      scanner, memoryview(random_data + lnk_pattern)[16:],
+      expected_scan_results):
+    return False
+
+  expected_scan_results = ["regf"]
+  if not pysigscan_test_scan_file_object(
+      scanner, regf_pattern, expected_scan_results):
+    return False
+
+  expected_scan_results = [["lnk"], ["regf"], []]
+  if not pysigscan_test_scan_files(
+      scanner, [lnk_pattern, regf_pattern, random_data],
+      expected_scan_results):
+    return False
+
+  expected_scan_results = ["regf"]
+  if not pysigscan_test_scan_async(
+      scanner, regf_pattern + random_data, expected_scan_results):
+    return False
+
   return True
 
 
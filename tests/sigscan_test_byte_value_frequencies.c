@@ -0,0 +1,715 @@
+/*
+ * Library byte_value_frequencies type test program
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_byte_value_frequencies.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+/* Tests the libsigscan_byte_value_frequencies_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_byte_value_frequencies_initialize(
+     void )
+{
+	libcerror_error_t *error                                    = NULL;
+	libsigscan_byte_value_frequencies_t *byte_value_frequencies = NULL;
+	int result                                                  = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests                             = 1;
+	int number_of_memset_fail_tests                             = 1;
+	int test_number                                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_byte_value_frequencies_initialize(
+	          &byte_value_frequencies,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_value_frequencies",
+	 byte_value_frequencies );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_byte_value_frequencies_free(
+	          &byte_value_frequencies,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "byte_value_frequencies",
+	 byte_value_frequencies );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_byte_value_frequencies_initialize(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	byte_value_frequencies = (libsigscan_byte_value_frequencies_t *) 0x12345678UL;
+
+	result = libsigscan_byte_value_frequencies_initialize(
+	          &byte_value_frequencies,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	byte_value_frequencies = NULL;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_byte_value_frequencies_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_byte_value_frequencies_initialize(
+		          &byte_value_frequencies,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( byte_value_frequencies != NULL )
+			{
+				libsigscan_byte_value_frequencies_free(
+				 &byte_value_frequencies,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "byte_value_frequencies",
+			 byte_value_frequencies );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_byte_value_frequencies_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_byte_value_frequencies_initialize(
+		          &byte_value_frequencies,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( byte_value_frequencies != NULL )
+			{
+				libsigscan_byte_value_frequencies_free(
+				 &byte_value_frequencies,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "byte_value_frequencies",
+			 byte_value_frequencies );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( byte_value_frequencies != NULL )
+	{
+		libsigscan_byte_value_frequencies_free(
+		 &byte_value_frequencies,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_byte_value_frequencies_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_byte_value_frequencies_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_byte_value_frequencies_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_byte_value_frequencies_update function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_byte_value_frequencies_update(
+     void )
+{
+	uint8_t buffer[ 8 ]                                         = { 'r', 'e', 'g', 'f', 0, 0, 0, 0 };
+	libcerror_error_t *error                                    = NULL;
+	libsigscan_byte_value_frequencies_t *byte_value_frequencies = NULL;
+	uint64_t frequency                                          = 0;
+	int result                                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_byte_value_frequencies_initialize(
+	          &byte_value_frequencies,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_value_frequencies",
+	 byte_value_frequencies );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_byte_value_frequencies_update(
+	          byte_value_frequencies,
+	          buffer,
+	          8,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_byte_value_frequencies_get_frequency(
+	          byte_value_frequencies,
+	          0,
+	          &frequency,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "frequency",
+	 frequency,
+	 (uint64_t) 4 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "byte_value_frequencies->total_frequency",
+	 byte_value_frequencies->total_frequency,
+	 (uint64_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_byte_value_frequencies_update(
+	          NULL,
+	          buffer,
+	          8,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_byte_value_frequencies_update(
+	          byte_value_frequencies,
+	          NULL,
+	          8,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_byte_value_frequencies_update(
+	          byte_value_frequencies,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_byte_value_frequencies_get_frequency(
+	          NULL,
+	          0,
+	          &frequency,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_byte_value_frequencies_get_frequency(
+	          byte_value_frequencies,
+	          0,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_byte_value_frequencies_free(
+	          &byte_value_frequencies,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "byte_value_frequencies",
+	 byte_value_frequencies );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( byte_value_frequencies != NULL )
+	{
+		libsigscan_byte_value_frequencies_free(
+		 &byte_value_frequencies,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_byte_value_frequencies_get_weight function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_byte_value_frequencies_get_weight(
+     void )
+{
+	uint8_t buffer[ 8 ]                                         = { 'r', 'e', 'g', 'f', 0, 0, 0, 0 };
+	libcerror_error_t *error                                    = NULL;
+	libsigscan_byte_value_frequencies_t *byte_value_frequencies = NULL;
+	int result                                                  = 0;
+	int weight                                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_byte_value_frequencies_initialize(
+	          &byte_value_frequencies,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_value_frequencies",
+	 byte_value_frequencies );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test without frequencies
+	 */
+	result = libsigscan_byte_value_frequencies_get_weight(
+	          byte_value_frequencies,
+	          0,
+	          &weight,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_byte_value_frequencies_update(
+	          byte_value_frequencies,
+	          buffer,
+	          8,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_byte_value_frequencies_get_weight(
+	          byte_value_frequencies,
+	          0,
+	          &weight,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "weight",
+	 weight,
+	 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_byte_value_frequencies_get_weight(
+	          byte_value_frequencies,
+	          'r',
+	          &weight,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "weight",
+	 weight,
+	 4 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_byte_value_frequencies_get_weight(
+	          byte_value_frequencies,
+	          0xff,
+	          &weight,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "weight",
+	 weight,
+	 65 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_byte_value_frequencies_get_weight(
+	          NULL,
+	          0,
+	          &weight,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_byte_value_frequencies_get_weight(
+	          byte_value_frequencies,
+	          0,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_byte_value_frequencies_free(
+	          &byte_value_frequencies,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "byte_value_frequencies",
+	 byte_value_frequencies );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( byte_value_frequencies != NULL )
+	{
+		libsigscan_byte_value_frequencies_free(
+		 &byte_value_frequencies,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_byte_value_frequencies_initialize",
+	 sigscan_test_byte_value_frequencies_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_byte_value_frequencies_free",
+	 sigscan_test_byte_value_frequencies_free );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_byte_value_frequencies_update",
+	 sigscan_test_byte_value_frequencies_update );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_byte_value_frequencies_get_weight",
+	 sigscan_test_byte_value_frequencies_get_weight );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,745 @@
+/*
+ * Library direct_file_io_handle type test program
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_direct_file_io_handle.h"
+#include "../libsigscan/libsigscan_libbfio.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE )
+
+/* The size of the test file, which is not a multiple of the block size
+ */
+#define SIGSCAN_TEST_DIRECT_FILE_SIZE	( ( 512 * 1024 ) + 4321 )
+
+const char *sigscan_test_direct_file_name = "sigscan_test_direct_file_io_handle.raw";
+
+/* Retrieves the byte value at a specific offset of the test file
+ */
+#define sigscan_test_direct_file_byte_value( offset ) \
+	(uint8_t) ( ( ( offset ) * 7 ) + ( ( offset ) >> 12 ) )
+
+/* Writes the test file
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_direct_file_write(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	FILE *file_stream   = NULL;
+	size_t buffer_index = 0;
+	size_t file_offset  = 0;
+	size_t write_size   = 0;
+
+	file_stream = file_stream_open(
+	               sigscan_test_direct_file_name,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	while( file_offset < SIGSCAN_TEST_DIRECT_FILE_SIZE )
+	{
+		write_size = SIGSCAN_TEST_DIRECT_FILE_SIZE - file_offset;
+
+		if( write_size > 4096 )
+		{
+			write_size = 4096;
+		}
+		for( buffer_index = 0;
+		     buffer_index < write_size;
+		     buffer_index++ )
+		{
+			buffer[ buffer_index ] = sigscan_test_direct_file_byte_value( file_offset + buffer_index );
+		}
+		if( file_stream_write(
+		     file_stream,
+		     buffer,
+		     write_size ) != write_size )
+		{
+			file_stream_close(
+			 file_stream );
+
+			return( -1 );
+		}
+		file_offset += write_size;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libsigscan_direct_file_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_direct_file_io_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libsigscan_direct_file_io_handle_t *direct_file_io_handle = NULL;
+	int result                                                = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests                           = 2;
+	int number_of_memset_fail_tests                           = 1;
+	int test_number                                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          "test",
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "direct_file_io_handle->name_size",
+	 direct_file_io_handle->name_size,
+	 (size_t) 5 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "direct_file_io_handle->file_descriptor",
+	 direct_file_io_handle->file_descriptor,
+	 -1 );
+
+	result = libsigscan_direct_file_io_handle_free(
+	          &direct_file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_direct_file_io_handle_initialize(
+	          NULL,
+	          "test",
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	direct_file_io_handle = (libsigscan_direct_file_io_handle_t *) 0x12345678UL;
+
+	result = libsigscan_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          "test",
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	direct_file_io_handle = NULL;
+
+	result = libsigscan_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          NULL,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          "test",
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_direct_file_io_handle_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_direct_file_io_handle_initialize(
+		          &direct_file_io_handle,
+		          "test",
+		          4,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( direct_file_io_handle != NULL )
+			{
+				libsigscan_direct_file_io_handle_free(
+				 &direct_file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "direct_file_io_handle",
+			 direct_file_io_handle );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_direct_file_io_handle_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_direct_file_io_handle_initialize(
+		          &direct_file_io_handle,
+		          "test",
+		          4,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( direct_file_io_handle != NULL )
+			{
+				libsigscan_direct_file_io_handle_free(
+				 &direct_file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "direct_file_io_handle",
+			 direct_file_io_handle );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file_io_handle != NULL )
+	{
+		libsigscan_direct_file_io_handle_free(
+		 &direct_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_direct_file_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_direct_file_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_direct_file_io_handle_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_direct_file_io_handle_read function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_direct_file_io_handle_read(
+     void )
+{
+	/* Reads that are aligned, unaligned, cross the block buffer and the end of the file
+	 */
+	off64_t test_offsets[ 8 ] = {
+		0, 0, 1, 4095, 4096, 8192, 512 * 1024, SIGSCAN_TEST_DIRECT_FILE_SIZE - 1 };
+	size_t test_sizes[ 8 ] = {
+		4096, 300 * 1024, 10000, 2, 65536, 512 * 1024, 8192, 100 };
+
+	libcerror_error_t *error                                  = NULL;
+	libsigscan_direct_file_io_handle_t *direct_file_io_handle = NULL;
+	uint8_t *buffer                                           = NULL;
+	uint8_t *buffer_allocation                                = NULL;
+	size64_t size                                             = 0;
+	size_t buffer_index                                       = 0;
+	size_t expected_read_size                                 = 0;
+	ssize_t read_count                                        = 0;
+	off64_t offset                                            = 0;
+	int buffer_alignment                                      = 0;
+	int result                                                = 0;
+	int test_index                                            = 0;
+
+	result = sigscan_test_direct_file_write();
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	buffer_allocation = (uint8_t *) memory_allocate(
+	                                 ( 512 * 1024 ) + 8192 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer_allocation",
+	 buffer_allocation );
+
+	result = libsigscan_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          sigscan_test_direct_file_name,
+	          narrow_string_length(
+	           sigscan_test_direct_file_name ),
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_direct_file_io_handle_open(
+	          direct_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_direct_file_io_handle_get_size(
+	          direct_file_io_handle,
+	          &size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) SIGSCAN_TEST_DIRECT_FILE_SIZE );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Every read is tested with a block aligned and an unaligned buffer
+	 */
+	for( buffer_alignment = 0;
+	     buffer_alignment < 2;
+	     buffer_alignment++ )
+	{
+		buffer = buffer_allocation;
+
+		if( ( (intptr_t) buffer % 4096 ) != 0 )
+		{
+			buffer += 4096 - ( (intptr_t) buffer % 4096 );
+		}
+		buffer += buffer_alignment * 3;
+
+		for( test_index = 0;
+		     test_index < 8;
+		     test_index++ )
+		{
+			offset = libsigscan_direct_file_io_handle_seek_offset(
+			          direct_file_io_handle,
+			          test_offsets[ test_index ],
+			          SEEK_SET,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 (int64_t) offset,
+			 (int64_t) test_offsets[ test_index ] );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			expected_read_size = test_sizes[ test_index ];
+
+			if( expected_read_size > ( SIGSCAN_TEST_DIRECT_FILE_SIZE - (size_t) test_offsets[ test_index ] ) )
+			{
+				expected_read_size = SIGSCAN_TEST_DIRECT_FILE_SIZE - (size_t) test_offsets[ test_index ];
+			}
+			read_count = libsigscan_direct_file_io_handle_read(
+			              direct_file_io_handle,
+			              buffer,
+			              test_sizes[ test_index ],
+			              &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) expected_read_size );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( buffer_index = 0;
+			     buffer_index < expected_read_size;
+			     buffer_index++ )
+			{
+				if( buffer[ buffer_index ] != sigscan_test_direct_file_byte_value( (size_t) test_offsets[ test_index ] + buffer_index ) )
+				{
+					break;
+				}
+			}
+			SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+			 "buffer_index",
+			 buffer_index,
+			 expected_read_size );
+		}
+	}
+	/* Test reading at the end of the file
+	 */
+	read_count = libsigscan_direct_file_io_handle_read(
+	              direct_file_io_handle,
+	              buffer,
+	              16,
+	              &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libsigscan_direct_file_io_handle_read(
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsigscan_direct_file_io_handle_read(
+	              direct_file_io_handle,
+	              NULL,
+	              16,
+	              &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libsigscan_direct_file_io_handle_seek_offset(
+	          direct_file_io_handle,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_direct_file_io_handle_close(
+	          direct_file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_direct_file_io_handle_free(
+	          &direct_file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer_allocation );
+
+	remove(
+	 sigscan_test_direct_file_name );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file_io_handle != NULL )
+	{
+		libsigscan_direct_file_io_handle_free(
+		 &direct_file_io_handle,
+		 NULL );
+	}
+	if( buffer_allocation != NULL )
+	{
+		memory_free(
+		 buffer_allocation );
+	}
+	remove(
+	 sigscan_test_direct_file_name );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_direct_file_io_handle_initialize",
+	 sigscan_test_direct_file_io_handle_initialize );
+
+	/* TODO: add tests for libsigscan_direct_file_initialize */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_direct_file_io_handle_free",
+	 sigscan_test_direct_file_io_handle_free );
+
+	/* TODO: add tests for libsigscan_direct_file_io_handle_clone */
+
+	/* TODO: add tests for libsigscan_direct_file_io_handle_open */
+
+	/* TODO: add tests for libsigscan_direct_file_io_handle_close */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_direct_file_io_handle_read",
+	 sigscan_test_direct_file_io_handle_read );
+
+	/* TODO: add tests for libsigscan_direct_file_io_handle_write */
+
+	/* TODO: add tests for libsigscan_direct_file_io_handle_seek_offset */
+
+	/* TODO: add tests for libsigscan_direct_file_io_handle_exists */
+
+	/* TODO: add tests for libsigscan_direct_file_io_handle_is_open */
+
+	/* TODO: add tests for libsigscan_direct_file_io_handle_get_size */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_LIBSIGSCAN_DIRECT_FILE_IO_HANDLE ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
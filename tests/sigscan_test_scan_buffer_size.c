@@ -0,0 +1,426 @@
+/*
+ * Scan buffer size benchmark program
+ *
+ * Copyright (C) 2014-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_unused.h"
+
+/* The size of the benchmark file
+ */
+#define SIGSCAN_TEST_SCAN_BUFFER_SIZE_FILE_SIZE		( 32 * 1024 * 1024 )
+
+/* The offset of the signature that makes the header range span most of the benchmark file
+ */
+#define SIGSCAN_TEST_SCAN_BUFFER_SIZE_DEEP_OFFSET	( 24 * 1024 * 1024 )
+
+/* The number of times a file is scanned per scan buffer size
+ */
+#define SIGSCAN_TEST_SCAN_BUFFER_SIZE_NUMBER_OF_RUNS	8
+
+/* The scan buffer sizes that are benchmarked, where 0 represents
+ * that the scan buffer size is determined automatically
+ */
+size_t sigscan_test_scan_buffer_sizes[ 12 ] = {
+	0, 4096, 8192, 16384, 32768, 65536, 131072, 262144, 524288,
+	1024 * 1024, 2 * 1024 * 1024, 4 * 1024 * 1024 };
+
+const char *sigscan_test_scan_buffer_size_file_name = "sigscan_test_scan_buffer_size.raw";
+
+/* Writes the benchmark file
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scan_buffer_size_write_file(
+     const char *filename )
+{
+	uint8_t buffer[ 65536 ];
+
+	FILE *file_stream   = NULL;
+	size_t buffer_index = 0;
+	size_t file_offset  = 0;
+
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	while( file_offset < SIGSCAN_TEST_SCAN_BUFFER_SIZE_FILE_SIZE )
+	{
+		for( buffer_index = 0;
+		     buffer_index < 65536;
+		     buffer_index++ )
+		{
+			buffer[ buffer_index ] = (uint8_t) ( ( file_offset + buffer_index ) * 7 );
+		}
+		if( file_offset == 0 )
+		{
+			memory_copy(
+			 buffer,
+			 "regf",
+			 4 );
+		}
+		else if( file_offset == SIGSCAN_TEST_SCAN_BUFFER_SIZE_DEEP_OFFSET )
+		{
+			memory_copy(
+			 buffer,
+			 "deep",
+			 4 );
+		}
+		else if( ( file_offset + 65536 ) == SIGSCAN_TEST_SCAN_BUFFER_SIZE_FILE_SIZE )
+		{
+			memory_copy(
+			 &( buffer[ 65536 - 512 ] ),
+			 "koly",
+			 4 );
+		}
+		if( file_stream_write(
+		     file_stream,
+		     buffer,
+		     65536 ) != 65536 )
+		{
+			file_stream_close(
+			 file_stream );
+
+			return( -1 );
+		}
+		file_offset += 65536;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans the file with a specific scan buffer size
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scan_buffer_size_scan_file(
+     libsigscan_scanner_t *scanner,
+     const char *filename,
+     size_t scan_buffer_size,
+     int *number_of_results,
+     double *seconds,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_state_t *scan_state = NULL;
+	clock_t end_time                    = 0;
+	clock_t start_time                  = 0;
+
+	if( libsigscan_scanner_set_scan_buffer_size(
+	     scanner,
+	     scan_buffer_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsigscan_scan_state_initialize(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	start_time = clock();
+
+	if( libsigscan_scanner_scan_file(
+	     scanner,
+	     scan_state,
+	     filename,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	end_time = clock();
+
+	if( libsigscan_scan_state_get_number_of_results(
+	     scan_state,
+	     number_of_results,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsigscan_scan_state_free(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*seconds = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	return( 1 );
+
+on_error:
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	double best_seconds[ 12 ];
+
+	libcerror_error_t *error       = NULL;
+	libsigscan_scanner_t *scanner  = NULL;
+	const char *filename           = NULL;
+	double seconds                 = 0.0;
+	size_t scan_buffer_size        = 0;
+	int buffer_size_index          = 0;
+	int expected_number_of_results = 0;
+	int number_of_results          = 0;
+	int run_index                  = 0;
+	int write_file                 = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+#endif
+
+	/* The file to benchmark can be passed as an argument otherwise a file is written
+	 */
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( argc >= 2 )
+	{
+		filename = argv[ 1 ];
+	}
+#endif
+	if( filename == NULL )
+	{
+		filename   = sigscan_test_scan_buffer_size_file_name;
+		write_file = 1;
+	}
+	if( write_file != 0 )
+	{
+		if( sigscan_test_scan_buffer_size_write_file(
+		     filename ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write benchmark file: %s.\n",
+			 filename );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scanner_initialize(
+	     &scanner,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsigscan_scanner_add_signature(
+	     scanner,
+	     "regf",
+	     4,
+	     0,
+	     (uint8_t *) "regf",
+	     4,
+	     LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsigscan_scanner_add_signature(
+	     scanner,
+	     "deep",
+	     4,
+	     SIGSCAN_TEST_SCAN_BUFFER_SIZE_DEEP_OFFSET,
+	     (uint8_t *) "deep",
+	     4,
+	     LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsigscan_scanner_add_signature(
+	     scanner,
+	     "koly",
+	     4,
+	     512,
+	     (uint8_t *) "koly",
+	     4,
+	     LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The file is scanned once before the benchmark to warm up the caches,
+	 * every scan buffer size must result in the same number of results
+	 * as the automatically determined scan buffer size
+	 */
+	if( sigscan_test_scan_buffer_size_scan_file(
+	     scanner,
+	     filename,
+	     0,
+	     &expected_number_of_results,
+	     &seconds,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The scan buffer sizes are benchmarked in turn per run, hence changes
+	 * in the state of the system affect all scan buffer sizes alike
+	 */
+	for( run_index = 0;
+	     run_index < SIGSCAN_TEST_SCAN_BUFFER_SIZE_NUMBER_OF_RUNS;
+	     run_index++ )
+	{
+		for( buffer_size_index = 0;
+		     buffer_size_index < 12;
+		     buffer_size_index++ )
+		{
+			scan_buffer_size = sigscan_test_scan_buffer_sizes[ buffer_size_index ];
+
+			if( sigscan_test_scan_buffer_size_scan_file(
+			     scanner,
+			     filename,
+			     scan_buffer_size,
+			     &number_of_results,
+			     &seconds,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( number_of_results != expected_number_of_results )
+			{
+				fprintf(
+				 stderr,
+				 "Mismatch in number of results: %d with scan buffer size: %" PRIzd " expected: %d.\n",
+				 number_of_results,
+				 scan_buffer_size,
+				 expected_number_of_results );
+
+				goto on_error;
+			}
+			if( ( run_index == 0 )
+			 || ( seconds < best_seconds[ buffer_size_index ] ) )
+			{
+				best_seconds[ buffer_size_index ] = seconds;
+			}
+		}
+	}
+	fprintf(
+	 stdout,
+	 "Scan buffer size\tBest time (seconds)\tThroughput (MiB/s)\n" );
+
+	for( buffer_size_index = 0;
+	     buffer_size_index < 12;
+	     buffer_size_index++ )
+	{
+		scan_buffer_size = sigscan_test_scan_buffer_sizes[ buffer_size_index ];
+
+		if( scan_buffer_size == 0 )
+		{
+			fprintf(
+			 stdout,
+			 "automatic" );
+		}
+		else
+		{
+			fprintf(
+			 stdout,
+			 "%" PRIzd "",
+			 scan_buffer_size );
+		}
+		/* The throughput is only known for the benchmark file that was written
+		 */
+		if( ( write_file != 0 )
+		 && ( best_seconds[ buffer_size_index ] > 0.0 ) )
+		{
+			fprintf(
+			 stdout,
+			 "\t%.6f\t%.1f\n",
+			 best_seconds[ buffer_size_index ],
+			 (double) SIGSCAN_TEST_SCAN_BUFFER_SIZE_FILE_SIZE / ( best_seconds[ buffer_size_index ] * 1024.0 * 1024.0 ) );
+		}
+		else
+		{
+			fprintf(
+			 stdout,
+			 "\t%.6f\t-\n",
+			 best_seconds[ buffer_size_index ] );
+		}
+	}
+	if( libsigscan_scanner_free(
+	     &scanner,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( write_file != 0 )
+	{
+		remove(
+		 filename );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( write_file != 0 )
+	{
+		remove(
+		 filename );
+	}
+	return( EXIT_FAILURE );
+}
+
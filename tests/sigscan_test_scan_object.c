@@ -33,7 +33,10 @@
 #include "sigscan_test_memory.h"
 #include "sigscan_test_unused.h"
 
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_libcdata.h"
 #include "../libsigscan/libsigscan_scan_object.h"
+#include "../libsigscan/libsigscan_signature.h"
 
 #if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
 
@@ -75,6 +78,300 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_scan_object_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_object_compare(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libsigscan_scan_object_t *first_scan_object  = NULL;
+	libsigscan_scan_object_t *second_scan_object = NULL;
+	libsigscan_scan_object_t *shared_scan_object = NULL;
+	libsigscan_signature_t *first_signature      = NULL;
+	libsigscan_signature_t *second_signature     = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_signature_initialize(
+	          &first_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "first_signature",
+	 first_signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_initialize(
+	          &second_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "second_signature",
+	 second_signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_object_initialize(
+	          &first_scan_object,
+	          LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE,
+	          (intptr_t *) first_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "first_scan_object",
+	 first_scan_object );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_object_initialize(
+	          &second_scan_object,
+	          LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE,
+	          (intptr_t *) first_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "second_scan_object",
+	 second_scan_object );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_object_compare(
+	          first_scan_object,
+	          second_scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	second_scan_object->value = (intptr_t *) second_signature;
+
+	result = libsigscan_scan_object_compare(
+	          first_scan_object,
+	          second_scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_object_compare(
+	          NULL,
+	          second_scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_object_compare(
+	          first_scan_object,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test free of a shared scan object
+	 */
+	first_scan_object->number_of_references += 1;
+
+	shared_scan_object = first_scan_object;
+
+	result = libsigscan_scan_object_free(
+	          &shared_scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "shared_scan_object",
+	 shared_scan_object );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "first_scan_object->number_of_references",
+	 first_scan_object->number_of_references,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_object_free(
+	          &second_scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "second_scan_object",
+	 second_scan_object );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_object_free(
+	          &first_scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "first_scan_object",
+	 first_scan_object );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_free(
+	          &second_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "second_signature",
+	 second_signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_free(
+	          &first_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "first_signature",
+	 first_signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_scan_object != NULL )
+	{
+		libsigscan_scan_object_free(
+		 &second_scan_object,
+		 NULL );
+	}
+	if( first_scan_object != NULL )
+	{
+		libsigscan_scan_object_free(
+		 &first_scan_object,
+		 NULL );
+	}
+	if( second_signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &second_signature,
+		 NULL );
+	}
+	if( first_signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &first_signature,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
 
 /* The main program
@@ -100,6 +397,10 @@ int main(
 	 "libsigscan_scan_object_free",
 	 sigscan_test_scan_object_free );
 
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_object_compare",
+	 sigscan_test_scan_object_compare );
+
 	/* TODO: add tests for libsigscan_scan_object_get_type */
 
 	/* TODO: add tests for libsigscan_scan_object_get_value */
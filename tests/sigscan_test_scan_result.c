@@ -98,6 +98,8 @@ int main(
 
 	/* TODO: add tests for libsigscan_scan_result_get_identifier */
 
+	/* TODO: add tests for libsigscan_scan_result_get_offset */
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,7 +35,11 @@
 #include "sigscan_test_memory.h"
 #include "sigscan_test_unused.h"
 
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_libcdata.h"
 #include "../libsigscan/libsigscan_scan_state.h"
+#include "../libsigscan/libsigscan_scan_tree.h"
+#include "../libsigscan/libsigscan_signature.h"
 
 /* Tests the libsigscan_scan_state_initialize function
  * Returns 1 if successful or 0 if not
@@ -502,18 +508,829 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_scan_state_set_data_origin function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_set_data_origin(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_set_data_origin(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_set_data_origin(
+	          NULL,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_set_data_origin(
+	          scan_state,
+	          -1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_state_set_skip_block_size function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_set_skip_block_size(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_set_skip_block_size(
+	          scan_state,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_set_skip_block_size(
+	          NULL,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_set_skip_block_size(
+	          scan_state,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
 
-/* Tests the libsigscan_scan_state_get_buffer_size function
+/* Tests the libsigscan_scan_state_get_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_get_buffer_size(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	size_t buffer_size                  = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_get_buffer_size(
+	          scan_state,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_get_buffer_size(
+	          NULL,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_get_buffer_size(
+	          scan_state,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_internal_scan_state_scan_unbound_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_internal_scan_state_scan_unbound_buffer(
+     void )
+{
+	uint8_t buffer[ 40 ];
+
+	const char *patterns[ 9 ] = {
+		"ABCD", "BCDEF", "CDEFGH", "QQQQ", "PRST5", "LMNO4", "XYZW1", "EFGH2", "HIJK3" };
+
+	off64_t expected_offsets[ 3 ] = {
+		5, 20, 36 };
+
+	int expected_patterns[ 3 ] = {
+		2, 4, 0 };
+
+	libcdata_list_t *signatures_list      = NULL;
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scan_tree_t *scan_tree     = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	off64_t offset                        = 0;
+	size_t buffer_offset                  = 0;
+	size_t pattern_size                   = 0;
+	int number_of_results                 = 0;
+	int pattern_index                     = 0;
+	int result                            = 0;
+	int result_index                      = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 buffer,
+	 0,
+	 40 );
+
+	for( result_index = 0;
+	     result_index < 3;
+	     result_index++ )
+	{
+		pattern_index = expected_patterns[ result_index ];
+		pattern_size  = narrow_string_length(
+		                 patterns[ pattern_index ] );
+
+		memory_copy(
+		 &( buffer[ expected_offsets[ result_index ] ] ),
+		 patterns[ pattern_index ],
+		 pattern_size );
+	}
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( pattern_index = 0;
+	     pattern_index < 9;
+	     pattern_index++ )
+	{
+		result = libsigscan_signature_initialize(
+		          &signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "signature",
+		 signature );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		pattern_size = narrow_string_length(
+		                patterns[ pattern_index ] );
+
+		result = libsigscan_signature_set(
+		          signature,
+		          patterns[ pattern_index ],
+		          pattern_size,
+		          0,
+		          (uint8_t *) patterns[ pattern_index ],
+		          pattern_size,
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_list_append_value(
+		          signatures_list,
+		          (intptr_t *) signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		signature = NULL;
+	}
+	result = libsigscan_scan_tree_initialize(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_build(
+	          scan_tree,
+	          signatures_list,
+	          NULL,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* More than 8 signatures are scanned by the scan tree instead of the BNDM table
+	 */
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree->bndm_table",
+	 scan_tree->bndm_table );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_internal_scan_state_scan_unbound_buffer(
+	          NULL,
+	          buffer,
+	          40,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test scan unbound buffer with a scan state without a scan tree
+	 */
+	result = libsigscan_internal_scan_state_scan_unbound_buffer(
+	          (libsigscan_internal_scan_state_t *) scan_state,
+	          buffer,
+	          40,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_start(
+	          scan_state,
+	          NULL,
+	          NULL,
+	          scan_tree,
+	          NULL,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The bytes that can contain the start of the largest pattern are carried over
+	 */
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "carry_over_size",
+	 ( (libsigscan_internal_scan_state_t *) scan_state )->carry_over_size,
+	 (size_t) 5 );
+
+	/* Every buffer is smaller than the patterns hence the patterns
+	 * are only matched by the carry-over buffer
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 40;
+	     buffer_offset++ )
+	{
+		result = libsigscan_scan_state_scan_buffer(
+		          scan_state,
+		          &( buffer[ buffer_offset ] ),
+		          1,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scan_state_stop(
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( result_index = 0;
+	     result_index < 3;
+	     result_index++ )
+	{
+		result = libsigscan_scan_state_get_result(
+		          scan_state,
+		          result_index,
+		          &scan_result,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scan_result",
+		 scan_result );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_result_get_offset(
+		          scan_result,
+		          &offset,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) expected_offsets[ result_index ] );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_result_free(
+		          &scan_result,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_free(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &scan_tree,
+		 NULL );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_internal_scan_state_append_footer_buffer function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scan_state_get_buffer_size(
+int sigscan_test_internal_scan_state_append_footer_buffer(
      void )
 {
-	libcerror_error_t *error            = NULL;
-	libsigscan_scan_state_t *scan_state = NULL;
-	size_t buffer_size                  = 0;
-	int result                          = 0;
+	uint8_t footer_buffer[ 8 ];
+
+	libcerror_error_t *error                              = NULL;
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	libsigscan_scan_state_t *scan_state                   = NULL;
+	int result                                            = 0;
 
 	/* Initialize test
 	 */
@@ -534,11 +1351,81 @@ int sigscan_test_scan_state_get_buffer_size(
 	 "error",
 	 error );
 
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	internal_scan_state->footer_buffer      = footer_buffer;
+	internal_scan_state->footer_buffer_size = 8;
+
 	/* Test regular cases
 	 */
-	result = libsigscan_scan_state_get_buffer_size(
-	          scan_state,
-	          &buffer_size,
+	result = libsigscan_internal_scan_state_append_footer_buffer(
+	          internal_scan_state,
+	          (uint8_t *) "abcde",
+	          5,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_scan_state->footer_buffer_offset",
+	 internal_scan_state->footer_buffer_offset,
+	 (size_t) 5 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_scan_state->footer_buffer_data_size",
+	 internal_scan_state->footer_buffer_data_size,
+	 (size_t) 5 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the footer buffer wraps around
+	 */
+	result = libsigscan_internal_scan_state_append_footer_buffer(
+	          internal_scan_state,
+	          (uint8_t *) "fghij",
+	          5,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_scan_state->footer_buffer_offset",
+	 internal_scan_state->footer_buffer_offset,
+	 (size_t) 2 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_scan_state->footer_buffer_data_size",
+	 internal_scan_state->footer_buffer_data_size,
+	 (size_t) 8 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          footer_buffer,
+	          "ijcdefgh",
+	          8 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if only the last bytes of a buffer larger than the footer buffer are kept
+	 */
+	result = libsigscan_internal_scan_state_append_footer_buffer(
+	          internal_scan_state,
+	          (uint8_t *) "0123456789AB",
+	          12,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -546,15 +1433,31 @@ int sigscan_test_scan_state_get_buffer_size(
 	 result,
 	 1 );
 
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_scan_state->footer_buffer_offset",
+	 internal_scan_state->footer_buffer_offset,
+	 (size_t) 2 );
+
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          footer_buffer,
+	          "AB456789",
+	          8 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libsigscan_scan_state_get_buffer_size(
+	result = libsigscan_internal_scan_state_append_footer_buffer(
 	          NULL,
-	          &buffer_size,
+	          (uint8_t *) "abcde",
+	          5,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -569,9 +1472,48 @@ int sigscan_test_scan_state_get_buffer_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scan_state_get_buffer_size(
-	          scan_state,
+	result = libsigscan_internal_scan_state_append_footer_buffer(
+	          internal_scan_state,
 	          NULL,
+	          5,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_internal_scan_state_append_footer_buffer(
+	          internal_scan_state,
+	          (uint8_t *) "abcde",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_scan_state->footer_buffer = NULL;
+
+	result = libsigscan_internal_scan_state_append_footer_buffer(
+	          internal_scan_state,
+	          (uint8_t *) "abcde",
+	          5,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -588,6 +1530,8 @@ int sigscan_test_scan_state_get_buffer_size(
 
 	/* Clean up
 	 */
+	internal_scan_state->footer_buffer_size = 0;
+
 	result = libsigscan_scan_state_free(
 	          &scan_state,
 	          &error );
@@ -615,6 +1559,8 @@ on_error:
 	}
 	if( scan_state != NULL )
 	{
+		( (libsigscan_internal_scan_state_t *) scan_state )->footer_buffer = NULL;
+
 		libsigscan_scan_state_free(
 		 &scan_state,
 		 NULL );
@@ -935,8 +1881,20 @@ int main(
 	 "libsigscan_scan_state_set_data_size",
 	 sigscan_test_scan_state_set_data_size );
 
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_state_set_data_origin",
+	 sigscan_test_scan_state_set_data_origin );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_state_set_skip_block_size",
+	 sigscan_test_scan_state_set_skip_block_size );
+
 #if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
 
+	/* TODO: add tests for libsigscan_scan_state_get_data_origin */
+
+	/* TODO: add tests for libsigscan_scan_state_get_skip_block_size */
+
 	SIGSCAN_TEST_RUN(
 	 "libsigscan_scan_state_get_buffer_size",
 	 sigscan_test_scan_state_get_buffer_size );
@@ -951,6 +1909,18 @@ int main(
 
 	/* TODO: add tests for libsigscan_scan_state_flush */
 
+	/* TODO: add tests for libsigscan_internal_scan_state_scan_header_buffer */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_internal_scan_state_scan_unbound_buffer",
+	 sigscan_test_internal_scan_state_scan_unbound_buffer );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_internal_scan_state_append_footer_buffer",
+	 sigscan_test_internal_scan_state_append_footer_buffer );
+
+	/* TODO: add tests for libsigscan_internal_scan_state_scan_footer_buffer */
+
 	/* TODO: add tests for libsigscan_scan_state_scan_buffer */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,7 +35,12 @@
 #include "sigscan_test_memory.h"
 #include "sigscan_test_unused.h"
 
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_libcdata.h"
+#include "../libsigscan/libsigscan_scan_object.h"
+#include "../libsigscan/libsigscan_scan_tree.h"
 #include "../libsigscan/libsigscan_scan_tree_node.h"
+#include "../libsigscan/libsigscan_signature.h"
 
 #if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
 
@@ -75,6 +82,490 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_scan_tree_node_scan_buffer_unbound function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_node_scan_buffer_unbound(
+     void )
+{
+	uint8_t buffer[ 32 ];
+
+	const char *patterns[ 9 ] = {
+		"ABCD", "BCDEF", "CDEFGH", "QQQQ", "PRST5", "LMNO4", "XYZW1", "EFGH2", "HIJK3" };
+
+	off64_t expected_offsets[ 4 ] = {
+		2, 10, 20, 28 };
+
+	int expected_patterns[ 4 ] = {
+		0, 2, 4, 0 };
+
+	libcdata_list_t *signatures_list      = NULL;
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_object_t *scan_object = NULL;
+	libsigscan_scan_tree_t *scan_tree     = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	size_t buffer_offset                  = 0;
+	size_t pattern_size                   = 0;
+	uint8_t scan_object_type              = 0;
+	int expected_pattern_index            = 0;
+	int pattern_index                     = 0;
+	int result                            = 0;
+	int result_index                      = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 buffer,
+	 0,
+	 32 );
+
+	for( result_index = 0;
+	     result_index < 4;
+	     result_index++ )
+	{
+		pattern_index = expected_patterns[ result_index ];
+		pattern_size  = narrow_string_length(
+		                 patterns[ pattern_index ] );
+
+		memory_copy(
+		 &( buffer[ expected_offsets[ result_index ] ] ),
+		 patterns[ pattern_index ],
+		 pattern_size );
+	}
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( pattern_index = 0;
+	     pattern_index < 9;
+	     pattern_index++ )
+	{
+		result = libsigscan_signature_initialize(
+		          &signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "signature",
+		 signature );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		pattern_size = narrow_string_length(
+		                patterns[ pattern_index ] );
+
+		result = libsigscan_signature_set(
+		          signature,
+		          patterns[ pattern_index ],
+		          pattern_size,
+		          0,
+		          (uint8_t *) patterns[ pattern_index ],
+		          pattern_size,
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_list_append_value(
+		          signatures_list,
+		          (intptr_t *) signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		signature = NULL;
+	}
+	result = libsigscan_scan_tree_initialize(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_build(
+	          scan_tree,
+	          signatures_list,
+	          NULL,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree->root_node",
+	 scan_tree->root_node );
+
+	/* Test regular cases
+	 * The data is 30 bytes hence the last "ABCD" is truncated and should not match
+	 */
+	result_index = 0;
+
+	for( buffer_offset = 0;
+	     buffer_offset < 30;
+	     buffer_offset++ )
+	{
+		scan_object = NULL;
+
+		result = libsigscan_scan_tree_node_scan_buffer_unbound(
+		          scan_tree->root_node,
+		          (off64_t) buffer_offset,
+		          30,
+		          buffer,
+		          32,
+		          buffer_offset,
+		          &scan_object,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( result_index < 3 )
+		 && ( (off64_t) buffer_offset == expected_offsets[ result_index ] ) )
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "scan_object",
+			 scan_object );
+
+			result = libsigscan_scan_object_get_type(
+			          scan_object,
+			          &scan_object_type,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_UINT8(
+			 "scan_object_type",
+			 scan_object_type,
+			 (uint8_t) LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE );
+
+			result = libsigscan_scan_object_get_value(
+			          scan_object,
+			          (intptr_t **) &signature,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "signature",
+			 signature );
+
+			expected_pattern_index = expected_patterns[ result_index ];
+
+			pattern_size = narrow_string_length(
+			                patterns[ expected_pattern_index ] );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+			 "signature->pattern_size",
+			 signature->pattern_size,
+			 pattern_size );
+
+			result = memory_compare(
+			          signature->pattern,
+			          patterns[ expected_pattern_index ],
+			          pattern_size );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			signature = NULL;
+
+			result_index++;
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result_index",
+	 result_index,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_node_scan_buffer_unbound(
+	          NULL,
+	          0,
+	          30,
+	          buffer,
+	          32,
+	          0,
+	          &scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_node_scan_buffer_unbound(
+	          scan_tree->root_node,
+	          -1,
+	          30,
+	          buffer,
+	          32,
+	          0,
+	          &scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_node_scan_buffer_unbound(
+	          scan_tree->root_node,
+	          30,
+	          30,
+	          buffer,
+	          32,
+	          0,
+	          &scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_node_scan_buffer_unbound(
+	          scan_tree->root_node,
+	          0,
+	          30,
+	          NULL,
+	          32,
+	          0,
+	          &scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_node_scan_buffer_unbound(
+	          scan_tree->root_node,
+	          0,
+	          30,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_node_scan_buffer_unbound(
+	          scan_tree->root_node,
+	          0,
+	          30,
+	          buffer,
+	          32,
+	          32,
+	          &scan_object,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_node_scan_buffer_unbound(
+	          scan_tree->root_node,
+	          0,
+	          30,
+	          buffer,
+	          32,
+	          0,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_tree_free(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &scan_tree,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
 
 /* The main program
@@ -108,6 +599,14 @@ int main(
 
 	/* TODO: add tests for libsigscan_scan_tree_node_scan_buffer */
 
+	/* TODO: add tests for libsigscan_scan_tree_node_scan_buffer_bound_to_start */
+
+	/* TODO: add tests for libsigscan_scan_tree_node_scan_buffer_bound_to_end */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_node_scan_buffer_unbound",
+	 sigscan_test_scan_tree_node_scan_buffer_unbound );
+
 	/* TODO: add tests for libsigscan_scan_tree_node_printf */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
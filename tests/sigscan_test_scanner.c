@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +35,10 @@
 #include "sigscan_test_memory.h"
 #include "sigscan_test_unused.h"
 
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_libbfio.h"
+#include "../libsigscan/libsigscan_scanner.h"
+
 /* Tests the libsigscan_scanner_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -319,46 +325,4987 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libsigscan_scanner_set_scan_buffer_size function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
-#endif
+int sigscan_test_scanner_set_scan_buffer_size(
+     void )
 {
-	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
-	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	int result                    = 0;
 
-	SIGSCAN_TEST_RUN(
-	 "libsigscan_scanner_initialize",
-	 sigscan_test_scanner_initialize );
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
 
-	SIGSCAN_TEST_RUN(
-	 "libsigscan_scanner_free",
-	 sigscan_test_scanner_free );
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for sigscan_test_scanner_signal_abort */
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
 
-	/* TODO: add tests for libsigscan_scanner_set_scan_buffer_size */
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libsigscan_scanner_add_signature */
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          8192,
+	          &error );
 
-	/* TODO: add tests for libsigscan_scanner_scan_start */
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libsigscan_scanner_scan_stop */
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libsigscan_scanner_scan_buffer */
+	/* Test set scan buffer size to be determined automatically
+	 */
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          0,
+	          &error );
 
-	/* TODO: add tests for libsigscan_scanner_scan_file */
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libsigscan_scanner_scan_file_wide */
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          NULL,
+	          8192,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+/* Tests the libsigscan_internal_scanner_get_read_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_internal_scanner_get_read_buffer_size(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	libsigscan_scanner_t *scanner                   = NULL;
+	size_t buffer_size                              = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	internal_scanner->cache_size = 1024 * 1024;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_internal_scanner_get_read_buffer_size(
+	          internal_scanner,
+	          64 * 1024 * 1024,
+	          4096,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) ( 256 * 1024 ) );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read buffer size of data that fits in a single buffer
+	 */
+	result = libsigscan_internal_scanner_get_read_buffer_size(
+	          internal_scanner,
+	          1000,
+	          4096,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) 1000 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read buffer size of a preferred IO block size that does not divide the cache size
+	 */
+	result = libsigscan_internal_scanner_get_read_buffer_size(
+	          internal_scanner,
+	          64 * 1024 * 1024,
+	          3 * 65536,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) ( 3 * 65536 ) );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read buffer size of multiple read buffers that share the cache
+	 */
+	internal_scanner->number_of_read_buffers = 2;
+
+	result = libsigscan_internal_scanner_get_read_buffer_size(
+	          internal_scanner,
+	          64 * 1024 * 1024,
+	          0,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) ( 128 * 1024 ) );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_scanner->number_of_read_buffers = 64;
+
+	result = libsigscan_internal_scanner_get_read_buffer_size(
+	          internal_scanner,
+	          64 * 1024 * 1024,
+	          0,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) ( 64 * 1024 ) );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_scanner->number_of_read_buffers = 0;
+
+	/* Test read buffer size of a scan buffer size that was set
+	 */
+	internal_scanner->buffer_size = 8192;
+
+	result = libsigscan_internal_scanner_get_read_buffer_size(
+	          internal_scanner,
+	          64 * 1024 * 1024,
+	          4096,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) 8192 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_scanner->buffer_size = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_internal_scanner_get_read_buffer_size(
+	          NULL,
+	          64 * 1024 * 1024,
+	          4096,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_internal_scanner_get_read_buffer_size(
+	          internal_scanner,
+	          64 * 1024 * 1024,
+	          4096,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( LIBSIGSCAN_HAVE_BFIO )
+
+/* Tests the libsigscan_internal_scanner_scan_file_io_handle_range function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_internal_scanner_scan_file_io_handle_range(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	/* The pattern at offset 4092 crosses the boundary of the read buffers
+	 */
+	off64_t expected_offsets[ 2 ] = {
+		4092, 20000 };
+
+	int numbers_of_read_buffers[ 2 ] = {
+		1, 4 };
+
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	uint8_t *data                         = NULL;
+	off64_t offset                        = 0;
+	int number_of_results                 = 0;
+	int read_buffers_index                = 0;
+	int result                            = 0;
+	int result_index                      = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 32768 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	memory_set(
+	 data,
+	 0,
+	 32768 );
+
+	for( result_index = 0;
+	     result_index < 2;
+	     result_index++ )
+	{
+		memory_copy(
+		 &( data[ expected_offsets[ result_index ] ] ),
+		 "ABCDEFGH",
+		 8 );
+	}
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          32768,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test",
+	          4,
+	          0,
+	          (uint8_t *) "ABCDEFGH",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( read_buffers_index = 0;
+	     read_buffers_index < 2;
+	     read_buffers_index++ )
+	{
+		result = libsigscan_scan_state_initialize(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scan_state",
+		 scan_state );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_start(
+		          scanner,
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_internal_scanner_scan_file_io_handle_range(
+		          scan_state,
+		          file_io_handle,
+		          0,
+		          32768,
+		          buffer,
+		          4096,
+		          numbers_of_read_buffers[ read_buffers_index ],
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_stop(
+		          scanner,
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_get_number_of_results(
+		          scan_state,
+		          &number_of_results,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "number_of_results",
+		 number_of_results,
+		 2 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( result_index = 0;
+		     result_index < 2;
+		     result_index++ )
+		{
+			result = libsigscan_scan_state_get_result(
+			          scan_state,
+			          result_index,
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "scan_result",
+			 scan_result );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_get_offset(
+			          scan_result,
+			          &offset,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 (int64_t) offset,
+			 (int64_t) expected_offsets[ result_index ] );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_free(
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scan_state_free(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "scan_state",
+		 scan_state );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	for( read_buffers_index = 0;
+	     read_buffers_index < 2;
+	     read_buffers_index++ )
+	{
+		result = libsigscan_scan_state_initialize(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scan_state",
+		 scan_state );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_start(
+		          scanner,
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test scan file IO handle range where reading fails in the middle of the range
+		 */
+		result = libsigscan_internal_scanner_scan_file_io_handle_range(
+		          scan_state,
+		          file_io_handle,
+		          16384,
+		          32768,
+		          buffer,
+		          4096,
+		          numbers_of_read_buffers[ read_buffers_index ],
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libsigscan_scanner_scan_stop(
+		          scanner,
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_free(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "scan_state",
+		 scan_state );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan file IO handle range where scanning fails while the range is read ahead
+	 */
+	result = libsigscan_internal_scanner_scan_file_io_handle_range(
+	          scan_state,
+	          file_io_handle,
+	          0,
+	          32768,
+	          buffer,
+	          4096,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_internal_scanner_scan_file_io_handle_range(
+	          scan_state,
+	          file_io_handle,
+	          -1,
+	          32768,
+	          buffer,
+	          4096,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_internal_scanner_scan_file_io_handle_range(
+	          scan_state,
+	          file_io_handle,
+	          0,
+	          32768,
+	          NULL,
+	          4096,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_internal_scanner_scan_file_io_handle_range(
+	          scan_state,
+	          file_io_handle,
+	          0,
+	          32768,
+	          buffer,
+	          0,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBSIGSCAN_HAVE_BFIO ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+/* Tests the libsigscan_scanner_update_byte_value_frequencies function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_update_byte_value_frequencies(
+     void )
+{
+	uint8_t buffer[ 16 ]                = { 'r', 'e', 'g', 'f', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "regf",
+	          4,
+	          0,
+	          (uint8_t *) "regf",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_update_byte_value_frequencies(
+	          scanner,
+	          buffer,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the scan trees built with the byte value frequencies match the signature
+	 */
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_update_byte_value_frequencies(
+	          NULL,
+	          buffer,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test update after the scan trees have been built
+	 */
+	result = libsigscan_scanner_update_byte_value_frequencies(
+	          scanner,
+	          buffer,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_get_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_get_memory_usage(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	size64_t memory_usage               = 0;
+	size64_t saved_memory_usage         = 0;
+	size64_t signatures_memory_usage    = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "regf",
+	          4,
+	          0,
+	          (uint8_t *) "regf",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "vhdi_footer",
+	          11,
+	          512,
+	          (uint8_t *) "conectix",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_get_memory_usage(
+	          scanner,
+	          &memory_usage,
+	          &saved_memory_usage,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "saved_memory_usage",
+	 (uint64_t) saved_memory_usage,
+	 (uint64_t) 0 );
+
+	/* Test memory usage after the scan trees have been built
+	 */
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signatures_memory_usage = memory_usage;
+
+	result = libsigscan_scanner_get_memory_usage(
+	          scanner,
+	          &memory_usage,
+	          &saved_memory_usage,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_GREATER_THAN_INT(
+	 "memory_usage",
+	 (int) ( memory_usage > signatures_memory_usage ),
+	 0 );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_get_memory_usage(
+	          NULL,
+	          &memory_usage,
+	          &saved_memory_usage,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_get_memory_usage(
+	          scanner,
+	          NULL,
+	          &saved_memory_usage,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_get_memory_usage(
+	          scanner,
+	          &memory_usage,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_buffer(
+     void )
+{
+	uint8_t buffer[ 200 ];
+
+	const char *patterns[ 9 ] = {
+		"ABCD", "BCDEF", "CDEFGH", "QQQQ", "PRST5", "LMNO4", "XYZW1", "EFGH2", "HIJK3" };
+
+	/* The patterns at offset 61 and 126 cross the boundary of the scanned buffers
+	 */
+	off64_t expected_offsets[ 6 ] = {
+		0, 30, 61, 100, 126, 195 };
+
+	/* More than 8 unbound signatures are scanned by the unbound scan tree,
+	 * a small set of short unbound signatures is scanned by the BNDM table
+	 */
+	int numbers_of_signatures[ 2 ] = {
+		9, 6 };
+
+	size_t skip_block_sizes[ 3 ] = {
+		0, 2, 3 };
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	off64_t offset                        = 0;
+	size_t buffer_offset                  = 0;
+	size_t pattern_size                   = 0;
+	size_t read_size                      = 0;
+	int number_of_results                 = 0;
+	int number_of_signatures              = 0;
+	int pattern_index                     = 0;
+	int result                            = 0;
+	int result_index                      = 0;
+	int signatures_set_index              = 0;
+	int skip_block_size_index             = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+#endif
+
+	/* Initialize test
+	 */
+	memory_set(
+	 buffer,
+	 0,
+	 200 );
+
+	for( result_index = 0;
+	     result_index < 6;
+	     result_index++ )
+	{
+		pattern_size = narrow_string_length(
+		                patterns[ result_index ] );
+
+		memory_copy(
+		 &( buffer[ expected_offsets[ result_index ] ] ),
+		 patterns[ result_index ],
+		 pattern_size );
+	}
+	/* Test regular cases
+	 */
+	for( signatures_set_index = 0;
+	     signatures_set_index < 2;
+	     signatures_set_index++ )
+	{
+		number_of_signatures = numbers_of_signatures[ signatures_set_index ];
+
+		result = libsigscan_scanner_initialize(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scanner",
+		 scanner );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( pattern_index = 0;
+		     pattern_index < number_of_signatures;
+		     pattern_index++ )
+		{
+			pattern_size = narrow_string_length(
+			                patterns[ pattern_index ] );
+
+			result = libsigscan_scanner_add_signature(
+			          scanner,
+			          patterns[ pattern_index ],
+			          pattern_size,
+			          0,
+			          (uint8_t *) patterns[ pattern_index ],
+			          pattern_size,
+			          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( skip_block_size_index = 0;
+		     skip_block_size_index < 3;
+		     skip_block_size_index++ )
+		{
+			result = libsigscan_scan_state_initialize(
+			          &scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "scan_state",
+			 scan_state );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_set_skip_block_size(
+			          scan_state,
+			          skip_block_sizes[ skip_block_size_index ],
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scanner_scan_start(
+			          scanner,
+			          scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+			internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "internal_scanner->scan_tree",
+			 internal_scanner->scan_tree );
+
+			if( number_of_signatures > 8 )
+			{
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "internal_scanner->scan_tree->bndm_table",
+				 internal_scanner->scan_tree->bndm_table );
+			}
+			else
+			{
+				SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+				 "internal_scanner->scan_tree->bndm_table",
+				 internal_scanner->scan_tree->bndm_table );
+			}
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+			for( buffer_offset = 0;
+			     buffer_offset < 200;
+			     buffer_offset += read_size )
+			{
+				read_size = 200 - buffer_offset;
+
+				if( read_size > 64 )
+				{
+					read_size = 64;
+				}
+				result = libsigscan_scanner_scan_buffer(
+				          scanner,
+				          scan_state,
+				          &( buffer[ buffer_offset ] ),
+				          read_size,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			result = libsigscan_scanner_scan_stop(
+			          scanner,
+			          scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_get_number_of_results(
+			          scan_state,
+			          &number_of_results,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "number_of_results",
+			 number_of_results,
+			 6 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( result_index = 0;
+			     result_index < 6;
+			     result_index++ )
+			{
+				result = libsigscan_scan_state_get_result(
+				          scan_state,
+				          result_index,
+				          &scan_result,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+				 "scan_result",
+				 scan_result );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scan_result_get_offset(
+				          scan_result,
+				          &offset,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+				 "offset",
+				 (int64_t) offset,
+				 (int64_t) expected_offsets[ result_index ] );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scan_result_free(
+				          &scan_result,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			result = libsigscan_scan_state_free(
+			          &scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "scan_state",
+			 scan_state );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "scanner",
+		 scanner );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer function with unbound patterns
+ * that overlap, are a prefix of each other and differ in size
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_buffer_overlapping_patterns(
+     void )
+{
+	uint8_t buffer[ 200 ];
+
+	const char *identifiers[ 9 ] = {
+		"zip", "zip_v20", "abcde", "defghij", "abcdefghijkl", "elf", "pdf", "gif", "png" };
+
+	const char *patterns[ 9 ] = {
+		"PK\003\004", "PK\003\004\024\000", "ABCDE", "DEFGHIJ", "ABCDEFGHIJKL", "\177ELF", "%PDF-", "GIF89a", "\211PNG" };
+
+	size_t pattern_sizes[ 9 ] = {
+		4, 6, 5, 7, 12, 4, 5, 6, 4 };
+
+	/* The data at offset 60 and 124 crosses the boundary of the scanned buffers
+	 */
+	const char *data[ 8 ] = {
+		"PK\003\004\024\000", "PK\003\004\012", "PK\003\004\024\001", "ABCDEFGHIJKL", "ABCDEFGHIJ", "DEFGHIJ", "ABCDEFGHIJK", "PK\003\004" };
+
+	size_t data_sizes[ 8 ] = {
+		6, 5, 6, 12, 10, 7, 11, 4 };
+
+	/* If multiple patterns match at the same offset the largest pattern is matched,
+	 * scanning continues after the matching pattern
+	 */
+	const char *expected_identifiers[ 8 ] = {
+		"zip_v20", "zip", "zip", "abcdefghijkl", "abcde", "defghij", "abcde", "zip" };
+
+	off64_t expected_offsets[ 8 ] = {
+		0, 20, 40, 60, 90, 124, 150, 196 };
+
+	/* More than 8 unbound signatures are scanned by the unbound scan tree,
+	 * a small set of short unbound signatures is scanned by the BNDM table
+	 */
+	int numbers_of_signatures[ 2 ] = {
+		9, 5 };
+
+	size_t skip_block_sizes[ 3 ] = {
+		0, 2, 3 };
+
+	char identifier[ 32 ];
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	off64_t offset                        = 0;
+	size_t buffer_offset                  = 0;
+	size_t identifier_size                = 0;
+	size_t read_size                      = 0;
+	int number_of_results                 = 0;
+	int number_of_signatures              = 0;
+	int pattern_index                     = 0;
+	int result                            = 0;
+	int result_index                      = 0;
+	int signatures_set_index              = 0;
+	int skip_block_size_index             = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 buffer,
+	 0,
+	 200 );
+
+	for( result_index = 0;
+	     result_index < 8;
+	     result_index++ )
+	{
+		memory_copy(
+		 &( buffer[ expected_offsets[ result_index ] ] ),
+		 data[ result_index ],
+		 data_sizes[ result_index ] );
+	}
+	/* Test regular cases
+	 */
+	for( signatures_set_index = 0;
+	     signatures_set_index < 2;
+	     signatures_set_index++ )
+	{
+		number_of_signatures = numbers_of_signatures[ signatures_set_index ];
+
+		result = libsigscan_scanner_initialize(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scanner",
+		 scanner );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( pattern_index = 0;
+		     pattern_index < number_of_signatures;
+		     pattern_index++ )
+		{
+			result = libsigscan_scanner_add_signature(
+			          scanner,
+			          identifiers[ pattern_index ],
+			          narrow_string_length(
+			           identifiers[ pattern_index ] ),
+			          0,
+			          (uint8_t *) patterns[ pattern_index ],
+			          pattern_sizes[ pattern_index ],
+			          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( skip_block_size_index = 0;
+		     skip_block_size_index < 3;
+		     skip_block_size_index++ )
+		{
+			result = libsigscan_scan_state_initialize(
+			          &scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "scan_state",
+			 scan_state );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_set_skip_block_size(
+			          scan_state,
+			          skip_block_sizes[ skip_block_size_index ],
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scanner_scan_start(
+			          scanner,
+			          scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( buffer_offset = 0;
+			     buffer_offset < 200;
+			     buffer_offset += read_size )
+			{
+				read_size = 200 - buffer_offset;
+
+				if( read_size > 64 )
+				{
+					read_size = 64;
+				}
+				result = libsigscan_scanner_scan_buffer(
+				          scanner,
+				          scan_state,
+				          &( buffer[ buffer_offset ] ),
+				          read_size,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			result = libsigscan_scanner_scan_stop(
+			          scanner,
+			          scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_get_number_of_results(
+			          scan_state,
+			          &number_of_results,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "number_of_results",
+			 number_of_results,
+			 8 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( result_index = 0;
+			     result_index < 8;
+			     result_index++ )
+			{
+				result = libsigscan_scan_state_get_result(
+				          scan_state,
+				          result_index,
+				          &scan_result,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+				 "scan_result",
+				 scan_result );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scan_result_get_offset(
+				          scan_result,
+				          &offset,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+				 "offset",
+				 (int64_t) offset,
+				 (int64_t) expected_offsets[ result_index ] );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scan_result_get_identifier(
+				          scan_result,
+				          identifier,
+				          32,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				identifier_size = narrow_string_length(
+				                   expected_identifiers[ result_index ] ) + 1;
+
+				result = narrow_string_compare(
+				          identifier,
+				          expected_identifiers[ result_index ],
+				          identifier_size );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+
+				result = libsigscan_scan_result_free(
+				          &scan_result,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			result = libsigscan_scan_state_free(
+			          &scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "scan_state",
+			 scan_state );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "scanner",
+		 scanner );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_iovec function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_iovec(
+     void )
+{
+	libsigscan_buffer_segment_t segments[ 3 ];
+
+	uint8_t buffer[ 16 ]                = { 'r', 'e', 'g', 'f', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "regf",
+	          4,
+	          0,
+	          (uint8_t *) "regf",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The signature crosses the boundary of the first and third segment
+	 */
+	segments[ 0 ].buffer      = buffer;
+	segments[ 0 ].buffer_size = 2;
+	segments[ 1 ].buffer      = NULL;
+	segments[ 1 ].buffer_size = 0;
+	segments[ 2 ].buffer      = &( buffer[ 2 ] );
+	segments[ 2 ].buffer_size = 14;
+
+	result = libsigscan_scanner_scan_iovec(
+	          scanner,
+	          scan_state,
+	          segments,
+	          3,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_iovec(
+	          NULL,
+	          scan_state,
+	          segments,
+	          3,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_iovec(
+	          scanner,
+	          scan_state,
+	          NULL,
+	          3,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_iovec(
+	          scanner,
+	          scan_state,
+	          segments,
+	          -1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test scan iovec with a scan state that was not started
+	 */
+	result = libsigscan_scanner_scan_iovec(
+	          scanner,
+	          scan_state,
+	          segments,
+	          3,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_identify_buffers function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_identify_buffers(
+     void )
+{
+	libsigscan_identify_result_t results[ 3 ];
+	const uint8_t *buffers[ 3 ];
+	size_t buffer_sizes[ 3 ];
+
+	uint8_t buffer1[ 16 ]         = { 'r', 'e', 'g', 'f', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	uint8_t buffer2[ 16 ]         = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "regf",
+	          4,
+	          0,
+	          (uint8_t *) "regf",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffers[ 0 ]      = buffer1;
+	buffer_sizes[ 0 ] = 16;
+	buffers[ 1 ]      = buffer2;
+	buffer_sizes[ 1 ] = 16;
+	buffers[ 2 ]      = NULL;
+	buffer_sizes[ 2 ] = 0;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_identify_buffers(
+	          scanner,
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          results,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "results[ 0 ].identifier",
+	 results[ 0 ].identifier );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "results[ 0 ].identifier_size",
+	 results[ 0 ].identifier_size,
+	 (size_t) 5 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "results[ 1 ].identifier",
+	 results[ 1 ].identifier );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "results[ 2 ].identifier",
+	 results[ 2 ].identifier );
+
+	/* Test identify buffers with multiple threads
+	 */
+	result = libsigscan_scanner_identify_buffers(
+	          scanner,
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          results,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "results[ 0 ].identifier",
+	 results[ 0 ].identifier );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "results[ 1 ].identifier",
+	 results[ 1 ].identifier );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_identify_buffers(
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          results,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_identify_buffers(
+	          scanner,
+	          NULL,
+	          buffer_sizes,
+	          3,
+	          results,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_identify_buffers(
+	          scanner,
+	          buffers,
+	          buffer_sizes,
+	          -1,
+	          results,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_identify_buffers(
+	          scanner,
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          NULL,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_identify_buffers(
+	          scanner,
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          results,
+	          -1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Counts the files that could not be scanned
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scanner_scan_files_callback(
+     int file_index SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     int file_result,
+     libsigscan_scan_state_t *scan_state,
+     void *callback_function_arguments )
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( file_index )
+
+	if( ( scan_state == NULL )
+	 || ( callback_function_arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	if( file_result != 1 )
+	{
+		*( (int *) callback_function_arguments ) += 1;
+	}
+	return( 1 );
+}
+
+/* Tests the libsigscan_scanner_scan_files function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_files(
+     void )
+{
+	const char *filenames[ 3 ]    = { "missing1", "missing2", "missing3" };
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	int number_of_failed_files    = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "regf",
+	          4,
+	          0,
+	          (uint8_t *) "regf",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan files where files that cannot be scanned are reported to the callback function
+	 */
+	result = libsigscan_scanner_scan_files(
+	          scanner,
+	          filenames,
+	          3,
+	          &sigscan_test_scanner_scan_files_callback,
+	          (void *) &number_of_failed_files,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_failed_files",
+	 number_of_failed_files,
+	 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_failed_files = 0;
+
+	result = libsigscan_scanner_scan_files(
+	          scanner,
+	          filenames,
+	          3,
+	          &sigscan_test_scanner_scan_files_callback,
+	          (void *) &number_of_failed_files,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_failed_files",
+	 number_of_failed_files,
+	 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan files with a callback function that fails
+	 */
+	result = libsigscan_scanner_scan_files(
+	          scanner,
+	          filenames,
+	          3,
+	          &sigscan_test_scanner_scan_files_callback,
+	          NULL,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_files(
+	          NULL,
+	          filenames,
+	          3,
+	          &sigscan_test_scanner_scan_files_callback,
+	          (void *) &number_of_failed_files,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_files(
+	          scanner,
+	          NULL,
+	          3,
+	          &sigscan_test_scanner_scan_files_callback,
+	          (void *) &number_of_failed_files,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_files(
+	          scanner,
+	          filenames,
+	          -1,
+	          &sigscan_test_scanner_scan_files_callback,
+	          (void *) &number_of_failed_files,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_files(
+	          scanner,
+	          filenames,
+	          3,
+	          NULL,
+	          (void *) &number_of_failed_files,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_files(
+	          scanner,
+	          filenames,
+	          3,
+	          &sigscan_test_scanner_scan_files_callback,
+	          (void *) &number_of_failed_files,
+	          -1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_get_compiled_source function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_get_compiled_source(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	const char *search_string     = NULL;
+	char *source                  = NULL;
+	size_t source_size            = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "regf",
+	          4,
+	          0,
+	          (uint8_t *) "regf",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "qcow",
+	          4,
+	          0,
+	          (uint8_t *) "QFI\xfb",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "vhdi_footer",
+	          11,
+	          512,
+	          (uint8_t *) "conectix",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The header scan function switches on the first byte of the buffer
+	 * and the footer scan function on the byte 512 bytes from the end
+	 */
+	result = libsigscan_scanner_get_compiled_source_size(
+	          scanner,
+	          "test",
+	          4,
+	          &source_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_GREATER_THAN_INT(
+	 "source_size",
+	 (int) ( source_size > 0 ),
+	 0 );
+
+	source = (char *) memory_allocate(
+	                   sizeof( char ) * source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "source",
+	 source );
+
+	result = libsigscan_scanner_get_compiled_source(
+	          scanner,
+	          "test",
+	          4,
+	          source,
+	          source_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "source[ source_size - 1 ]",
+	 (int) source[ source_size - 1 ],
+	 0 );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "const char *test_scan_header(\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "switch( buffer[ 0 ] )\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "case 0x51:\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "case 0x72:\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "memcmp( &( buffer[ 0 ] ), \"regf\", 4 ) == 0",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "return( \"regf\" );\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "const char *test_scan_footer(\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "if( buffer_size >= 512 )\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "switch( buffer[ buffer_size - 512 ] )\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "memcmp( &( buffer[ buffer_size - 512 ] ), \"conectix\", 8 ) == 0",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	/* The buffer size already checked by the scan tree node is not checked again
+	 */
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "if( memcmp( &( buffer[ buffer_size - 512 ] ), \"conectix\", 8 ) == 0 )\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "if( ( buffer_size >= 512 )\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "return( \"vhdi_footer\" );\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	memory_free(
+	 source );
+
+	source = NULL;
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Without footer signatures the footer scan function is still written
+	 * but always returns NULL
+	 * The ewf and lvf signatures add a scan tree node on the byte at offset 0
+	 * within the scan tree node on the byte at offset 1
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "regf",
+	          4,
+	          0,
+	          (uint8_t *) "regf",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "ewf",
+	          3,
+	          0,
+	          (uint8_t *) "EVF\x09\x0d\x0a\xff\x00",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "lvf",
+	          3,
+	          0,
+	          (uint8_t *) "LVF\x09\x0d\x0a\xff\x00",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_get_compiled_source_size(
+	          scanner,
+	          "test",
+	          4,
+	          &source_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_GREATER_THAN_INT(
+	 "source_size",
+	 (int) ( source_size > 0 ),
+	 0 );
+
+	source = (char *) memory_allocate(
+	                   sizeof( char ) * source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "source",
+	 source );
+
+	result = libsigscan_scanner_get_compiled_source(
+	          scanner,
+	          "test",
+	          4,
+	          source,
+	          source_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "source[ source_size - 1 ]",
+	 (int) source[ source_size - 1 ],
+	 0 );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "const char *test_scan_header(\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "const char *test_scan_footer(\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 search_string,
+	                 "\treturn( NULL );\n"
+	                 "}\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	/* The buffer size checked by the enclosing scan tree node is not checked again
+	 */
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "if( buffer_size > 1 )\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "switch( buffer[ 0 ] )\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "search_string",
+	 search_string );
+
+	search_string = narrow_string_search_string(
+	                 source,
+	                 "if( buffer_size > 0 )\n",
+	                 source_size );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "search_string",
+	 search_string );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_get_compiled_source(
+	          NULL,
+	          "test",
+	          4,
+	          source,
+	          source_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_get_compiled_source(
+	          scanner,
+	          NULL,
+	          4,
+	          source,
+	          source_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_get_compiled_source(
+	          scanner,
+	          "test",
+	          0,
+	          source,
+	          source_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_get_compiled_source(
+	          scanner,
+	          "1test",
+	          5,
+	          source,
+	          source_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_get_compiled_source(
+	          scanner,
+	          "test",
+	          4,
+	          NULL,
+	          source_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_get_compiled_source(
+	          scanner,
+	          "test",
+	          4,
+	          source,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_get_compiled_source(
+	          scanner,
+	          "test",
+	          4,
+	          source,
+	          source_size - 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 source );
+
+	source = NULL;
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source != NULL )
+	{
+		memory_free(
+		 source );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( LIBSIGSCAN_HAVE_BFIO )
+
+/* Tests the libsigscan_scanner_scan_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file_io_handle(
+     void )
+{
+	/* The header range is read up to the read alignment and the footer range
+	 * from the read alignment, hence the gap between the ranges is a multiple of the
+	 * read alignment. The ranges are read as a single range for a file that is smaller
+	 * than the read alignment and for a gap of the maximum gap size, and as separate
+	 * ranges for a gap that exceeds the maximum gap size
+	 */
+	size64_t file_sizes[ 4 ] = {
+		1000,
+		LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT + LIBSIGSCAN_SCAN_FILE_MAXIMUM_GAP_SIZE + 1024,
+		LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT + LIBSIGSCAN_SCAN_FILE_MAXIMUM_GAP_SIZE + LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT + 1024,
+		100000 };
+
+	/* The last file is scanned with only a footer signature
+	 */
+	int has_header_signature[ 4 ] = {
+		1, 1, 1, 0 };
+
+	int expected_numbers_of_offsets_read[ 4 ] = {
+		1, 1, 2, 1 };
+
+	off64_t expected_offsets_read[ 4 ][ 2 ] = {
+		{ 0, 0 },
+		{ 0, 0 },
+		{ 0, LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT + LIBSIGSCAN_SCAN_FILE_MAXIMUM_GAP_SIZE + LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT },
+		{ 98304, 0 } };
+
+	size64_t expected_sizes_read[ 4 ][ 2 ] = {
+		{ 1000, 0 },
+		{ LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT + LIBSIGSCAN_SCAN_FILE_MAXIMUM_GAP_SIZE + 1024, 0 },
+		{ LIBSIGSCAN_SCAN_FILE_READ_ALIGNMENT, 1024 },
+		{ 1696, 0 } };
+
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	uint8_t *data                         = NULL;
+	off64_t expected_offset               = 0;
+	off64_t offset                        = 0;
+	size64_t size                         = 0;
+	size_t file_size                      = 0;
+	int file_index                        = 0;
+	int number_of_offsets_read            = 0;
+	int number_of_results                 = 0;
+	int offset_read_index                 = 0;
+	int result                            = 0;
+	int result_index                      = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 100000 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	/* Test regular cases
+	 */
+	for( file_index = 0;
+	     file_index < 4;
+	     file_index++ )
+	{
+		file_size = (size_t) file_sizes[ file_index ];
+
+		memory_set(
+		 data,
+		 0,
+		 file_size );
+
+		memory_copy(
+		 data,
+		 "regf",
+		 4 );
+
+		memory_copy(
+		 &( data[ file_size - 512 ] ),
+		 "conectix",
+		 8 );
+
+		result = libsigscan_scanner_initialize(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scanner",
+		 scanner );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( has_header_signature[ file_index ] != 0 )
+		{
+			result = libsigscan_scanner_add_signature(
+			          scanner,
+			          "regf",
+			          4,
+			          0,
+			          (uint8_t *) "regf",
+			          4,
+			          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          "vhdi_footer",
+		          11,
+		          512,
+		          (uint8_t *) "conectix",
+		          8,
+		          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_initialize(
+		          &file_io_handle,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_set(
+		          file_io_handle,
+		          data,
+		          file_size,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_set_track_offsets_read(
+		          file_io_handle,
+		          1,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_initialize(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scan_state",
+		 scan_state );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_file_io_handle(
+		          scanner,
+		          scan_state,
+		          file_io_handle,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test if the header and footer signatures were found
+		 */
+		result = libsigscan_scan_state_get_number_of_results(
+		          scan_state,
+		          &number_of_results,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "number_of_results",
+		 number_of_results,
+		 1 + has_header_signature[ file_index ] );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( result_index = 0;
+		     result_index < number_of_results;
+		     result_index++ )
+		{
+			result = libsigscan_scan_state_get_result(
+			          scan_state,
+			          result_index,
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "scan_result",
+			 scan_result );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_get_offset(
+			          scan_result,
+			          &offset,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( result_index < has_header_signature[ file_index ] )
+			{
+				expected_offset = 0;
+			}
+			else
+			{
+				expected_offset = (off64_t) file_size - 512;
+			}
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 (int64_t) offset,
+			 (int64_t) expected_offset );
+
+			result = libsigscan_scan_result_free(
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Test if only the header and footer ranges were read
+		 */
+		result = libbfio_handle_get_number_of_offsets_read(
+		          file_io_handle,
+		          &number_of_offsets_read,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "number_of_offsets_read",
+		 number_of_offsets_read,
+		 expected_numbers_of_offsets_read[ file_index ] );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( offset_read_index = 0;
+		     offset_read_index < number_of_offsets_read;
+		     offset_read_index++ )
+		{
+			result = libbfio_handle_get_offset_read(
+			          file_io_handle,
+			          offset_read_index,
+			          &offset,
+			          &size,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 (int64_t) offset,
+			 (int64_t) expected_offsets_read[ file_index ][ offset_read_index ] );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+			 "size",
+			 (uint64_t) size,
+			 (uint64_t) expected_sizes_read[ file_index ][ offset_read_index ] );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scan_state_free(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "scan_state",
+		 scan_state );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "scanner",
+		 scanner );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_file_io_handle(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_file_io_handle_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file_io_handle_extents(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	const char *patterns[ 4 ] = {
+		"ABCDEFGH", "IJKLMNOP", "QRSTUVWX", "YZ012345" };
+
+	/* The pattern at offset 122 crosses the adjacent extents at offset 124
+	 * and the pattern at offset 396 crosses the gap between offset 400 and 404
+	 * the pattern at offset 16 is before the data origin, the pattern at offset
+	 * 800 is in an empty extent and the pattern at offset 1010 is in an extent
+	 * that continues past the end of the file
+	 */
+	off64_t pattern_offsets[ 7 ] = {
+		122, 396, 16, 80, 250, 800, 1010 };
+
+	int pattern_indexes[ 7 ] = {
+		0, 1, 2, 2, 3, 1, 3 };
+
+	/* The extents are unsorted and contain overlapping and adjacent extents
+	 */
+	libsigscan_extent_t extents[ 8 ] = {
+		{ 404, 96 }, { 1000, 1000 }, { 124, 76 }, { 800, 0 },
+		{ 0, 100 }, { 150, 110 }, { 300, 100 }, { 100, 24 } };
+
+	libsigscan_extent_t invalid_extents[ 1 ] = {
+		{ -1, 100 } };
+
+	/* The header signature is relative to the data origin of 64
+	 */
+	off64_t expected_offsets[ 5 ] = {
+		64, 80, 122, 250, 1010 };
+
+	size_t scan_buffer_sizes[ 2 ] = {
+		0, 32 };
+
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	off64_t offset                        = 0;
+	size_t pattern_size                   = 0;
+	int number_of_results                 = 0;
+	int pattern_index                     = 0;
+	int result                            = 0;
+	int result_index                      = 0;
+	int scan_buffer_size_index            = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 1024 );
+
+	memory_copy(
+	 &( data[ 64 ] ),
+	 "regf",
+	 4 );
+
+	for( result_index = 0;
+	     result_index < 7;
+	     result_index++ )
+	{
+		pattern_index = pattern_indexes[ result_index ];
+
+		pattern_size = narrow_string_length(
+		                patterns[ pattern_index ] );
+
+		memory_copy(
+		 &( data[ pattern_offsets[ result_index ] ] ),
+		 patterns[ pattern_index ],
+		 pattern_size );
+	}
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          1024,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "regf",
+	          4,
+	          0,
+	          (uint8_t *) "regf",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( pattern_index = 0;
+	     pattern_index < 4;
+	     pattern_index++ )
+	{
+		pattern_size = narrow_string_length(
+		                patterns[ pattern_index ] );
+
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          patterns[ pattern_index ],
+		          pattern_size,
+		          0,
+		          (uint8_t *) patterns[ pattern_index ],
+		          pattern_size,
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( scan_buffer_size_index = 0;
+	     scan_buffer_size_index < 2;
+	     scan_buffer_size_index++ )
+	{
+		result = libsigscan_scan_state_initialize(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scan_state",
+		 scan_state );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_set_data_origin(
+		          scan_state,
+		          64,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_set_scan_buffer_size(
+		          scanner,
+		          scan_buffer_sizes[ scan_buffer_size_index ],
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_file_io_handle_extents(
+		          scanner,
+		          scan_state,
+		          file_io_handle,
+		          extents,
+		          8,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_get_number_of_results(
+		          scan_state,
+		          &number_of_results,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "number_of_results",
+		 number_of_results,
+		 5 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( result_index = 0;
+		     result_index < 5;
+		     result_index++ )
+		{
+			result = libsigscan_scan_state_get_result(
+			          scan_state,
+			          result_index,
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "scan_result",
+			 scan_result );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_get_offset(
+			          scan_result,
+			          &offset,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 (int64_t) offset,
+			 (int64_t) expected_offsets[ result_index ] );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_free(
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scan_state_free(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "scan_state",
+		 scan_state );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_origin(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan file IO handle extents without extents
+	 */
+	result = libsigscan_scanner_scan_file_io_handle_extents(
+	          scanner,
+	          scan_state,
+	          file_io_handle,
+	          extents,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_file_io_handle_extents(
+	          NULL,
+	          scan_state,
+	          file_io_handle,
+	          extents,
+	          8,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_io_handle_extents(
+	          scanner,
+	          scan_state,
+	          file_io_handle,
+	          NULL,
+	          8,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_io_handle_extents(
+	          scanner,
+	          scan_state,
+	          file_io_handle,
+	          extents,
+	          -1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_io_handle_extents(
+	          scanner,
+	          scan_state,
+	          file_io_handle,
+	          invalid_extents,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test scan file IO handle extents with a data origin beyond the end of the file
+	 */
+	result = libsigscan_scan_state_set_data_origin(
+	          scan_state,
+	          2048,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_file_io_handle_extents(
+	          scanner,
+	          scan_state,
+	          file_io_handle,
+	          extents,
+	          8,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBSIGSCAN_HAVE_BFIO ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_initialize",
+	 sigscan_test_scanner_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_free",
+	 sigscan_test_scanner_free );
+
+	/* TODO: add tests for sigscan_test_scanner_signal_abort */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_set_scan_buffer_size",
+	 sigscan_test_scanner_set_scan_buffer_size );
+
+	/* TODO: add tests for libsigscan_scanner_set_number_of_read_buffers */
+
+	/* TODO: add tests for libsigscan_scanner_set_direct_io */
+
+	/* TODO: add tests for libsigscan_scanner_add_signature */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_update_byte_value_frequencies",
+	 sigscan_test_scanner_update_byte_value_frequencies );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_get_memory_usage",
+	 sigscan_test_scanner_get_memory_usage );
+
+	/* TODO: add tests for libsigscan_scanner_scan_start */
+
+	/* TODO: add tests for libsigscan_scanner_scan_stop */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_buffer",
+	 sigscan_test_scanner_scan_buffer );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_buffer_overlapping_patterns",
+	 sigscan_test_scanner_scan_buffer_overlapping_patterns );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_iovec",
+	 sigscan_test_scanner_scan_iovec );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_identify_buffers",
+	 sigscan_test_scanner_identify_buffers );
+
+	/* TODO: add tests for libsigscan_scanner_scan_file */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_files",
+	 sigscan_test_scanner_scan_files );
+
+	/* TODO: add tests for libsigscan_scanner_scan_file_wide */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_get_compiled_source",
+	 sigscan_test_scanner_get_compiled_source );
+
+#if defined( LIBSIGSCAN_HAVE_BFIO )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_file_io_handle",
+	 sigscan_test_scanner_scan_file_io_handle );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_file_io_handle_extents",
+	 sigscan_test_scanner_scan_file_io_handle_extents );
+
+#endif /* defined( LIBSIGSCAN_HAVE_BFIO ) */
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_internal_scanner_get_read_buffer_size",
+	 sigscan_test_internal_scanner_get_read_buffer_size );
+
+#if defined( LIBSIGSCAN_HAVE_BFIO )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_internal_scanner_scan_file_io_handle_range",
+	 sigscan_test_internal_scanner_scan_file_io_handle_range );
+
+#endif /* defined( LIBSIGSCAN_HAVE_BFIO ) */
 
-	/* TODO: add tests for libsigscan_scanner_scan_file_io_handle */
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
 
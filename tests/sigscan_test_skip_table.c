@@ -33,6 +33,10 @@
 #include "sigscan_test_memory.h"
 #include "sigscan_test_unused.h"
 
+#include "../libsigscan/libsigscan_byte_value_frequencies.h"
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_libcdata.h"
+#include "../libsigscan/libsigscan_signature.h"
 #include "../libsigscan/libsigscan_skip_table.h"
 
 #if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
@@ -270,6 +274,534 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_skip_table_fill function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_skip_table_fill(
+     void )
+{
+	uint8_t buffer[ 16 ]                                        = { 0 };
+	libcdata_list_t *signatures_list                            = NULL;
+	libcerror_error_t *error                                    = NULL;
+	libsigscan_byte_value_frequencies_t *byte_value_frequencies = NULL;
+	libsigscan_signature_t *signature                           = NULL;
+	libsigscan_skip_table_t *skip_table                         = NULL;
+	size_t block_size                                           = 0;
+	size_t byte_value_offset                                    = 0;
+	size_t skip_value                                           = 0;
+	int result                                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "test",
+	          4,
+	          0,
+	          (uint8_t *) "AB\x00\x00",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_append_value(
+	          signatures_list,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature = NULL;
+
+	result = libsigscan_byte_value_frequencies_initialize(
+	          &byte_value_frequencies,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_value_frequencies",
+	 byte_value_frequencies );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_byte_value_frequencies_update(
+	          byte_value_frequencies,
+	          buffer,
+	          16,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases without byte value frequencies
+	 */
+	result = libsigscan_skip_table_initialize(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "skip_table",
+	 skip_table );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_fill(
+	          skip_table,
+	          signatures_list,
+	          NULL,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_get_byte_value_offset(
+	          skip_table,
+	          &byte_value_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_value_offset",
+	 byte_value_offset,
+	 (size_t) 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_get_skip_value(
+	          skip_table,
+	          0,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "skip_value",
+	 skip_value,
+	 (size_t) 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_free(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with byte value frequencies
+	 */
+	result = libsigscan_skip_table_initialize(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "skip_table",
+	 skip_table );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_fill(
+	          skip_table,
+	          signatures_list,
+	          byte_value_frequencies,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_get_byte_value_offset(
+	          skip_table,
+	          &byte_value_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_value_offset",
+	 byte_value_offset,
+	 (size_t) 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_get_skip_value(
+	          skip_table,
+	          0,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "skip_value",
+	 skip_value,
+	 (size_t) 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_free(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with a block size
+	 */
+	result = libsigscan_skip_table_initialize(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "skip_table",
+	 skip_table );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_fill(
+	          skip_table,
+	          signatures_list,
+	          NULL,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_get_block_size(
+	          skip_table,
+	          &block_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "block_size",
+	 block_size,
+	 (size_t) 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_get_block_skip_value(
+	          skip_table,
+	          (uint8_t *) "AB",
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "skip_value",
+	 skip_value,
+	 (size_t) 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_get_block_skip_value(
+	          skip_table,
+	          (uint8_t *) "XY",
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "skip_value",
+	 skip_value,
+	 (size_t) 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_skip_table_fill(
+	          NULL,
+	          signatures_list,
+	          NULL,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_skip_table_fill(
+	          skip_table,
+	          signatures_list,
+	          NULL,
+	          LIBSIGSCAN_SKIP_TABLE_MAXIMUM_BLOCK_SIZE + 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_skip_table_fill_skip_values(
+	          skip_table,
+	          signatures_list,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_skip_table_free(
+	          &skip_table,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "skip_table",
+	 skip_table );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_byte_value_frequencies_free(
+	          &byte_value_frequencies,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( skip_table != NULL )
+	{
+		libsigscan_skip_table_free(
+		 &skip_table,
+		 NULL );
+	}
+	if( byte_value_frequencies != NULL )
+	{
+		libsigscan_byte_value_frequencies_free(
+		 &byte_value_frequencies,
+		 NULL );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libsigscan_skip_table_get_smallest_pattern_size function
  * Returns 1 if successful or 0 if not
  */
@@ -420,14 +952,26 @@ int main(
 	 "libsigscan_skip_table_free",
 	 sigscan_test_skip_table_free );
 
-	/* TODO: add tests for libsigscan_skip_table_fill */
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_skip_table_fill",
+	 sigscan_test_skip_table_fill );
+
+	/* TODO: add tests for libsigscan_skip_table_fill_skip_values */
+
+	/* TODO: add tests for libsigscan_skip_table_fill_block_skip_values */
 
 	SIGSCAN_TEST_RUN(
 	 "libsigscan_skip_table_get_smallest_pattern_size",
 	 sigscan_test_skip_table_get_smallest_pattern_size );
 
+	/* TODO: add tests for libsigscan_skip_table_get_byte_value_offset */
+
 	/* TODO: add tests for libsigscan_skip_table_get_skip_value */
 
+	/* TODO: add tests for libsigscan_skip_table_get_block_size */
+
+	/* TODO: add tests for libsigscan_skip_table_get_block_skip_value */
+
 	/* TODO: add tests for libsigscan_skip_table_printf */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
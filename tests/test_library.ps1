@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "byte_value_group error notify offset_group pattern_weights scan_object scan_result scan_state scan_tree scan_tree_node scanner signature signature_group signature_table skip_table support weight_group"
+$LibraryTests = "bndm_table byte_value_frequencies byte_value_group compiled_source direct_file_io_handle error notify offset_group pattern_weights scan_object scan_result scan_state scan_tree scan_tree_node scan_tree_statistics scanner signature signature_group signature_table skip_table support weight_group"
 $LibraryTestsWithInput = ""
 $OptionSets = ""
 
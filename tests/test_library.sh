@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="byte_value_group error notify offset_group pattern_weights scan_object scan_result scan_state scan_tree scan_tree_node scanner signature signature_group signature_table skip_table support weight_group";
+LIBRARY_TESTS="bndm_table byte_value_frequencies byte_value_group compiled_source direct_file_io_handle error notify offset_group pattern_weights scan_object scan_result scan_state scan_tree scan_tree_node scan_tree_statistics scanner signature signature_group signature_table skip_table support weight_group";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 
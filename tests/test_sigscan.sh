@@ -17,6 +17,44 @@ then
 	exit ${EXIT_IGNORE};
 fi
 
+# Tests a record output format of the scan tool.
+#
+# Arguments:
+#   a string containing the output format
+#   a string containing the path of the test input file
+#   a string containing the path of the file with the expected output
+#
+# Returns:
+#   an integer containg the exit status of the test
+#
+test_output_format()
+{
+	local OUTPUT_FORMAT=$1;
+	local INPUT_FILE=$2;
+	local EXPECTED_OUTPUT_FILE=$3;
+
+	local TEST_OUTPUT_FILE="${EXPECTED_OUTPUT_FILE}.out";
+
+	${TEST_EXECUTABLE} -c../etc/sigscan.conf -o ${OUTPUT_FORMAT} "${INPUT_FILE}" > "${TEST_OUTPUT_FILE}";
+	local RESULT=$?;
+
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		cmp -s "${EXPECTED_OUTPUT_FILE}" "${TEST_OUTPUT_FILE}";
+		RESULT=$?;
+	fi
+
+	echo -n "sigscan with options: '-o ${OUTPUT_FORMAT}'";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo " (FAIL)";
+	else
+		echo " (PASS)";
+	fi
+	return ${RESULT};
+}
+
 TEST_EXECUTABLE="../sigscantools/sigscan";
 
 if ! test -x "${TEST_EXECUTABLE}";
@@ -126,5 +164,44 @@ do
 	fi
 done
 
+# The file name of the record output format test input contains a valid UTF-8
+# encoded character, an invalid UTF-8 sequence and a quote.
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	TMPDIR="tmp$$";
+
+	rm -rf ${TMPDIR};
+	mkdir ${TMPDIR};
+
+	INPUT_FILE=`printf "${TMPDIR}/7z\xc3\xa9\xff\".bin"`;
+
+	cp input/signatures/7z.bin "${INPUT_FILE}";
+
+	printf '{"path":"%s/7z\xc3\xa9\\ufffd\\".bin","offset":0,"identifier":"7z"}\n' "${TMPDIR}" > "${TMPDIR}/jsonl";
+
+	test_output_format "jsonl" "${INPUT_FILE}" "${TMPDIR}/jsonl";
+	RESULT=$?;
+
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		printf '%s\t0\t7z\n' "${INPUT_FILE}" > "${TMPDIR}/tsv";
+
+		test_output_format "tsv" "${INPUT_FILE}" "${TMPDIR}/tsv";
+		RESULT=$?;
+	fi
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		# A bin record consists of a 64-bit offset, a 32-bit path size and a 32-bit
+		# identifier size, all stored in little-endian, followed by the path and identifier.
+		PATH_SIZE=`printf "%02x" ${#INPUT_FILE}`;
+
+		printf "\x00\x00\x00\x00\x00\x00\x00\x00\x${PATH_SIZE}\x00\x00\x00\x02\x00\x00\x00%s7z" "${INPUT_FILE}" > "${TMPDIR}/bin";
+
+		test_output_format "bin" "${INPUT_FILE}" "${TMPDIR}/bin";
+		RESULT=$?;
+	fi
+	rm -rf ${TMPDIR};
+fi
+
 exit ${RESULT};
 